@@ -3,7 +3,13 @@
 void ES::Engine::Scheduler::FixedTimeUpdate::RunSystems()
 {
     auto currentTime = std::chrono::high_resolution_clock::now();
-    _elapsedTime += std::chrono::duration<float>(currentTime - _lastTime).count();
+    Advance(std::chrono::duration<float>(currentTime - _lastTime).count());
+    _lastTime = currentTime;
+}
+
+void ES::Engine::Scheduler::FixedTimeUpdate::Advance(float elapsedTime)
+{
+    _elapsedTime += elapsedTime;
     auto ticks = static_cast<unsigned int>(_elapsedTime / _tickRate);
     _elapsedTime -= ticks * _tickRate;
 
@@ -14,6 +20,4 @@ void ES::Engine::Scheduler::FixedTimeUpdate::RunSystems()
             (*system)(_core);
         }
     }
-
-    _lastTime = currentTime;
 }
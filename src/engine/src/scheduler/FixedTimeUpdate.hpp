@@ -22,6 +22,15 @@ class FixedTimeUpdate : public AScheduler {
     FixedTimeUpdate(Core &core, float tickRate = DEFAULT_TICK_RATE) : AScheduler(core), _tickRate(tickRate) {}
     void RunSystems() override;
 
+    /**
+     * @brief Accumulate the given time and run the ticks it completes, instead of measuring the time elapsed since
+     * the last run.
+     *
+     * @param elapsedTime Time to accumulate, in seconds.
+     * @note This is meant to drive the scheduler with a controlled timestep, e.g. in tests or replays.
+     */
+    void Advance(float elapsedTime);
+
     /**
      * @brief Get the fixed tick rate
      *
@@ -38,6 +47,15 @@ class FixedTimeUpdate : public AScheduler {
      */
     inline void SetTickRate(float tickRate) { _tickRate = tickRate; }
 
+    /**
+     * @brief Get how far the accumulated time is between the last tick and the next one
+     *
+     * @return float The time left over after the last run, as a fraction of the tick rate, in [0, 1)
+     * @note This is meant to interpolate what the fixed systems update (like physics) when rendering,
+     *      between the state of the previous tick and the state of the last one.
+     */
+    inline float GetInterpolationFactor() const { return _elapsedTime / _tickRate; }
+
   private:
     float _tickRate;
     std::chrono::time_point<std::chrono::high_resolution_clock> _lastTime = std::chrono::high_resolution_clock::now();
@@ -51,3 +51,24 @@ TEST(Core, FixedTimeUpdate)
     core.RunSystems();
     ASSERT_EQ(update_count, 7);
 }
+
+TEST(Core, FixedTimeUpdateInterpolationFactor)
+{
+    Core core;
+
+    int update_count = 0;
+    core.RegisterSystem<Scheduler::FixedTimeUpdate>([&update_count](const Core &) { update_count++; });
+    auto &scheduler = core.GetScheduler<Scheduler::FixedTimeUpdate>();
+    scheduler.SetTickRate(0.25f);
+    ASSERT_FLOAT_EQ(scheduler.GetInterpolationFactor(), 0.0f);
+
+    // Half a tick is accumulated, but no tick is run
+    scheduler.Advance(0.125f);
+    ASSERT_EQ(update_count, 0);
+    ASSERT_FLOAT_EQ(scheduler.GetInterpolationFactor(), 0.5f);
+
+    // One tick is run and a quarter of the next one is left over
+    scheduler.Advance(0.1875f);
+    ASSERT_EQ(update_count, 1);
+    ASSERT_FLOAT_EQ(scheduler.GetInterpolationFactor(), 0.25f);
+}
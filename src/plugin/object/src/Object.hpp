@@ -3,7 +3,10 @@
 #include "AssetID.hpp"
 #include "Mesh.hpp"
 #include "MeshID.hpp"
+#include "MeshSimplification.hpp"
 #include "OBJLoader.hpp"
 #include "ResourceManager.hpp"
 #include "Transform.hpp"
 #include "Vertex.hpp"
+#include "WorldMatrix.hpp"
+#include "WorldMatrixSystems.hpp"
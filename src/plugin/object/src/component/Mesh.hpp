@@ -33,6 +33,14 @@ namespace ES::Plugin::Object::Component {
  *
  * This structure is used to represent a mesh.
  * It contains the vertices and indices of the mesh.
+ *
+ * @note Renderers upload a mesh again only when the component is replaced or patched, not when it is modified
+ * through a reference. A mesh edited in place must be patched for the change to be drawn:
+ * @code
+ * core.GetRegistry().patch<ES::Plugin::Object::Component::Mesh>(entity, [](auto &mesh) {
+ *     mesh.vertices[0].y += 1.0f;
+ * });
+ * @endcode
  */
 struct Mesh {
     std::vector<glm::vec3> vertices{};
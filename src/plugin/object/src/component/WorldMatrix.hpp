@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Transform.hpp"
+
+namespace ES::Plugin::Object::Component {
+/**
+ * Component caching the matrices of the Transform of a game object.
+ * It is added to every entity with a Transform and kept up to date by the UpdateWorldMatrices system, which only
+ * recomputes it when the transform changed. Systems reading the matrices of many entities every frame, such as
+ * rendering and culling, should read this component instead of calling Transform::getTransformationMatrix.
+ */
+struct WorldMatrix {
+    /**
+     * Transformation matrix of the entity, the same as Transform::getTransformationMatrix.
+     */
+    glm::mat4 model = glm::mat4(1.0f);
+    /**
+     * Matrix transforming the normals of the entity, the inverse transpose of the model matrix.
+     */
+    glm::mat3 normal = glm::mat3(1.0f);
+    /**
+     * Transform the matrices were computed from.
+     */
+    Transform source;
+};
+} // namespace ES::Plugin::Object::Component
@@ -0,0 +1,122 @@
+#include "WorldMatrixSystems.hpp"
+#include "ThreadPool.hpp"
+#include "WorldMatrix.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace ES::Plugin::Object::System {
+namespace {
+/// @brief Number of changed transforms above which the matrices are computed by several threads.
+constexpr std::size_t PARALLEL_UPDATE_THRESHOLD = 4096;
+
+/**
+ * @brief Changed transforms, one array per coordinate, and the components their matrices are written to.
+ */
+struct ChangedTransforms {
+    std::vector<float> px, py, pz;
+    std::vector<float> sx, sy, sz;
+    std::vector<float> qx, qy, qz, qw;
+    std::vector<Component::WorldMatrix *> targets;
+
+    void Push(const Component::Transform &transform, Component::WorldMatrix &target)
+    {
+        px.push_back(transform.position.x);
+        py.push_back(transform.position.y);
+        pz.push_back(transform.position.z);
+        sx.push_back(transform.scale.x);
+        sy.push_back(transform.scale.y);
+        sz.push_back(transform.scale.z);
+        qx.push_back(transform.rotation.x);
+        qy.push_back(transform.rotation.y);
+        qz.push_back(transform.rotation.z);
+        qw.push_back(transform.rotation.w);
+        targets.push_back(&target);
+    }
+
+    inline std::size_t Size() const { return targets.size(); }
+};
+
+/**
+ * @brief Compute the matrices of the transforms in [first, last).
+ *
+ * The rotation matrix is built from the quaternion as glm::mat4_cast does. As the rotation is orthonormal, the
+ * inverse transpose of rotation * scale is rotation * inverse(scale): no matrix inversion is needed.
+ */
+void ComputeMatrices(const ChangedTransforms &changed, std::size_t first, std::size_t last)
+{
+    for (std::size_t i = first; i < last; i++)
+    {
+        float x = changed.qx[i];
+        float y = changed.qy[i];
+        float z = changed.qz[i];
+        float w = changed.qw[i];
+        float xx = x * x;
+        float yy = y * y;
+        float zz = z * z;
+        float xy = x * y;
+        float xz = x * z;
+        float yz = y * z;
+        float wx = w * x;
+        float wy = w * y;
+        float wz = w * z;
+
+        glm::vec3 right(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy));
+        glm::vec3 up(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx));
+        glm::vec3 forward(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy));
+
+        Component::WorldMatrix &target = *changed.targets[i];
+        target.model[0] = glm::vec4(right * changed.sx[i], 0.0f);
+        target.model[1] = glm::vec4(up * changed.sy[i], 0.0f);
+        target.model[2] = glm::vec4(forward * changed.sz[i], 0.0f);
+        target.model[3] = glm::vec4(changed.px[i], changed.py[i], changed.pz[i], 1.0f);
+        target.normal[0] = right / changed.sx[i];
+        target.normal[1] = up / changed.sy[i];
+        target.normal[2] = forward / changed.sz[i];
+    }
+}
+} // namespace
+
+void UpdateWorldMatrices(ES::Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+
+    // A new WorldMatrix holds the identity, computed from a default Transform: it is recomputed below if needed
+    std::vector<entt::entity> missing;
+    for (auto entity : registry.view<Component::Transform>(entt::exclude<Component::WorldMatrix>))
+    {
+        missing.push_back(entity);
+    }
+    for (auto entity : missing)
+    {
+        registry.emplace<Component::WorldMatrix>(entity);
+    }
+
+    ChangedTransforms changed;
+    registry.view<Component::Transform, Component::WorldMatrix>().each(
+        [&changed](Component::Transform &transform, Component::WorldMatrix &worldMatrix) {
+            if (transform.position == worldMatrix.source.position && transform.scale == worldMatrix.source.scale &&
+                transform.rotation == worldMatrix.source.rotation)
+            {
+                return;
+            }
+            worldMatrix.source = transform;
+            changed.Push(transform, worldMatrix);
+        });
+
+    std::size_t count = changed.Size();
+    auto *threadPool = registry.ctx().find<ES::Utils::ThreadPool>();
+    std::size_t threadCount = threadPool != nullptr ? threadPool->GetThreadCount() : 1;
+    if (count < PARALLEL_UPDATE_THRESHOLD || threadCount < 2)
+    {
+        ComputeMatrices(changed, 0, count);
+        return;
+    }
+
+    // Every task computes a contiguous range, so that each thread writes its own components
+    std::size_t chunkSize = (count + threadCount - 1) / threadCount;
+    threadPool->ParallelFor((count + chunkSize - 1) / chunkSize, [&changed, chunkSize, count](std::size_t task) {
+        ComputeMatrices(changed, task * chunkSize, std::min((task + 1) * chunkSize, count));
+    });
+}
+} // namespace ES::Plugin::Object::System
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::Object::System {
+/**
+ * @brief Add a WorldMatrix to the entities with a Transform, and recompute the ones whose Transform changed.
+ *
+ * Changed transforms are gathered as structure of arrays and computed in a single pass over contiguous data, split
+ * between the threads of the ES::Utils::ThreadPool resource when there are many of them and the resource is
+ * registered.
+ *
+ * @param core  core
+ * @note To be used once per frame, after the transforms were moved and before they are rendered.
+ */
+void UpdateWorldMatrices(ES::Engine::Core &core);
+} // namespace ES::Plugin::Object::System
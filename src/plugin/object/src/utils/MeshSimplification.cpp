@@ -0,0 +1,368 @@
+#include "MeshSimplification.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+
+namespace ES::Plugin::Object::Utils {
+
+namespace {
+/// @brief Minimum cosine between the normals of a triangle before and after a collapse.
+constexpr float MIN_NORMAL_COSINE = 0.2f;
+constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief Quadric error of a set of planes, as the 10 distinct coefficients of its symmetric 4x4 matrix.
+ */
+struct Quadric {
+    std::array<double, 10> m{};
+
+    static Quadric FromPlane(double a, double b, double c, double d, double weight)
+    {
+        Quadric quadric;
+        quadric.m = {a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d};
+        for (double &coefficient : quadric.m)
+        {
+            coefficient *= weight;
+        }
+        return quadric;
+    }
+
+    Quadric &operator+=(const Quadric &other)
+    {
+        for (std::size_t i = 0; i < m.size(); i++)
+        {
+            m[i] += other.m[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Get the sum of the squared distances from a point to the planes.
+     */
+    double Error(const glm::vec3 &point) const
+    {
+        double x = point.x;
+        double y = point.y;
+        double z = point.z;
+        return m[0] * x * x + 2 * m[1] * x * y + 2 * m[2] * x * z + 2 * m[3] * x + m[4] * y * y + 2 * m[5] * y * z +
+               2 * m[6] * y + m[7] * z * z + 2 * m[8] * z + m[9];
+    }
+};
+
+/**
+ * @brief Collapse of the vertex from into the vertex to. Versions tell if a vertex changed since the collapse was
+ * queued, in which case its cost is outdated.
+ */
+struct Collapse {
+    double cost = 0.0;
+    uint32_t from = 0;
+    uint32_t to = 0;
+    uint32_t fromVersion = 0;
+    uint32_t toVersion = 0;
+
+    bool operator>(const Collapse &other) const { return cost > other.cost; }
+};
+
+class Simplifier {
+  public:
+    explicit Simplifier(const Component::Mesh &mesh)
+        : _positions(mesh.vertices), _quadrics(mesh.vertices.size()), _vertexTriangles(mesh.vertices.size()),
+          _locked(mesh.vertices.size(), 0), _removed(mesh.vertices.size(), 0), _versions(mesh.vertices.size(), 0)
+    {
+        _triangles.reserve(mesh.indices.size() / 3);
+        for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+        {
+            std::array<uint32_t, 3> triangle = {mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]};
+            if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0])
+            {
+                continue;
+            }
+            auto index = static_cast<uint32_t>(_triangles.size());
+            _triangles.push_back(triangle);
+            _triangleRemoved.push_back(0);
+            for (uint32_t vertex : triangle)
+            {
+                _vertexTriangles[vertex].push_back(index);
+            }
+            AddPlaneQuadric(triangle);
+        }
+        _liveTriangles = _triangles.size();
+
+        // Edges used by a single triangle are on a border, and edges used by more are non manifold
+        std::unordered_map<uint64_t, uint32_t> edgeUses;
+        for (const auto &triangle : _triangles)
+        {
+            for (std::size_t corner = 0; corner < 3; corner++)
+            {
+                edgeUses[EdgeKey(triangle[corner], triangle[(corner + 1) % 3])]++;
+            }
+        }
+        for (const auto &[key, uses] : edgeUses)
+        {
+            if (uses != 2)
+            {
+                _locked[key >> 32] = 1;
+                _locked[key & 0xffffffff] = 1;
+            }
+        }
+        for (const auto &[key, uses] : edgeUses)
+        {
+            QueueEdge(static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key & 0xffffffff));
+        }
+    }
+
+    void Run(std::size_t targetTriangles)
+    {
+        while (_liveTriangles > targetTriangles && !_queue.empty())
+        {
+            Collapse collapse = _queue.top();
+            _queue.pop();
+            if (_removed[collapse.from] || _removed[collapse.to] || _versions[collapse.from] != collapse.fromVersion ||
+                _versions[collapse.to] != collapse.toVersion || !CanCollapse(collapse.from, collapse.to))
+            {
+                continue;
+            }
+            Apply(collapse.from, collapse.to);
+        }
+    }
+
+    Component::Mesh GetMesh(const Component::Mesh &source) const
+    {
+        bool hasNormals = source.normals.size() == source.vertices.size();
+        bool hasTexCoords = source.texCoords.size() == source.vertices.size();
+
+        Component::Mesh result;
+        result.indices.reserve(_liveTriangles * 3);
+        std::vector<uint32_t> remap(_positions.size(), INVALID_INDEX);
+        for (std::size_t i = 0; i < _triangles.size(); i++)
+        {
+            if (_triangleRemoved[i])
+            {
+                continue;
+            }
+            for (uint32_t vertex : _triangles[i])
+            {
+                if (remap[vertex] == INVALID_INDEX)
+                {
+                    remap[vertex] = static_cast<uint32_t>(result.vertices.size());
+                    result.vertices.push_back(source.vertices[vertex]);
+                    if (hasNormals)
+                        result.normals.push_back(source.normals[vertex]);
+                    if (hasTexCoords)
+                        result.texCoords.push_back(source.texCoords[vertex]);
+                }
+                result.indices.push_back(remap[vertex]);
+            }
+        }
+        return result;
+    }
+
+  private:
+    static uint64_t EdgeKey(uint32_t a, uint32_t b)
+    {
+        return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    }
+
+    glm::vec3 GetNormal(const std::array<uint32_t, 3> &triangle) const
+    {
+        return glm::cross(_positions[triangle[1]] - _positions[triangle[0]],
+                          _positions[triangle[2]] - _positions[triangle[0]]);
+    }
+
+    void AddPlaneQuadric(const std::array<uint32_t, 3> &triangle)
+    {
+        glm::vec3 normal = GetNormal(triangle);
+        float length = glm::length(normal);
+        if (length <= 0.0f)
+        {
+            return;
+        }
+        glm::vec3 unit = normal / length;
+        double d = -glm::dot(unit, _positions[triangle[0]]);
+        // Weighted by area, so that large triangles resist being distorted more than small ones
+        Quadric quadric = Quadric::FromPlane(unit.x, unit.y, unit.z, d, 0.5 * length);
+        for (uint32_t vertex : triangle)
+        {
+            _quadrics[vertex] += quadric;
+        }
+    }
+
+    void QueueCollapse(uint32_t from, uint32_t to)
+    {
+        if (_locked[from])
+        {
+            return;
+        }
+        Quadric quadric = _quadrics[from];
+        quadric += _quadrics[to];
+        _queue.push(Collapse{quadric.Error(_positions[to]), from, to, _versions[from], _versions[to]});
+    }
+
+    void QueueEdge(uint32_t a, uint32_t b)
+    {
+        QueueCollapse(a, b);
+        QueueCollapse(b, a);
+    }
+
+    /**
+     * @brief Check that collapsing from into to neither flips a triangle nor pinches the surface.
+     */
+    bool CanCollapse(uint32_t from, uint32_t to)
+    {
+        std::size_t sharedTriangles = 0;
+        _fromNeighbors.clear();
+        _toNeighbors.clear();
+        for (uint32_t index : _vertexTriangles[to])
+        {
+            if (_triangleRemoved[index])
+                continue;
+            for (uint32_t vertex : _triangles[index])
+            {
+                if (vertex != to)
+                    _toNeighbors.push_back(vertex);
+            }
+        }
+        for (uint32_t index : _vertexTriangles[from])
+        {
+            if (_triangleRemoved[index])
+                continue;
+            const auto &triangle = _triangles[index];
+            if (std::find(triangle.begin(), triangle.end(), to) != triangle.end())
+            {
+                sharedTriangles++;
+                continue;
+            }
+            for (uint32_t vertex : triangle)
+            {
+                if (vertex != from)
+                    _fromNeighbors.push_back(vertex);
+            }
+
+            std::array<uint32_t, 3> moved = triangle;
+            std::replace(moved.begin(), moved.end(), from, to);
+            glm::vec3 before = GetNormal(triangle);
+            glm::vec3 after = GetNormal(moved);
+            float beforeLength = glm::length(before);
+            float afterLength = glm::length(after);
+            if (afterLength <= 0.0f || glm::dot(before, after) < MIN_NORMAL_COSINE * beforeLength * afterLength)
+            {
+                return false;
+            }
+        }
+        if (sharedTriangles == 0)
+        {
+            return false;
+        }
+
+        // The vertices opposite the edge are the only common neighbors of its endpoints on a manifold surface
+        std::sort(_fromNeighbors.begin(), _fromNeighbors.end());
+        _fromNeighbors.erase(std::unique(_fromNeighbors.begin(), _fromNeighbors.end()), _fromNeighbors.end());
+        std::sort(_toNeighbors.begin(), _toNeighbors.end());
+        _toNeighbors.erase(std::unique(_toNeighbors.begin(), _toNeighbors.end()), _toNeighbors.end());
+        for (uint32_t vertex : _fromNeighbors)
+        {
+            if (std::binary_search(_toNeighbors.begin(), _toNeighbors.end(), vertex))
+            {
+                // A neighbor of from sharing no triangle with the edge, already linked to to
+                bool opposite = false;
+                for (uint32_t index : _vertexTriangles[from])
+                {
+                    const auto &triangle = _triangles[index];
+                    if (!_triangleRemoved[index] && std::find(triangle.begin(), triangle.end(), to) != triangle.end() &&
+                        std::find(triangle.begin(), triangle.end(), vertex) != triangle.end())
+                    {
+                        opposite = true;
+                        break;
+                    }
+                }
+                if (!opposite)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    void Apply(uint32_t from, uint32_t to)
+    {
+        for (uint32_t index : _vertexTriangles[from])
+        {
+            if (_triangleRemoved[index])
+                continue;
+            auto &triangle = _triangles[index];
+            if (std::find(triangle.begin(), triangle.end(), to) != triangle.end())
+            {
+                _triangleRemoved[index] = 1;
+                _liveTriangles--;
+                continue;
+            }
+            std::replace(triangle.begin(), triangle.end(), from, to);
+            _vertexTriangles[to].push_back(index);
+        }
+        _vertexTriangles[from].clear();
+        std::erase_if(_vertexTriangles[to], [this](uint32_t index) { return _triangleRemoved[index] != 0; });
+
+        _quadrics[to] += _quadrics[from];
+        _removed[from] = 1;
+        _versions[to]++;
+
+        // The cost of every collapse involving to changed
+        for (uint32_t index : _vertexTriangles[to])
+        {
+            for (uint32_t vertex : _triangles[index])
+            {
+                if (vertex != to)
+                    QueueEdge(vertex, to);
+            }
+        }
+    }
+
+    const std::vector<glm::vec3> &_positions;
+    std::vector<std::array<uint32_t, 3>> _triangles;
+    std::vector<uint8_t> _triangleRemoved;
+    std::size_t _liveTriangles = 0;
+
+    std::vector<Quadric> _quadrics;
+    std::vector<std::vector<uint32_t>> _vertexTriangles;
+    std::vector<uint8_t> _locked;
+    std::vector<uint8_t> _removed;
+    std::vector<uint32_t> _versions;
+
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<>> _queue;
+    std::vector<uint32_t> _fromNeighbors;
+    std::vector<uint32_t> _toNeighbors;
+};
+} // namespace
+
+Component::Mesh SimplifyMesh(const Component::Mesh &mesh, float ratio)
+{
+    Simplifier simplifier(mesh);
+    std::size_t triangleCount = mesh.indices.size() / 3;
+    double kept = static_cast<double>(triangleCount) * std::clamp(ratio, 0.0f, 1.0f);
+    simplifier.Run(static_cast<std::size_t>(std::floor(kept)));
+    return simplifier.GetMesh(mesh);
+}
+
+std::vector<Component::Mesh> GenerateLODs(const Component::Mesh &mesh, std::size_t levelCount, float reduction)
+{
+    std::vector<Component::Mesh> levels;
+    levels.reserve(levelCount);
+    const Component::Mesh *previous = &mesh;
+    for (std::size_t level = 0; level < levelCount; level++)
+    {
+        Component::Mesh simplified = SimplifyMesh(*previous, reduction);
+        if (simplified.indices.empty() || simplified.indices.size() >= previous->indices.size())
+        {
+            break;
+        }
+        levels.push_back(std::move(simplified));
+        previous = &levels.back();
+    }
+    return levels;
+}
+} // namespace ES::Plugin::Object::Utils
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Mesh.hpp"
+
+namespace ES::Plugin::Object::Utils {
+/**
+ * @brief Simplify a mesh by quadric edge collapse.
+ *
+ * Every vertex accumulates the quadric error of the planes of its triangles. Edges are collapsed, cheapest first,
+ * into the endpoint whose position minimizes that error, so the kept vertices keep their normal and texture
+ * coordinates. Collapses that would flip a triangle or make the mesh non manifold are skipped. Vertices on a border
+ * of the mesh, including the seams where vertices are split by their normal or texture coordinates, never move, so
+ * that the simplified mesh doesn't open holes.
+ *
+ * @param mesh Mesh to simplify, made of indexed triangles.
+ * @param ratio Fraction of the triangles of the mesh to keep, in [0, 1].
+ * @return The simplified mesh. It has more triangles than asked if no more edges could be collapsed.
+ */
+Component::Mesh SimplifyMesh(const Component::Mesh &mesh, float ratio);
+
+/**
+ * @brief Generate the levels of detail of a mesh, each simplifying the previous one.
+ *
+ * @param mesh Full resolution mesh, which is not part of the result.
+ * @param levelCount Number of levels to generate.
+ * @param reduction Fraction of the triangles of a level kept by the next one.
+ * @return The levels, from the most to the least detailed. There are less than levelCount of them if the mesh
+ * can't be simplified further.
+ *
+ * @see SimplifyMesh
+ */
+std::vector<Component::Mesh> GenerateLODs(const Component::Mesh &mesh, std::size_t levelCount,
+                                          float reduction = 0.5f);
+} // namespace ES::Plugin::Object::Utils
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <tuple>
+
+#include "Mesh.hpp"
+#include "MeshSimplification.hpp"
+
+using namespace ES::Plugin::Object;
+
+/**
+ * @brief Flat square of size x size quads, each split in two triangles, with normals and texture coordinates.
+ */
+static Component::Mesh CreateGrid(uint32_t size)
+{
+    Component::Mesh mesh;
+    for (uint32_t z = 0; z <= size; z++)
+    {
+        for (uint32_t x = 0; x <= size; x++)
+        {
+            mesh.vertices.emplace_back(static_cast<float>(x), 0.0f, static_cast<float>(z));
+            mesh.normals.emplace_back(0.0f, 1.0f, 0.0f);
+            mesh.texCoords.emplace_back(static_cast<float>(x) / size, static_cast<float>(z) / size);
+        }
+    }
+    for (uint32_t z = 0; z < size; z++)
+    {
+        for (uint32_t x = 0; x < size; x++)
+        {
+            uint32_t corner = z * (size + 1) + x;
+            mesh.indices.insert(mesh.indices.end(), {corner, corner + size + 1, corner + 1, corner + 1,
+                                                     corner + size + 1, corner + size + 2});
+        }
+    }
+    return mesh;
+}
+
+/**
+ * @brief Closed cube whose faces are size x size grids, sharing the vertices of their edges.
+ */
+static Component::Mesh CreateCube(uint32_t size)
+{
+    Component::Mesh mesh;
+    std::map<std::tuple<int, int, int>, uint32_t> vertices;
+    auto vertex = [&](int x, int y, int z) {
+        auto [it, inserted] = vertices.try_emplace({x, y, z}, static_cast<uint32_t>(mesh.vertices.size()));
+        if (inserted)
+            mesh.vertices.emplace_back(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+        return it->second;
+    };
+
+    int n = static_cast<int>(size);
+    // Axes of each face, ordered so that the triangles face outward
+    const int faces[6][3][3] = {
+        {{0, 0, 0}, {0, 1, 0}, {1, 0, 0}},
+        {{0, 0, n}, {1, 0, 0}, {0, 1, 0}},
+        {{0, 0, 0}, {0, 0, 1}, {0, 1, 0}},
+        {{n, 0, 0}, {0, 1, 0}, {0, 0, 1}},
+        {{0, 0, 0}, {1, 0, 0}, {0, 0, 1}},
+        {{0, n, 0}, {0, 0, 1}, {1, 0, 0}},
+    };
+    for (const auto &face : faces)
+    {
+        auto at = [&](int u, int v) {
+            return vertex(face[0][0] + u * face[1][0] + v * face[2][0], face[0][1] + u * face[1][1] + v * face[2][1],
+                          face[0][2] + u * face[1][2] + v * face[2][2]);
+        };
+        for (int v = 0; v < n; v++)
+        {
+            for (int u = 0; u < n; u++)
+            {
+                uint32_t a = at(u, v);
+                uint32_t b = at(u + 1, v);
+                uint32_t c = at(u + 1, v + 1);
+                uint32_t d = at(u, v + 1);
+                mesh.indices.insert(mesh.indices.end(), {a, b, c, a, c, d});
+            }
+        }
+    }
+    return mesh;
+}
+
+static void ExpectValidIndices(const Component::Mesh &mesh)
+{
+    ASSERT_EQ(mesh.indices.size() % 3, 0);
+    for (uint32_t index : mesh.indices)
+    {
+        ASSERT_LT(index, mesh.vertices.size());
+    }
+}
+
+TEST(MeshSimplification, reduces_flat_grid)
+{
+    Component::Mesh grid = CreateGrid(16);
+
+    Component::Mesh simplified = Utils::SimplifyMesh(grid, 0.5f);
+
+    ExpectValidIndices(simplified);
+    EXPECT_LE(simplified.indices.size(), grid.indices.size() / 2);
+    EXPECT_FALSE(simplified.indices.empty());
+    EXPECT_EQ(simplified.normals.size(), simplified.vertices.size());
+    EXPECT_EQ(simplified.texCoords.size(), simplified.vertices.size());
+
+    // The border is locked and the surface stays flat
+    std::size_t borderVertices = 0;
+    for (const auto &vertex : simplified.vertices)
+    {
+        EXPECT_FLOAT_EQ(vertex.y, 0.0f);
+        if (vertex.x == 0.0f || vertex.x == 16.0f || vertex.z == 0.0f || vertex.z == 16.0f)
+            borderVertices++;
+    }
+    EXPECT_EQ(borderVertices, 16 * 4);
+}
+
+TEST(MeshSimplification, keeps_closed_mesh_closed)
+{
+    Component::Mesh cube = CreateCube(8);
+
+    Component::Mesh simplified = Utils::SimplifyMesh(cube, 0.25f);
+
+    ExpectValidIndices(simplified);
+    EXPECT_LE(simplified.indices.size(), cube.indices.size() / 4);
+
+    // Every edge is still shared by exactly two triangles
+    std::map<std::pair<uint32_t, uint32_t>, int> edges;
+    for (std::size_t i = 0; i < simplified.indices.size(); i += 3)
+    {
+        for (std::size_t corner = 0; corner < 3; corner++)
+        {
+            uint32_t a = simplified.indices[i + corner];
+            uint32_t b = simplified.indices[i + (corner + 1) % 3];
+            edges[{std::min(a, b), std::max(a, b)}]++;
+        }
+    }
+    for (const auto &[edge, uses] : edges)
+    {
+        EXPECT_EQ(uses, 2);
+    }
+}
+
+TEST(MeshSimplification, generates_decreasing_levels)
+{
+    Component::Mesh cube = CreateCube(8);
+
+    std::vector<Component::Mesh> levels = Utils::GenerateLODs(cube, 3);
+
+    ASSERT_EQ(levels.size(), 3);
+    std::size_t previous = cube.indices.size();
+    for (const auto &level : levels)
+    {
+        ExpectValidIndices(level);
+        EXPECT_LT(level.indices.size(), previous);
+        previous = level.indices.size();
+    }
+}
+
+TEST(MeshSimplification, stops_when_nothing_can_collapse)
+{
+    Component::Mesh triangle;
+    triangle.vertices = {glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f)};
+    triangle.indices = {0, 1, 2};
+
+    Component::Mesh simplified = Utils::SimplifyMesh(triangle, 0.1f);
+
+    EXPECT_EQ(simplified.indices.size(), 3);
+    EXPECT_EQ(simplified.vertices.size(), 3);
+    EXPECT_TRUE(Utils::GenerateLODs(triangle, 2).empty());
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Core.hpp"
+#include "Entity.hpp"
+#include "ThreadPool.hpp"
+#include "Transform.hpp"
+#include "WorldMatrix.hpp"
+#include "WorldMatrixSystems.hpp"
+
+using namespace ES::Plugin::Object;
+
+static void ExpectNear(const glm::mat4 &a, const glm::mat4 &b)
+{
+    for (int column = 0; column < 4; column++)
+        for (int row = 0; row < 4; row++)
+            EXPECT_NEAR(a[column][row], b[column][row], 1e-5f);
+}
+
+static void ExpectNear(const glm::mat3 &a, const glm::mat3 &b)
+{
+    for (int column = 0; column < 3; column++)
+        for (int row = 0; row < 3; row++)
+            EXPECT_NEAR(a[column][row], b[column][row], 1e-5f);
+}
+
+TEST(WorldMatrix, matches_transform)
+{
+    ES::Engine::Core core;
+    ES::Engine::Entity entity = core.CreateEntity();
+    auto &transform =
+        entity.AddComponent<Component::Transform>(core, glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(2.0f, 0.5f, 4.0f),
+                                                  glm::angleAxis(0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))));
+
+    System::UpdateWorldMatrices(core);
+
+    auto *worldMatrix = entity.TryGetComponent<Component::WorldMatrix>(core);
+    ASSERT_NE(worldMatrix, nullptr);
+    glm::mat4 model = transform.getTransformationMatrix();
+    ExpectNear(worldMatrix->model, model);
+    ExpectNear(worldMatrix->normal, glm::mat3(glm::transpose(glm::inverse(model))));
+}
+
+TEST(WorldMatrix, recomputed_when_transform_changes)
+{
+    ES::Engine::Core core;
+    ES::Engine::Entity entity = core.CreateEntity();
+    auto &transform = entity.AddComponent<Component::Transform>(core);
+
+    System::UpdateWorldMatrices(core);
+    ExpectNear(entity.GetComponents<Component::WorldMatrix>(core).model, glm::mat4(1.0f));
+
+    transform.setPosition(4.0f, 5.0f, 6.0f);
+    transform.setScale(3.0f, 3.0f, 3.0f);
+    System::UpdateWorldMatrices(core);
+    ExpectNear(entity.GetComponents<Component::WorldMatrix>(core).model, transform.getTransformationMatrix());
+}
+
+static void ExpectManyEntitiesMatch(ES::Engine::Core &core)
+{
+    std::vector<ES::Engine::Entity> entities;
+    for (int i = 0; i < 10000; i++)
+    {
+        ES::Engine::Entity entity = core.CreateEntity();
+        entity.AddComponent<Component::Transform>(core, glm::vec3(static_cast<float>(i), 0.0f, 0.0f),
+                                                  glm::vec3(1.0f + static_cast<float>(i % 7)),
+                                                  glm::angleAxis(static_cast<float>(i), glm::vec3(0.0f, 1.0f, 0.0f)));
+        entities.push_back(entity);
+    }
+
+    System::UpdateWorldMatrices(core);
+
+    for (auto entity : entities)
+    {
+        ExpectNear(entity.GetComponents<Component::WorldMatrix>(core).model,
+                   entity.GetComponents<Component::Transform>(core).getTransformationMatrix());
+    }
+}
+
+TEST(WorldMatrix, many_entities)
+{
+    ES::Engine::Core core;
+    ExpectManyEntitiesMatch(core);
+}
+
+TEST(WorldMatrix, many_entities_on_thread_pool)
+{
+    ES::Engine::Core core;
+    core.RegisterResource<ES::Utils::ThreadPool>(ES::Utils::ThreadPool(4));
+    ExpectManyEntitiesMatch(core);
+}
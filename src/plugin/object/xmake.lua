@@ -3,6 +3,7 @@ add_requires("entt", "gtest", "glm", "tinyobjloader", "spdlog", "fmt")
 
 includes("../../engine/xmake.lua")
 includes("../../utils/log/xmake.lua")
+includes("../../utils/thread-pool/xmake.lua")
 
 target("PluginObject")
     set_kind("static")
@@ -13,11 +14,13 @@ target("PluginObject")
 
     add_deps("EngineSquaredCore")
     add_deps("UtilsLog")
+    add_deps("UtilsThreadPool", {public = true})
 
     add_headerfiles("src/**.hpp", { public = true })
     add_includedirs("src/", {public = true})
     add_includedirs("src/component", {public = true})
     add_includedirs("src/resource", {public = true})
+    add_includedirs("src/system", {public = true})
     add_includedirs("src/exception", {public = true})
     add_includedirs("src/utils", {public = true})
 
@@ -1,35 +1,63 @@
 #pragma once
 
 #include "component/FontHandle.hpp"
+#include "component/GLMeshBufferDirty.hpp"
+#include "component/Light.hpp"
 #include "component/MaterialHandle.hpp"
+#include "component/MeshLOD.hpp"
 #include "component/ModelHandle.hpp"
 #include "component/ShaderHandle.hpp"
 #include "component/Sprite.hpp"
-#include "component/SpriteHandle.hpp"
 #include "component/Text.hpp"
 #include "component/TextHandle.hpp"
 #include "component/TextureHandle.hpp"
+#include "component/WorldBounds.hpp"
 
 #include "plugin/PluginOpenGL.hpp"
 
 #include "resource/FontManager.hpp"
 #include "resource/GLMeshBufferManager.hpp"
 #include "resource/GLTextBufferManager.hpp"
+#include "resource/LightClusters.hpp"
 #include "resource/MaterialCache.hpp"
+#include "resource/MeshCulling.hpp"
+#include "resource/MeshLODGenerator.hpp"
+#include "resource/RenderQueue.hpp"
+#include "resource/ShaderBinaryCache.hpp"
 #include "resource/ShaderManager.hpp"
+#include "resource/SpriteAtlas.hpp"
+#include "resource/SpriteBatcher.hpp"
+#include "resource/TextureLoader.hpp"
 #include "resource/TextureManager.hpp"
+#include "resource/UniformBuffers.hpp"
 
 #include "system/BufferSystems.hpp"
+#include "system/CullingSystems.hpp"
+#include "system/LightSystems.hpp"
 #include "system/ManagerSystems.hpp"
+#include "system/MeshLODSystems.hpp"
 #include "system/RenderSystems.hpp"
 #include "system/ShaderSystems.hpp"
+#include "system/TextureSystems.hpp"
 #include "system/WindowSystems.hpp"
 
+#include "utils/BoundingBox.hpp"
+#include "utils/BoundingVolumeHierarchy.hpp"
 #include "utils/Font.hpp"
+#include "utils/Frustum.hpp"
 #include "utils/GLMeshBuffer.hpp"
 #include "utils/GLTextBuffer.hpp"
+#include "utils/InstanceData.hpp"
+#include "utils/LightClusterGrid.hpp"
+#include "utils/LightInfo.hpp"
 #include "utils/Loader.hpp"
 #include "utils/Material.hpp"
 #include "utils/MouseDragging.hpp"
+#include "utils/ProgramBinaryCache.hpp"
+#include "utils/StorageBuffer.hpp"
 #include "utils/Texture.hpp"
+#include "utils/TextureImage.hpp"
+#include "utils/Uniform.hpp"
+#include "utils/UniformBlocks.hpp"
+#include "utils/UniformBuffer.hpp"
 #include "utils/Viewer.hpp"
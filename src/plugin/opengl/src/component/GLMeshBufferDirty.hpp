@@ -0,0 +1,17 @@
+#pragma once
+
+namespace ES::Plugin::OpenGL::Component {
+/**
+ * GLMeshBufferDirty component
+ * Tag added to the entities whose Mesh or ModelHandle changed since their GLMeshBuffer was last uploaded.
+ * It is added by the observers connected in TrackGLMeshBufferChanges, and removed once the buffer is uploaded.
+ *
+ * A Mesh edited in place must be patched for the change to reach the GPU:
+ * @code
+ * core.GetRegistry().patch<ES::Plugin::Object::Component::Mesh>(entity, [](auto &mesh) {
+ *     mesh.vertices[0].y += 1.0f;
+ * });
+ * @endcode
+ */
+struct GLMeshBufferDirty {};
+} // namespace ES::Plugin::OpenGL::Component
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace ES::Plugin::OpenGL::Component {
+/**
+ * Component of an entity lighting the scene. The light is placed by the Transform of the entity.
+ *
+ * A point light only reaches what is closer than its radius, and fades out toward it, so that only the clusters of
+ * the view it touches evaluate it, see Resource::LightClusters. A directional light reaches the whole scene from the
+ * direction of the position of its entity, as if it was infinitely far along it.
+ *
+ * @example "Adding a point light"
+ * @code
+ * ES::Engine::Entity light = core.CreateEntity();
+ * light.AddComponent<ES::Plugin::Object::Component::Transform>(core, glm::vec3(0.0f, 2.0f, 0.0f));
+ * light.AddComponent<ES::Plugin::OpenGL::Component::Light>(core, ES::Plugin::OpenGL::Component::Light::Type::Point,
+ *                                                          glm::vec3(1.0f, 0.8f, 0.6f), 5.0f);
+ * @endcode
+ */
+struct Light {
+    enum class Type : uint8_t {
+        Point,
+        Directional
+    };
+
+    Type type = Type::Point;
+    glm::vec3 intensity = glm::vec3(1.0f);
+    /// @brief Distance beyond which a point light has no effect. Unused by directional lights.
+    float radius = 10.0f;
+};
+} // namespace ES::Plugin::OpenGL::Component
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace ES::Plugin::OpenGL::Component {
+/**
+ * Component drawing a mesh with less triangles as it gets smaller on screen.
+ *
+ * The levels of detail of a model are generated from its Mesh by the GenerateMeshLODs system, on the ThreadPool,
+ * the first time an entity with the model and this component is seen, and stored in the GLMeshBufferManager next to
+ * the full mesh. The full mesh is drawn until they are ready. Entities with the same model, level count and
+ * reduction share their levels. They are not generated again when the Mesh changes, so this component suits static
+ * meshes. Every frame, the SelectMeshLODs system picks the level of the visible entities from the fraction of the
+ * screen height they cover.
+ *
+ * @example "Drawing a mesh with levels of detail"
+ * @code
+ * entity.AddComponent<ES::Plugin::OpenGL::Component::ModelHandle>(core, "rock");
+ * entity.AddComponent<ES::Plugin::OpenGL::Component::MeshLOD>(core);
+ * @endcode
+ */
+struct MeshLOD {
+    /// @brief Number of simplified levels generated after the full mesh.
+    uint8_t levelCount = 3;
+    /// @brief Fraction of the triangles of a level kept by the next one.
+    float reduction = 0.5f;
+    /// @brief Fraction of the screen height below which the first simplified level is drawn. Every following level
+    /// is drawn below half the size of the previous one.
+    float screenSize = 0.25f;
+
+    /// @brief Level drawn this frame, 0 being the full mesh.
+    uint8_t current = 0;
+    /// @brief Ids of the mesh buffers of the levels, the full mesh first. Empty until the levels are generated. Their
+    /// names are owned by the MeshLODGenerator.
+    std::vector<entt::hashed_string> models;
+};
+} // namespace ES::Plugin::OpenGL::Component
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "BoundingBox.hpp"
+
+namespace ES::Plugin::OpenGL::Component {
+/**
+ * WorldBounds component
+ * Caches the bounds of the mesh of an entity in world space, next to its WorldMatrix.
+ * It is added by the CullMeshes system to the entities it culls, and only recomputed when their world matrix or the
+ * bounds of their mesh buffer changed since the last frame.
+ */
+struct WorldBounds {
+    Utils::BoundingBox box;
+
+    /// @brief World matrix the box was computed from.
+    glm::mat4 model = glm::mat4(1.0f);
+    /// @brief Bounds of the mesh buffer the box was computed from.
+    Utils::BoundingBox meshBounds;
+};
+} // namespace ES::Plugin::OpenGL::Component
@@ -1,7 +1,10 @@
 #include "Input.hpp"
+#include "Object.hpp"
 #include "OpenGL.hpp"
 #include "PluginWindow.hpp"
+#include "Relationship.hpp"
 #include "RenderingPipeline.hpp"
+#include "Shutdown.hpp"
 #include "Startup.hpp"
 #include "Update.hpp"
 
@@ -13,23 +16,35 @@ void ES::Plugin::OpenGL::Plugin::Bind()
                                                          ES::Plugin::OpenGL::System::CheckGLEWVersion);
 
     RegisterSystems<ES::Plugin::RenderingPipeline::Setup>(
-        ES::Plugin::OpenGL::System::SetupResizeViewport, ES::Plugin::OpenGL::System::LoadFontManager,
+        ES::Plugin::OpenGL::System::SetupResizeViewport, ES::Plugin::OpenGL::System::CreateThreadPool,
+        ES::Plugin::OpenGL::System::LoadFontManager,
         ES::Plugin::OpenGL::System::LoadMaterialCache, ES::Plugin::OpenGL::System::LoadShaderManager,
-        ES::Plugin::OpenGL::System::LoadDefaultShader, ES::Plugin::OpenGL::System::LoadDefaultTextShader,
-        ES::Plugin::OpenGL::System::LoadDefaultSpriteShader, ES::Plugin::OpenGL::System::LoadTextureManager,
-        ES::Plugin::OpenGL::System::CreateCamera, ES::Plugin::OpenGL::System::SetupShaderUniforms,
-        ES::Plugin::OpenGL::System::SetupTextShaderUniforms, ES::Plugin::OpenGL::System::SetupSpriteShaderUniforms,
-        ES::Plugin::OpenGL::System::LoadGLMeshBufferManager, ES::Plugin::OpenGL::System::LoadGLTextBufferManager,
-        ES::Plugin::OpenGL::System::LoadGLSpriteBufferManager, ES::Plugin::OpenGL::System::SetupMouseDragging);
+        ES::Plugin::OpenGL::System::CreateShaderBinaryCache, ES::Plugin::OpenGL::System::LoadDefaultShader,
+        ES::Plugin::OpenGL::System::LoadDefaultTextShader, ES::Plugin::OpenGL::System::LoadDefaultSpriteShader,
+        ES::Plugin::OpenGL::System::LoadTextureManager, ES::Plugin::OpenGL::System::CreateCamera,
+        ES::Plugin::OpenGL::System::CreateRenderQueue,
+        ES::Plugin::OpenGL::System::CreateUniformBuffers, ES::Plugin::OpenGL::System::CreateLightClusters,
+        ES::Plugin::OpenGL::System::CreateDefaultLights, ES::Plugin::OpenGL::System::SetupTextShaderUniforms,
+        ES::Plugin::OpenGL::System::SetupSpriteShaderUniforms, ES::Plugin::OpenGL::System::LoadGLMeshBufferManager,
+        ES::Plugin::OpenGL::System::TrackGLMeshBufferChanges, ES::Plugin::OpenGL::System::LoadGLTextBufferManager,
+        ES::Plugin::OpenGL::System::SetupMouseDragging,
+        ES::Plugin::OpenGL::System::CreateMeshCulling, ES::Plugin::OpenGL::System::CreateSpriteBatcher,
+        ES::Plugin::Relationship::System::CreateTransformHierarchy, ES::Plugin::OpenGL::System::CreateTextureLoader,
+        ES::Plugin::OpenGL::System::CreateMeshLODGenerator);
 
     RegisterSystems<ES::Plugin::RenderingPipeline::RenderSetup>(
         ES::Plugin::OpenGL::System::GLClearColor, ES::Plugin::OpenGL::System::GLClearDepth,
         ES::Plugin::OpenGL::System::GLEnableDepth, ES::Plugin::OpenGL::System::GLEnableCullFace,
-        ES::Plugin::OpenGL::System::UpdateMatrices, ES::Plugin::OpenGL::System::SetupCamera,
-        ES::Plugin::OpenGL::System::SetupLights, ES::Plugin::OpenGL::System::LoadGLMeshBuffer,
-        ES::Plugin::OpenGL::System::LoadGLTextBuffer, ES::Plugin::OpenGL::System::LoadGLSpriteBuffer);
+        ES::Plugin::OpenGL::System::UploadTextures, ES::Plugin::OpenGL::System::UpdateMatrices,
+        ES::Plugin::OpenGL::System::SetupCamera, ES::Plugin::Object::System::UpdateWorldMatrices,
+        ES::Plugin::Relationship::System::PropagateTransforms, ES::Plugin::OpenGL::System::UpdateLightClusters,
+        ES::Plugin::OpenGL::System::LoadGLMeshBuffer, ES::Plugin::OpenGL::System::GenerateMeshLODs,
+        ES::Plugin::OpenGL::System::LoadGLTextBuffer, ES::Plugin::OpenGL::System::CullMeshes,
+        ES::Plugin::OpenGL::System::SelectMeshLODs);
 
     RegisterSystems<ES::Plugin::RenderingPipeline::ToGPU>(ES::Plugin::OpenGL::System::RenderMeshes,
                                                           ES::Plugin::OpenGL::System::RenderText,
                                                           ES::Plugin::OpenGL::System::RenderSprites);
+
+    RegisterSystems<ES::Engine::Scheduler::Shutdown>(ES::Plugin::OpenGL::System::DestroyRenderResources);
 }
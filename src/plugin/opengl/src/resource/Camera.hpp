@@ -12,6 +12,9 @@ class Camera {
         : size(w, h), viewer(glm::vec3(5, 5, 5), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0), 45.0f, (float) w / h){};
     glm::vec2 size;
     float aspect;
+    /// @brief Distances of the near and far planes of the projection.
+    float zNear = 0.1f;
+    float zFar = 100.0f;
     Utils::Viewer viewer;
     glm::mat4 view;
     glm::mat4 projection;
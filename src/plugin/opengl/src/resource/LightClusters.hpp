@@ -0,0 +1,52 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "LightInfo.hpp"
+#include "LightClusterGrid.hpp"
+#include "StorageBuffer.hpp"
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * LightClusters is a resource holding the lights of the scene as read by the shaders.
+ *
+ * Every frame, the Light components are gathered, directional lights first, and the point lights are assigned to
+ * the clusters of the view frustum they reach. The lights and the lists of lights of every cluster are uploaded to
+ * storage buffers, so that a fragment only evaluates the directional lights and the point lights of its cluster:
+ *
+ * @code
+ * layout (std430, binding = 0) readonly buffer LightBuffer { LightInfo Lights[]; };
+ * layout (std430, binding = 1) readonly buffer ClusterBuffer { uvec2 Clusters[]; }; // offset and count
+ * layout (std430, binding = 2) readonly buffer LightIndexBuffer { uint LightIndices[]; };
+ * @endcode
+ *
+ * The lights of a cluster are indices in the point lights, which are after the directional lights in LightBuffer.
+ *
+ * @see System::UpdateLightClusters, Utils::LightClusterGrid, Utils::LightBlock
+ */
+struct LightClusters {
+    static constexpr GLuint LIGHT_BINDING = 0;
+    static constexpr GLuint CLUSTER_BINDING = 1;
+    static constexpr GLuint LIGHT_INDEX_BINDING = 2;
+
+    Utils::LightClusterGrid grid;
+
+    /// @brief Light reaching every fragment, whatever its lights.
+    glm::vec3 ambient = glm::vec3(0.1f);
+
+    Utils::StorageBuffer lightBuffer;
+    Utils::StorageBuffer clusterBuffer;
+    Utils::StorageBuffer lightIndexBuffer;
+
+    /// @brief Lights of the frame, directional lights first.
+    std::vector<Utils::LightInfo> lights;
+    /// @brief Number of directional lights at the start of lights.
+    uint32_t directionalCount = 0;
+    /// @brief Point lights of the frame in view space, given to the grid. Kept across frames so its memory is reused.
+    std::vector<glm::vec4> viewLights;
+};
+} // namespace ES::Plugin::OpenGL::Resource
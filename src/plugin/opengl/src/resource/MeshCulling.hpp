@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <vector>
+
+#include "BoundingBox.hpp"
+#include "BoundingVolumeHierarchy.hpp"
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * MeshCulling is a resource holding the meshes visible from the camera during a frame.
+ *
+ * Every frame, the world bounds of the meshes that moved are computed from the bounds of their mesh buffer and their
+ * world matrix, and cached in their WorldBounds component. Meshes without vertices are skipped. The bounding volume
+ * hierarchy is refitted to the bounds, or rebuilt if meshes were added or removed, then culled against the camera
+ * frustum. Only the visible meshes are submitted to the RenderQueue.
+ *
+ * @see System::CullMeshes
+ */
+struct MeshCulling {
+    /// @brief Set to false to draw every mesh, visible or not.
+    bool enabled = true;
+
+    Utils::BoundingVolumeHierarchy bvh;
+
+    /// @brief Entities of the meshes in the hierarchy, in the order their bounds were given to it.
+    std::vector<entt::entity> entities;
+    /// @brief World bounds of the meshes, in the same order as entities.
+    std::vector<Utils::BoundingBox> worldBounds;
+
+    /// @brief Entities of the meshes visible this frame.
+    std::vector<entt::entity> visible;
+
+    /// @brief Scratch buffers, kept across frames so their memory is reused.
+    std::vector<entt::entity> frameEntities;
+    std::vector<uint32_t> visibleIndices;
+};
+} // namespace ES::Plugin::OpenGL::Resource
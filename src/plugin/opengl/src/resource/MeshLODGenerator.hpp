@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <functional>
+#include <future>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Object.hpp"
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * @brief Model and settings the levels of detail of a MeshLOD are generated from. Entities with the same key share
+ * their levels.
+ */
+struct MeshLODKey {
+    entt::id_type model = 0;
+    uint8_t levelCount = 0;
+    float reduction = 0.0f;
+
+    bool operator==(const MeshLODKey &) const = default;
+};
+
+struct MeshLODKeyHash {
+    std::size_t operator()(const MeshLODKey &key) const
+    {
+        std::size_t hash = std::hash<entt::id_type>{}(key.model);
+        hash ^= std::hash<uint8_t>{}(key.levelCount) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<float>{}(key.reduction) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+/**
+ * MeshLODGenerator is a resource holding the levels of detail generated by the GenerateMeshLODs system.
+ *
+ * Models are simplified by the threads of the shared ThreadPool, at most one job per thread. Their results are polled every frame without waiting, and the levels are
+ * uploaded once they are ready, so a slow simplification doesn't stall the frame. Until then, entities are drawn
+ * with their full mesh.
+ *
+ * @see System::GenerateMeshLODs
+ */
+struct MeshLODGenerator {
+    /// @brief Ids of the mesh buffers of the levels of a key, the full mesh first, and the names they are hashed from.
+    struct Levels {
+        std::vector<std::string> names;
+        /// @brief Point to names, which are not changed once the levels are generated.
+        std::vector<entt::hashed_string> ids;
+    };
+
+    /// @brief Simplification running on a worker thread.
+    struct Job {
+        MeshLODKey key;
+        std::string model;
+        std::future<std::vector<ES::Plugin::Object::Component::Mesh>> levels;
+    };
+
+    /// @brief Keys whose levels were generated or are being generated, so they are only generated once.
+    std::unordered_set<MeshLODKey, MeshLODKeyHash> attempted;
+    /// @brief Levels generated for every key.
+    std::unordered_map<MeshLODKey, Levels, MeshLODKeyHash> levels;
+    std::vector<Job> jobs;
+};
+} // namespace ES::Plugin::OpenGL::Resource
@@ -0,0 +1,104 @@
+#include "RenderQueue.hpp"
+
+#include <algorithm>
+
+namespace ES::Plugin::OpenGL::Resource {
+void RenderQueue::Clear()
+{
+    _items.clear();
+    _instances.clear();
+    _keys.clear();
+    _batches.clear();
+    _sortedInstances.clear();
+    _shaderIndices.clear();
+    _materialIndices.clear();
+    _textureIndices.clear();
+    _modelIndices.clear();
+}
+
+uint16_t RenderQueue::GetIndex(std::unordered_map<entt::id_type, uint16_t> &indices, entt::id_type id)
+{
+    // Past MAX_INDEX distinct ids, the extra ones share the last index: they are still drawn, only less sorted
+    std::size_t index = std::min<std::size_t>(indices.size(), MAX_INDEX);
+    auto [it, inserted] = indices.try_emplace(id, static_cast<uint16_t>(index));
+    return it->second;
+}
+
+bool RenderQueue::IsSameBatch(const Item &a, const Item &b)
+{
+    return a.shader.value() == b.shader.value() && a.material.value() == b.material.value() &&
+           a.hasTexture == b.hasTexture && (!a.hasTexture || a.texture.value() == b.texture.value()) &&
+           a.model.value() == b.model.value();
+}
+
+void RenderQueue::Submit(const entt::hashed_string &shader, const entt::hashed_string &material,
+                         const entt::hashed_string &texture, bool hasTexture, const entt::hashed_string &model,
+                         const glm::mat4 &modelMatrix, const glm::mat3 &normalMatrix)
+{
+    uint64_t key = (static_cast<uint64_t>(GetIndex(_shaderIndices, shader.value())) << 48) |
+                   (static_cast<uint64_t>(GetIndex(_materialIndices, material.value())) << 32) |
+                   (static_cast<uint64_t>(hasTexture ? GetIndex(_textureIndices, texture.value()) + 1 : 0) << 16) |
+                   static_cast<uint64_t>(GetIndex(_modelIndices, model.value()));
+
+    _keys.emplace_back(key, static_cast<uint32_t>(_items.size()));
+    _items.push_back(Item{shader, material, texture, hasTexture, model});
+    _instances.push_back(Utils::InstanceData{modelMatrix, normalMatrix});
+}
+
+void RenderQueue::Sort()
+{
+    std::ranges::sort(_keys);
+    _batches.clear();
+
+    _sortedInstances.resize(_keys.size());
+    for (std::size_t i = 0; i < _keys.size(); i++)
+    {
+        const auto &[key, index] = _keys[i];
+        _sortedInstances[i] = _instances[index];
+
+        // Items with the same key share their shader, material, texture and mesh, unless their indices saturated
+        const Item &item = _items[index];
+        if (i == 0 || _keys[i - 1].first != key || !IsSameBatch(_items[_keys[i - 1].second], item))
+        {
+            _batches.push_back(RenderBatch{item.shader, item.material, item.texture, item.hasTexture, item.model,
+                                           static_cast<GLuint>(i), 0});
+        }
+        _batches.back().instanceCount++;
+    }
+}
+
+void RenderQueue::Build()
+{
+    Sort();
+    if (_sortedInstances.empty())
+    {
+        return;
+    }
+
+    if (_instanceBuffer == 0)
+    {
+        glGenBuffers(1, &_instanceBuffer);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+    std::size_t size = _sortedInstances.size() * sizeof(Utils::InstanceData);
+    if (size > _instanceBufferCapacity)
+    {
+        // Grow by half again, so a slowly growing scene does not reallocate every frame
+        _instanceBufferCapacity = std::max(size, _instanceBufferCapacity + _instanceBufferCapacity / 2);
+    }
+    // Orphan the previous storage, so the driver does not wait for the last frame to finish reading it
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(_instanceBufferCapacity), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(size), _sortedInstances.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void RenderQueue::Destroy()
+{
+    if (_instanceBuffer != 0)
+    {
+        glDeleteBuffers(1, &_instanceBuffer);
+    }
+    _instanceBuffer = 0;
+    _instanceBufferCapacity = 0;
+}
+} // namespace ES::Plugin::OpenGL::Resource
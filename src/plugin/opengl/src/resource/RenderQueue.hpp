@@ -0,0 +1,134 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "InstanceData.hpp"
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * @brief Instances of a mesh sharing the same shader, material and texture, drawn by a single instanced draw.
+ */
+struct RenderBatch {
+    entt::hashed_string shader;
+    entt::hashed_string material;
+    entt::hashed_string texture;
+    bool hasTexture = false;
+    entt::hashed_string model;
+
+    /// @brief Index of the first instance of the batch in the instance buffer.
+    GLuint firstInstance = 0;
+    /// @brief Number of instances of the batch.
+    GLsizei instanceCount = 0;
+};
+
+/**
+ * RenderQueue is a resource collecting the meshes to draw during a frame.
+ *
+ * Submitted meshes are sorted by a 64 bits key made of their shader, material, texture and mesh, in that order of
+ * priority, so that state changes are minimized. Meshes sharing all four are grouped into a batch, and the data of
+ * every instance is uploaded into a single instance buffer, in batch order.
+ *
+ * @see InstanceData for the attributes a shader must declare to be drawn with instancing.
+ */
+class RenderQueue {
+  public:
+    RenderQueue() = default;
+    ~RenderQueue() = default;
+
+    RenderQueue(const RenderQueue &) = delete;
+    RenderQueue &operator=(const RenderQueue &) = delete;
+    RenderQueue(RenderQueue &&) = default;
+    RenderQueue &operator=(RenderQueue &&) = default;
+
+    /**
+     * @brief Remove every submitted mesh. Memory is kept for the next frame.
+     */
+    void Clear();
+
+    /**
+     * @brief Submit a mesh to draw.
+     *
+     * @param shader Id of the shader program.
+     * @param material Id of the material.
+     * @param texture Id of the texture, ignored if hasTexture is false.
+     * @param hasTexture Whether the mesh is textured.
+     * @param model Id of the mesh buffer.
+     * @param modelMatrix Model matrix of the instance.
+     * @param normalMatrix Normal matrix of the instance, the inverse transpose of its model matrix.
+     */
+    void Submit(const entt::hashed_string &shader, const entt::hashed_string &material,
+                const entt::hashed_string &texture, bool hasTexture, const entt::hashed_string &model,
+                const glm::mat4 &modelMatrix, const glm::mat3 &normalMatrix);
+
+    /**
+     * @brief Sort the submitted meshes into batches, without uploading them.
+     * Called by Build, it does not need an OpenGL context.
+     */
+    void Sort();
+
+    /**
+     * @brief Sort the submitted meshes into batches and upload the instance buffer.
+     * Must be called with an OpenGL context, after the last Submit of the frame.
+     */
+    void Build();
+
+    inline const std::vector<RenderBatch> &GetBatches() const { return _batches; }
+
+    /**
+     * @brief Get the data of the instances, in batch order once the queue is built.
+     */
+    inline const std::vector<Utils::InstanceData> &GetInstances() const { return _sortedInstances; }
+
+    inline GLuint GetInstanceBuffer() const { return _instanceBuffer; }
+
+    inline std::size_t Size() const { return _items.size(); }
+
+    /**
+     * @brief Delete the instance buffer.
+     */
+    void Destroy();
+
+    /// @brief Largest index of an id in the sort key. The top 16 bits value is reserved, so the texture index,
+    /// offset by one for untextured meshes, can't overflow into the material bits.
+    inline static constexpr uint16_t MAX_INDEX = std::numeric_limits<uint16_t>::max() - 1;
+
+  private:
+    struct Item {
+        entt::hashed_string shader;
+        entt::hashed_string material;
+        entt::hashed_string texture;
+        bool hasTexture;
+        entt::hashed_string model;
+    };
+
+    /**
+     * @brief Get the dense index of an id in a frame, so that it fits in its 16 bits of the sort key.
+     */
+    static uint16_t GetIndex(std::unordered_map<entt::id_type, uint16_t> &indices, entt::id_type id);
+
+    static bool IsSameBatch(const Item &a, const Item &b);
+
+    std::vector<Item> _items;
+    std::vector<Utils::InstanceData> _instances;
+    /// @brief Sort key and index of every submitted item.
+    std::vector<std::pair<uint64_t, uint32_t>> _keys;
+
+    std::unordered_map<entt::id_type, uint16_t> _shaderIndices;
+    std::unordered_map<entt::id_type, uint16_t> _materialIndices;
+    std::unordered_map<entt::id_type, uint16_t> _textureIndices;
+    std::unordered_map<entt::id_type, uint16_t> _modelIndices;
+
+    std::vector<RenderBatch> _batches;
+    std::vector<Utils::InstanceData> _sortedInstances;
+
+    GLuint _instanceBuffer = 0;
+    std::size_t _instanceBufferCapacity = 0;
+};
+} // namespace ES::Plugin::OpenGL::Resource
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "ProgramBinaryCache.hpp"
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * Cache of the linked shader programs, shared by every shader loaded by the plugin.
+ *
+ * @example "Loading a shader through the cache"
+ * @code
+ * Utils::ShaderProgram &sp = core.GetResource<Resource::ShaderManager>().Add(entt::hashed_string{"custom"});
+ * sp.Create();
+ * sp.initFromFiles("shaders/custom.vs", "shaders/custom.fs", core.GetResource<Resource::ShaderBinaryCache>());
+ * @endcode
+ */
+using ShaderBinaryCache = Utils::ProgramBinaryCache;
+} // namespace ES::Plugin::OpenGL::Resource
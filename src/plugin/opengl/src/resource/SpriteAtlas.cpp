@@ -0,0 +1,136 @@
+#include "SpriteAtlas.hpp"
+
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fmt/format.h>
+#include <stb_image.h>
+#include <vector>
+
+namespace ES::Plugin::OpenGL::Resource {
+
+void SpriteAtlas::Create()
+{
+    glGenTextures(1, &_texture);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, _size, _size, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // A 2x2 white block, sampled at its center so filtering never reaches its neighbours
+    std::array<uint8_t, 2 * 2 * 4> white;
+    white.fill(255);
+    glm::ivec2 position;
+    if (Allocate(2, 2, position))
+    {
+        Upload(position, white.data(), 2, 2);
+        glm::vec2 center = (glm::vec2(position) + 1.0f) / static_cast<float>(_size);
+        _whiteRegion = glm::vec4(center, center);
+    }
+}
+
+bool SpriteAtlas::Allocate(int width, int height, glm::ivec2 &position)
+{
+    int paddedWidth = width + 2 * PADDING;
+    int paddedHeight = height + 2 * PADDING;
+    if (paddedWidth > _size)
+        return false;
+
+    if (_cursorX + paddedWidth > _size)
+    {
+        _shelfY += _shelfHeight;
+        _shelfHeight = 0;
+        _cursorX = 0;
+    }
+    if (_shelfY + paddedHeight > _size)
+        return false;
+
+    position = glm::ivec2(_cursorX + PADDING, _shelfY + PADDING);
+    _cursorX += paddedWidth;
+    _shelfHeight = std::max(_shelfHeight, paddedHeight);
+    return true;
+}
+
+void SpriteAtlas::Upload(const glm::ivec2 &position, const uint8_t *pixels, int width, int height)
+{
+    // The padding repeats the border of the image, so that filtering at its edges samples its own pixels
+    int paddedWidth = width + 2 * PADDING;
+    int paddedHeight = height + 2 * PADDING;
+    std::vector<uint8_t> padded(static_cast<std::size_t>(paddedWidth) * paddedHeight * 4);
+    for (int y = 0; y < paddedHeight; y++)
+    {
+        const uint8_t *row = pixels + static_cast<std::size_t>(std::clamp(y - PADDING, 0, height - 1)) * width * 4;
+        for (int x = 0; x < paddedWidth; x++)
+        {
+            std::copy_n(row + static_cast<std::size_t>(std::clamp(x - PADDING, 0, width - 1)) * 4, 4,
+                        padded.data() + (static_cast<std::size_t>(y) * paddedWidth + x) * 4);
+        }
+    }
+
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, position.x - PADDING, position.y - PADDING, paddedWidth, paddedHeight, GL_RGBA,
+                    GL_UNSIGNED_BYTE, padded.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+}
+
+bool SpriteAtlas::Add(const entt::hashed_string &id, const uint8_t *pixels, int width, int height)
+{
+    glm::ivec2 position;
+    if (!Allocate(width, height, position))
+    {
+        ES::Utils::Log::Warn(
+            fmt::format("SpriteAtlas: no room left for {} ({}x{}), it will be drawn with its own texture.",
+                        id.data(), width, height));
+        return false;
+    }
+
+    Upload(position, pixels, width, height);
+
+    auto size = static_cast<float>(_size);
+    _regions[id.value()] = glm::vec4(static_cast<float>(position.x) / size, static_cast<float>(position.y) / size,
+                                     static_cast<float>(position.x + width) / size,
+                                     static_cast<float>(position.y + height) / size);
+    return true;
+}
+
+bool SpriteAtlas::AddFromFile(const entt::hashed_string &id, const std::string &path)
+{
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    uint8_t *pixels = stbi_load(path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+    if (!pixels)
+    {
+        ES::Utils::Log::Error(fmt::format("SpriteAtlas: failed to load image ({}): {}", path, stbi_failure_reason()));
+        return false;
+    }
+
+    bool added = Add(id, pixels, width, height);
+    stbi_image_free(pixels);
+    return added;
+}
+
+const glm::vec4 *SpriteAtlas::Find(entt::id_type id) const
+{
+    auto it = _regions.find(id);
+    return it == _regions.end() ? nullptr : &it->second;
+}
+
+void SpriteAtlas::Destroy()
+{
+    glDeleteTextures(1, &_texture);
+    _texture = 0;
+    _regions.clear();
+    _shelfY = 0;
+    _shelfHeight = 0;
+    _cursorX = 0;
+}
+} // namespace ES::Plugin::OpenGL::Resource
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * SpriteAtlas is a resource packing the images of sprites into a single texture at runtime.
+ *
+ * Sprites whose texture is in the atlas are drawn by the SpriteBatcher with the atlas texture and the UVs of their
+ * region, so that consecutive sprites using different images still share a draw call. Images are packed on shelves,
+ * with a padding around each of them repeating their border, so that filtering doesn't bleed between neighbours.
+ *
+ * The atlas also holds a white texel, used by untextured sprites.
+ *
+ * @example "Packing a sprite image"
+ * @code
+ * core.GetResource<ES::Plugin::OpenGL::Resource::SpriteAtlas>().AddFromFile(
+ *     entt::hashed_string{"player"}, "assets/player.png");
+ * entity.AddComponent<ES::Plugin::OpenGL::Component::TextureHandle>(core, "player");
+ * @endcode
+ */
+class SpriteAtlas {
+  public:
+    /// @brief Default width and height of the atlas texture, in pixels.
+    inline static constexpr int DEFAULT_SIZE = 2048;
+    /// @brief Pixels around every image, copied from its border.
+    inline static constexpr int PADDING = 1;
+
+    explicit SpriteAtlas(int size = DEFAULT_SIZE) : _size(size) {}
+    ~SpriteAtlas() = default;
+
+    /**
+     * @brief Create the atlas texture and pack the white texel. Must be called with an OpenGL context.
+     */
+    void Create();
+
+    /**
+     * @brief Pack an image into the atlas.
+     *
+     * @param id Id of the image, the same as the id of the TextureHandle of the sprites using it.
+     * @param pixels RGBA pixels of the image, 8 bits per channel.
+     * @param width Width of the image.
+     * @param height Height of the image.
+     * @return false if there is no room left in the atlas.
+     */
+    bool Add(const entt::hashed_string &id, const uint8_t *pixels, int width, int height);
+
+    /**
+     * @brief Load an image file and pack it into the atlas.
+     *
+     * @return false if the file can't be loaded or if there is no room left in the atlas.
+     */
+    bool AddFromFile(const entt::hashed_string &id, const std::string &path);
+
+    /**
+     * @brief Get the UV rectangle of an image, as (u0, v0, u1, v1).
+     *
+     * @return The region, or nullptr if the image is not in the atlas.
+     */
+    const glm::vec4 *Find(entt::id_type id) const;
+
+    inline const glm::vec4 &GetWhiteRegion() const { return _whiteRegion; }
+    inline GLuint GetTexture() const { return _texture; }
+    inline int GetSize() const { return _size; }
+
+    void Destroy();
+
+  private:
+    /**
+     * @brief Find room for an image on the shelves.
+     *
+     * @return false if it doesn't fit.
+     */
+    bool Allocate(int width, int height, glm::ivec2 &position);
+
+    /**
+     * @brief Copy an image and its padding into the atlas texture, at a position given by Allocate.
+     */
+    void Upload(const glm::ivec2 &position, const uint8_t *pixels, int width, int height);
+
+    int _size;
+    GLuint _texture = 0;
+
+    int _shelfY = 0;
+    int _shelfHeight = 0;
+    int _cursorX = 0;
+
+    std::unordered_map<entt::id_type, glm::vec4> _regions;
+    glm::vec4 _whiteRegion = glm::vec4(0.0f);
+};
+} // namespace ES::Plugin::OpenGL::Resource
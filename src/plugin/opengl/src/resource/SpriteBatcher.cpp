@@ -0,0 +1,121 @@
+#include "SpriteBatcher.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ES::Plugin::OpenGL::Resource {
+
+void SpriteBatcher::Clear()
+{
+    _vertices.clear();
+    _drawCalls.clear();
+}
+
+void SpriteBatcher::Submit(const entt::hashed_string &shader, GLuint texture, const glm::mat4 &model,
+                           const glm::vec2 &size, const glm::vec4 &uvRegion, const glm::vec4 &color)
+{
+    auto quad = static_cast<GLsizei>(_vertices.size() / 4);
+    if (_drawCalls.empty() || _drawCalls.back().shader.value() != shader.value() ||
+        _drawCalls.back().texture != texture)
+    {
+        _drawCalls.push_back(SpriteDrawCall{shader, texture, quad, 0});
+    }
+    _drawCalls.back().quadCount++;
+
+    // The quad starts at the origin of the sprite, and the image is flipped vertically
+    glm::vec3 origin = glm::vec3(model[3]);
+    glm::vec3 right = glm::vec3(model[0]) * size.x;
+    glm::vec3 up = glm::vec3(model[1]) * size.y;
+    _vertices.push_back(SpriteVertex{origin, glm::vec2(uvRegion.x, uvRegion.w), color});
+    _vertices.push_back(SpriteVertex{origin + right, glm::vec2(uvRegion.z, uvRegion.w), color});
+    _vertices.push_back(SpriteVertex{origin + up, glm::vec2(uvRegion.x, uvRegion.y), color});
+    _vertices.push_back(SpriteVertex{origin + right + up, glm::vec2(uvRegion.z, uvRegion.y), color});
+}
+
+void SpriteBatcher::Reserve(std::size_t quadCount)
+{
+    if (_vao == 0)
+    {
+        glGenVertexArrays(1, &_vao);
+        glGenBuffers(1, &_vbo);
+        glGenBuffers(1, &_ibo);
+
+        glBindVertexArray(_vao);
+        glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex),
+                              reinterpret_cast<void *>(offsetof(SpriteVertex, position)));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex),
+                              reinterpret_cast<void *>(offsetof(SpriteVertex, texCoords)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex),
+                              reinterpret_cast<void *>(offsetof(SpriteVertex, color)));
+        glEnableVertexAttribArray(2);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ibo);
+        glBindVertexArray(0);
+    }
+
+    if (quadCount <= _capacity)
+        return;
+
+    _capacity = std::max(quadCount, _capacity + _capacity / 2);
+
+    // Every quad uses the same 6 indices, offset by its first vertex: they only change when the buffer grows
+    std::vector<uint32_t> indices;
+    indices.reserve(_capacity * 6);
+    for (uint32_t quad = 0; quad < _capacity; quad++)
+    {
+        uint32_t first = quad * 4;
+        indices.insert(indices.end(), {first + 2, first, first + 1, first + 2, first + 1, first + 3});
+    }
+
+    glBindVertexArray(_vao);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(uint32_t)), indices.data(),
+                 GL_STATIC_DRAW);
+    glBindVertexArray(0);
+}
+
+void SpriteBatcher::Upload()
+{
+    if (_vertices.empty())
+        return;
+
+    if (_vertices.size() == _uploaded.size() &&
+        std::memcmp(_vertices.data(), _uploaded.data(), _vertices.size() * sizeof(SpriteVertex)) == 0)
+        return;
+
+    Reserve(Size());
+    _uploaded = _vertices;
+
+    // Orphan the previous content, so the driver doesn't wait for the draws of the last frame
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(_capacity * 4 * sizeof(SpriteVertex)), nullptr,
+                 GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(_vertices.size() * sizeof(SpriteVertex)),
+                    _vertices.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void SpriteBatcher::Draw(const SpriteDrawCall &drawCall) const
+{
+    glBindVertexArray(_vao);
+    glDrawElements(GL_TRIANGLES, drawCall.quadCount * 6, GL_UNSIGNED_INT,
+                   reinterpret_cast<void *>(static_cast<std::size_t>(drawCall.firstQuad) * 6 * sizeof(uint32_t)));
+    glBindVertexArray(0);
+}
+
+void SpriteBatcher::Destroy()
+{
+    glDeleteBuffers(1, &_vbo);
+    glDeleteBuffers(1, &_ibo);
+    glDeleteVertexArrays(1, &_vao);
+    _vao = 0;
+    _vbo = 0;
+    _ibo = 0;
+    _capacity = 0;
+    _uploaded.clear();
+}
+} // namespace ES::Plugin::OpenGL::Resource
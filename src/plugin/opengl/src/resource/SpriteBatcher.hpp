@@ -0,0 +1,103 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * @brief Vertex of a sprite quad, as laid out in the vertex buffer of the SpriteBatcher.
+ *
+ * @code
+ * layout (location = 0) in vec3 Position;
+ * layout (location = 1) in vec2 TexCoords;
+ * layout (location = 2) in vec4 Color;
+ * @endcode
+ */
+struct SpriteVertex {
+    glm::vec3 position;
+    glm::vec2 texCoords;
+    glm::vec4 color;
+};
+
+/**
+ * @brief Consecutive sprites sharing a shader and a texture, drawn by a single call.
+ */
+struct SpriteDrawCall {
+    entt::hashed_string shader;
+    GLuint texture = 0;
+    /// @brief Index of the first quad of the draw call.
+    GLsizei firstQuad = 0;
+    /// @brief Number of quads of the draw call.
+    GLsizei quadCount = 0;
+};
+
+/**
+ * SpriteBatcher is a resource drawing every sprite of a frame from a single streaming vertex buffer.
+ *
+ * Sprites are transformed on the CPU into quads carrying their color and texture coordinates. Consecutive sprites
+ * sharing a shader and a texture are merged into one draw call; sprites are not reordered, so the submission order
+ * is kept. Packing the sprite images in the SpriteAtlas lets sprites with different images share a draw call.
+ *
+ * As the quads are already in world space, a sprite shader only gets the `projection` matrix and the `Texture`
+ * sampler as uniforms, and reads the color of the sprite from its vertices, see SpriteVertex. There are no `model`
+ * and `color` uniforms.
+ */
+class SpriteBatcher {
+  public:
+    SpriteBatcher() = default;
+    ~SpriteBatcher() = default;
+
+    /**
+     * @brief Remove every submitted sprite. Memory is kept for the next frame.
+     */
+    void Clear();
+
+    /**
+     * @brief Submit a sprite to draw.
+     *
+     * @param shader Id of the shader program.
+     * @param texture OpenGL texture of the sprite.
+     * @param model Model matrix of the sprite.
+     * @param size Size of the sprite quad, in model space.
+     * @param uvRegion Region of the texture mapped on the sprite, as (u0, v0, u1, v1).
+     * @param color Color the texture is multiplied with.
+     */
+    void Submit(const entt::hashed_string &shader, GLuint texture, const glm::mat4 &model, const glm::vec2 &size,
+                const glm::vec4 &uvRegion, const glm::vec4 &color);
+
+    /**
+     * @brief Upload the quads of the frame to the vertex buffer. Must be called with an OpenGL context.
+     * Nothing is uploaded if the quads are the same as in the previous upload, as in a static scene.
+     */
+    void Upload();
+
+    /**
+     * @brief Draw the quads of a draw call. The shader and the texture must be bound.
+     */
+    void Draw(const SpriteDrawCall &drawCall) const;
+
+    inline const std::vector<SpriteDrawCall> &GetDrawCalls() const { return _drawCalls; }
+    inline std::size_t Size() const { return _vertices.size() / 4; }
+
+    void Destroy();
+
+  private:
+    /**
+     * @brief Create the vertex array, or grow its buffers so they hold at least quadCount quads.
+     */
+    void Reserve(std::size_t quadCount);
+
+    std::vector<SpriteVertex> _vertices;
+    std::vector<SpriteDrawCall> _drawCalls;
+    /// @brief Copy of the quads currently in the vertex buffer.
+    std::vector<SpriteVertex> _uploaded;
+
+    GLuint _vao = 0;
+    GLuint _vbo = 0;
+    GLuint _ibo = 0;
+    std::size_t _capacity = 0;
+};
+} // namespace ES::Plugin::OpenGL::Resource
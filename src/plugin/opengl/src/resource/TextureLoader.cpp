@@ -0,0 +1,162 @@
+#include "TextureLoader.hpp"
+
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <fmt/format.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ES::Plugin::OpenGL::Resource {
+
+/**
+ * @brief Images waiting to be decoded and decoded images waiting to be uploaded, shared with the worker threads.
+ */
+struct TextureLoader::Queues {
+    struct Request {
+        std::string name;
+        std::string path;
+        bool generateMipmaps = false;
+    };
+
+    struct Result {
+        std::string name;
+        std::string path;
+        Utils::TextureImage image;
+        bool loaded = false;
+    };
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopping = false;
+    std::deque<Request> requests;
+    std::deque<Result> results;
+    std::vector<std::thread> workers;
+
+    ~Queues()
+    {
+        {
+            std::scoped_lock lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    void Start()
+    {
+        std::size_t threadCount = std::thread::hardware_concurrency();
+        // Leave a core to the main thread
+        std::size_t workerCount = std::clamp<std::size_t>(threadCount > 1 ? threadCount - 1 : 1, 1, MAX_WORKERS);
+        for (std::size_t i = 0; i < workerCount; i++)
+        {
+            workers.emplace_back([this]() { Work(); });
+        }
+    }
+
+    void Work()
+    {
+        while (true)
+        {
+            Request request;
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock, [this]() { return stopping || !requests.empty(); });
+                if (stopping)
+                {
+                    return;
+                }
+                request = std::move(requests.front());
+                requests.pop_front();
+            }
+
+            Result result{request.name, request.path, {}, false};
+            result.loaded = result.image.LoadFromFile(request.path);
+            if (result.loaded && request.generateMipmaps)
+            {
+                result.image.GenerateMipmaps();
+            }
+
+            std::scoped_lock lock(mutex);
+            results.push_back(std::move(result));
+        }
+    }
+};
+
+TextureLoader::TextureLoader() : _queues(std::make_unique<Queues>()) {}
+
+TextureLoader::TextureLoader(TextureLoader &&) noexcept = default;
+
+TextureLoader &TextureLoader::operator=(TextureLoader &&) noexcept = default;
+
+TextureLoader::~TextureLoader() = default;
+
+Utils::Texture &TextureLoader::Load(TextureManager &manager, const std::string &name, const std::string &path)
+{
+    if (!_queues)
+    {
+        _queues = std::make_unique<Queues>();
+    }
+    if (_queues->workers.empty())
+    {
+        _queues->Start();
+    }
+
+    Utils::Texture &texture = manager.Add(entt::hashed_string(name.c_str()), placeholderColor);
+    _pending++;
+    {
+        std::scoped_lock lock(_queues->mutex);
+        _queues->requests.push_back(Queues::Request{name, path, generateMipmaps});
+    }
+    _queues->condition.notify_one();
+    return texture;
+}
+
+void TextureLoader::Upload(TextureManager &manager)
+{
+    if (_pending == 0)
+    {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t uploadedBytes = 0;
+    while (true)
+    {
+        Queues::Result result;
+        {
+            std::scoped_lock lock(_queues->mutex);
+            if (_queues->results.empty())
+            {
+                return;
+            }
+            std::size_t size = _queues->results.front().image.GetByteSize();
+            if (uploadedBytes > 0 &&
+                (uploadedBytes + size > byteBudget || std::chrono::steady_clock::now() - start >= timeBudget))
+            {
+                return;
+            }
+            result = std::move(_queues->results.front());
+            _queues->results.pop_front();
+        }
+
+        _pending--;
+        uploadedBytes += result.image.GetByteSize();
+        // A failed image keeps its placeholder, the error was logged by the worker
+        entt::hashed_string id(result.name.c_str());
+        if (!result.loaded || !manager.Contains(id))
+        {
+            continue;
+        }
+        manager.Get(id).Upload(result.image);
+        ES::Utils::Log::Info(fmt::format("Texture loaded: {}", result.path));
+    }
+}
+
+} // namespace ES::Plugin::OpenGL::Resource
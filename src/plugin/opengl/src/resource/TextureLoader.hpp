@@ -0,0 +1,83 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+#include "TextureManager.hpp"
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * TextureLoader is a resource loading textures without blocking the main thread.
+ *
+ * Load adds a placeholder texture to the TextureManager right away, so the texture can be used while it loads.
+ * Image files are decoded, and their mip chain is generated if requested, by worker threads. The UploadTextures
+ * system then uploads the decoded images into their texture, within a byte and a time budget per frame so that
+ * loading many textures doesn't cause a frame spike. At least one image is uploaded per frame.
+ *
+ * @example "Loading a texture asynchronously"
+ * @code
+ * core.GetResource<ES::Plugin::OpenGL::Resource::TextureLoader>().Load(
+ *     core.GetResource<ES::Plugin::OpenGL::Resource::TextureManager>(), "crate", "assets/crate.png");
+ * entity.AddComponent<ES::Plugin::OpenGL::Component::TextureHandle>(core, "crate");
+ * @endcode
+ */
+class TextureLoader {
+  public:
+    /// @brief Maximum number of worker threads decoding images.
+    inline static constexpr std::size_t MAX_WORKERS = 4;
+    /// @brief Default number of bytes uploaded per frame.
+    inline static constexpr std::size_t DEFAULT_BYTE_BUDGET = 16 * 1024 * 1024;
+    /// @brief Default time spent uploading per frame.
+    inline static constexpr std::chrono::microseconds DEFAULT_TIME_BUDGET = std::chrono::microseconds(2000);
+
+    TextureLoader();
+    TextureLoader(TextureLoader &&) noexcept;
+    TextureLoader &operator=(TextureLoader &&) noexcept;
+    /// @brief Stop the workers, the images still being decoded are dropped.
+    ~TextureLoader();
+
+    /**
+     * @brief Add a placeholder texture to the manager and start decoding the image file on a worker thread.
+     * Must be called with an OpenGL context.
+     *
+     * @param manager Texture manager the texture is added to.
+     * @param name Id of the texture.
+     * @param path Path of the image file.
+     * @return The placeholder texture, which receives the image once it is uploaded.
+     */
+    Utils::Texture &Load(TextureManager &manager, const std::string &name, const std::string &path);
+
+    /**
+     * @brief Upload the decoded images to their texture, within the budget. Must be called with an OpenGL context.
+     *
+     * @param manager Texture manager the textures were added to.
+     */
+    void Upload(TextureManager &manager);
+
+    /**
+     * @brief Whether every loaded texture was uploaded.
+     */
+    [[nodiscard]] inline bool IsIdle() const { return _pending == 0; }
+
+    /// @brief Maximum number of bytes uploaded per frame.
+    std::size_t byteBudget = DEFAULT_BYTE_BUDGET;
+    /// @brief Maximum time spent uploading per frame.
+    std::chrono::microseconds timeBudget = DEFAULT_TIME_BUDGET;
+    /// @brief Whether the mip chain is generated by the workers, instead of by the GPU during the upload.
+    bool generateMipmaps = true;
+    /// @brief Color of the placeholder textures.
+    glm::u8vec4 placeholderColor = glm::u8vec4(128, 128, 128, 255);
+
+  private:
+    struct Queues;
+
+    std::unique_ptr<Queues> _queues;
+    /// @brief Number of loaded textures not uploaded yet.
+    std::size_t _pending = 0;
+};
+} // namespace ES::Plugin::OpenGL::Resource
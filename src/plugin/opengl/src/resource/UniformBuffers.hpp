@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "UniformBlocks.hpp"
+#include "UniformBuffer.hpp"
+
+namespace ES::Plugin::OpenGL::Resource {
+/**
+ * UniformBuffers is a resource holding the uniform buffers shared by every shader program.
+ *
+ * The camera and light buffers are uploaded once per frame. The material buffer holds every material used by the
+ * frame, each at an offset aligned for glBindBufferRange, so that switching material between draws only binds a
+ * range of it.
+ *
+ * @see Utils::CameraBlock, Utils::LightBlock, Utils::MaterialBlock
+ */
+struct UniformBuffers {
+    Utils::UniformBuffer camera;
+    Utils::UniformBuffer lights;
+    Utils::UniformBuffer materials;
+
+    /// @brief Distance between two materials in the material buffer, in bytes.
+    GLsizeiptr materialStride = 0;
+    /// @brief Offset of every material of the frame in the material buffer.
+    std::unordered_map<entt::id_type, GLintptr> materialOffsets;
+    /// @brief Content of the material buffer, kept across frames so its memory is reused.
+    std::vector<std::byte> materialData;
+};
+} // namespace ES::Plugin::OpenGL::Resource
@@ -1,35 +1,46 @@
 #include "BufferSystems.hpp"
+#include "GLMeshBufferDirty.hpp"
 #include "GLMeshBufferManager.hpp"
-#include "GLSpriteBufferManager.hpp"
 #include "GLTextBufferManager.hpp"
 #include "ModelHandle.hpp"
-#include "SpriteHandle.hpp"
 #include "TextHandle.hpp"
 #include "TextureManager.hpp"
 
-void ES::Plugin::OpenGL::System::LoadGLSpriteBuffer(ES::Engine::Core &core)
+#include <unordered_set>
+
+void ES::Plugin::OpenGL::System::MarkGLMeshBufferDirty(entt::registry &registry, entt::entity entity)
 {
-    auto &glBufferManager = core.GetResource<Resource::GLSpriteBufferManager>();
+    registry.emplace_or_replace<Component::GLMeshBufferDirty>(entity);
+}
 
-    core.GetRegistry().view<Component::SpriteHandle, Component::Sprite>().each(
-        [&](auto entity, Component::SpriteHandle &spriteHandle, Component::Sprite &sprite) {
-            if (glBufferManager.Contains(spriteHandle.id))
-            {
-                glBufferManager.Get(spriteHandle.id).Update(sprite);
-                return;
-            }
-            Utils::GLSpriteBuffer buffer;
-            buffer.GenerateGLSpriteBuffers(sprite);
-            glBufferManager.Add(spriteHandle.id, std::move(buffer));
-        });
+void ES::Plugin::OpenGL::System::TrackGLMeshBufferChanges(ES::Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+    registry.on_construct<ES::Plugin::Object::Component::Mesh>().connect<&MarkGLMeshBufferDirty>();
+    registry.on_update<ES::Plugin::Object::Component::Mesh>().connect<&MarkGLMeshBufferDirty>();
+    registry.on_construct<Component::ModelHandle>().connect<&MarkGLMeshBufferDirty>();
+    registry.on_update<Component::ModelHandle>().connect<&MarkGLMeshBufferDirty>();
+
+    // Entities created before the observers were connected
+    for (auto entity : registry.view<Component::ModelHandle, ES::Plugin::Object::Component::Mesh>())
+    {
+        MarkGLMeshBufferDirty(registry, entity);
+    }
 }
 
 void ES::Plugin::OpenGL::System::LoadGLMeshBuffer(ES::Engine::Core &core)
 {
     auto &glBufferManager = core.GetResource<Resource::GLMeshBufferManager>();
+    auto &registry = core.GetRegistry();
 
-    core.GetRegistry().view<Component::ModelHandle, ES::Plugin::Object::Component::Mesh>().each(
+    // Entities sharing a model share its buffer: it is uploaded once per frame
+    std::unordered_set<entt::id_type> uploaded;
+    registry.view<Component::ModelHandle, ES::Plugin::Object::Component::Mesh, Component::GLMeshBufferDirty>().each(
         [&](auto entity, Component::ModelHandle &model, ES::Plugin::Object::Component::Mesh &mesh) {
+            if (!uploaded.insert(model.id.value()).second)
+            {
+                return;
+            }
             if (glBufferManager.Contains(model.id))
             {
                 glBufferManager.Get(model.id).Update(mesh);
@@ -39,6 +50,7 @@ void ES::Plugin::OpenGL::System::LoadGLMeshBuffer(ES::Engine::Core &core)
             buffer.GenerateGLMeshBuffers(mesh);
             glBufferManager.Add(model.id, std::move(buffer));
         });
+    registry.clear<Component::GLMeshBufferDirty>();
 }
 
 void ES::Plugin::OpenGL::System::LoadGLTextBuffer(ES::Engine::Core &core)
@@ -3,7 +3,17 @@
 #include "Core.hpp"
 
 namespace ES::Plugin::OpenGL::System {
+/**
+ * @brief Tag an entity with GLMeshBufferDirty, so its mesh is uploaded by LoadGLMeshBuffer.
+ */
+void MarkGLMeshBufferDirty(entt::registry &registry, entt::entity entity);
+/**
+ * @brief Observe the Mesh and ModelHandle components, tagging the entities whose mesh must be uploaded again.
+ */
+void TrackGLMeshBufferChanges(ES::Engine::Core &core);
+/**
+ * @brief Upload the meshes of the entities tagged with GLMeshBufferDirty, then remove the tags.
+ */
 void LoadGLMeshBuffer(ES::Engine::Core &core);
-void LoadGLSpriteBuffer(ES::Engine::Core &core);
 void LoadGLTextBuffer(ES::Engine::Core &core);
 } // namespace ES::Plugin::OpenGL::System
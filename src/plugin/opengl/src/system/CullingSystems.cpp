@@ -0,0 +1,81 @@
+#include "CullingSystems.hpp"
+#include "Camera.hpp"
+#include "GLMeshBufferManager.hpp"
+#include "MaterialHandle.hpp"
+#include "MeshCulling.hpp"
+#include "ModelHandle.hpp"
+#include "Object.hpp"
+#include "ThreadPool.hpp"
+#include "WorldBounds.hpp"
+
+void ES::Plugin::OpenGL::System::CreateMeshCulling(ES::Engine::Core &core)
+{
+    core.RegisterResource<Resource::MeshCulling>({});
+}
+
+void ES::Plugin::OpenGL::System::CullMeshes(ES::Engine::Core &core)
+{
+    auto &culling = core.GetResource<Resource::MeshCulling>();
+    auto &glBufferManager = core.GetResource<Resource::GLMeshBufferManager>();
+
+    auto &registry = core.GetRegistry();
+
+    // A new WorldBounds holds an empty box, computed from empty mesh bounds: it is recomputed below if needed
+    for (auto entity : registry.view<Component::ModelHandle, ES::Plugin::Object::Component::WorldMatrix,
+                                     ES::Plugin::Object::Component::Mesh, Component::MaterialHandle>(
+             entt::exclude<Component::WorldBounds>))
+    {
+        registry.emplace<Component::WorldBounds>(entity);
+    }
+
+    culling.frameEntities.clear();
+    culling.worldBounds.clear();
+    registry
+        .view<Component::ModelHandle, ES::Plugin::Object::Component::WorldMatrix, ES::Plugin::Object::Component::Mesh,
+              Component::MaterialHandle, Component::WorldBounds>()
+        .each([&](auto entity, Component::ModelHandle &modelHandle,
+                  ES::Plugin::Object::Component::WorldMatrix &worldMatrix, ES::Plugin::Object::Component::Mesh &,
+                  Component::MaterialHandle &, Component::WorldBounds &worldBounds) {
+            const Utils::BoundingBox &meshBounds = glBufferManager.Get(modelHandle.id).bounds;
+            if (worldBounds.model != worldMatrix.model || worldBounds.meshBounds.min != meshBounds.min ||
+                worldBounds.meshBounds.max != meshBounds.max)
+            {
+                worldBounds.box = meshBounds.Transformed(worldMatrix.model);
+                worldBounds.model = worldMatrix.model;
+                worldBounds.meshBounds = meshBounds;
+            }
+            // A mesh without vertices has nothing to draw, and its empty box would break the hierarchy
+            if (worldBounds.box.IsEmpty())
+                return;
+            culling.frameEntities.push_back(entity);
+            culling.worldBounds.push_back(worldBounds.box);
+        });
+
+    if (!culling.enabled)
+    {
+        culling.visible.assign(culling.frameEntities.begin(), culling.frameEntities.end());
+        culling.entities.clear();
+        return;
+    }
+
+    // Meshes only moved: the structure of the hierarchy is still valid, only its bounds need to be updated
+    if (culling.frameEntities != culling.entities || culling.bvh.NeedsRebuild())
+    {
+        culling.entities.swap(culling.frameEntities);
+        culling.bvh.Build(culling.worldBounds);
+    }
+    else
+    {
+        culling.bvh.Refit(culling.worldBounds);
+    }
+
+    const auto &camera = core.GetResource<Resource::Camera>();
+    culling.bvh.Cull(Utils::Frustum(camera.projection * camera.view), culling.visibleIndices,
+                     &core.GetResource<ES::Utils::ThreadPool>());
+
+    culling.visible.clear();
+    for (uint32_t index : culling.visibleIndices)
+    {
+        culling.visible.push_back(culling.entities[index]);
+    }
+}
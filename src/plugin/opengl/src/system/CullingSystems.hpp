@@ -0,0 +1,8 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::OpenGL::System {
+void CreateMeshCulling(ES::Engine::Core &core);
+void CullMeshes(ES::Engine::Core &core);
+} // namespace ES::Plugin::OpenGL::System
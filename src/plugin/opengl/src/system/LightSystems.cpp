@@ -0,0 +1,91 @@
+#include "LightSystems.hpp"
+#include "Camera.hpp"
+#include "Entity.hpp"
+#include "Light.hpp"
+#include "LightClusters.hpp"
+#include "Object.hpp"
+#include "ThreadPool.hpp"
+#include "UniformBuffers.hpp"
+
+#include <array>
+#include <cmath>
+#include <glm/gtc/constants.hpp>
+
+void ES::Plugin::OpenGL::System::CreateLightClusters(ES::Engine::Core &core)
+{
+    auto &clusters = core.RegisterResource<Resource::LightClusters>({});
+    const glm::uvec3 &size = clusters.grid.GetSize();
+    clusters.lightBuffer.Create(Resource::LightClusters::LIGHT_BINDING, sizeof(Utils::LightInfo) * 64);
+    clusters.clusterBuffer.Create(Resource::LightClusters::CLUSTER_BINDING,
+                                  sizeof(Utils::LightClusterGrid::Cluster) * size.x * size.y * size.z);
+    clusters.lightIndexBuffer.Create(Resource::LightClusters::LIGHT_INDEX_BINDING, sizeof(uint32_t) * 4096);
+}
+
+void ES::Plugin::OpenGL::System::CreateDefaultLights(ES::Engine::Core &core)
+{
+    std::array<glm::vec3, 5> intensities = {glm::vec3(0.0f, 0.8f, 0.8f), glm::vec3(0.0f, 0.0f, 0.8f),
+                                            glm::vec3(0.8f, 0.0f, 0.0f), glm::vec3(0.0f, 0.8f, 0.0f),
+                                            glm::vec3(0.8f, 0.8f, 0.8f)};
+    float scale = 2.f * glm::pi<float>() / static_cast<float>(intensities.size());
+
+    for (std::size_t i = 0; i < intensities.size(); i++)
+    {
+        float angle = scale * static_cast<float>(i);
+        ES::Engine::Entity light = core.CreateEntity();
+        light.AddComponent<Object::Component::Transform>(core, glm::vec3(5.f * cosf(angle), 5.f, 5.f * sinf(angle)));
+        Component::Light::Type type =
+            i + 1 < intensities.size() ? Component::Light::Type::Point : Component::Light::Type::Directional;
+        light.AddComponent<Component::Light>(core, type, intensities[i], 50.0f);
+    }
+    core.GetResource<Resource::LightClusters>().ambient = intensities[0];
+}
+
+void ES::Plugin::OpenGL::System::UpdateLightClusters(ES::Engine::Core &core)
+{
+    auto &camera = core.GetResource<Resource::Camera>();
+    auto &clusters = core.GetResource<Resource::LightClusters>();
+    auto view = core.GetRegistry().view<Component::Light, Object::Component::WorldMatrix>();
+
+    clusters.lights.clear();
+    clusters.viewLights.clear();
+    view.each([&clusters](const Component::Light &light, const Object::Component::WorldMatrix &worldMatrix) {
+        if (light.type != Component::Light::Type::Directional)
+            return;
+        glm::vec3 position = glm::vec3(worldMatrix.model[3]);
+        glm::vec3 direction = position == glm::vec3(0.0f) ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::normalize(position);
+        clusters.lights.push_back(Utils::LightInfo{glm::vec4(direction, 0.0f), light.intensity});
+    });
+    clusters.directionalCount = static_cast<uint32_t>(clusters.lights.size());
+    view.each([&clusters, &camera](const Component::Light &light, const Object::Component::WorldMatrix &worldMatrix) {
+        if (light.type != Component::Light::Type::Point)
+            return;
+        glm::vec4 position = worldMatrix.model[3];
+        clusters.lights.push_back(Utils::LightInfo{glm::vec4(glm::vec3(position), light.radius), light.intensity});
+        clusters.viewLights.emplace_back(glm::vec3(camera.view * position), light.radius);
+    });
+
+    clusters.grid.Build(camera.projection, camera.zNear, camera.zFar, clusters.viewLights,
+                        &core.GetResource<ES::Utils::ThreadPool>());
+
+    const auto &gridClusters = clusters.grid.GetClusters();
+    const auto &lightIndices = clusters.grid.GetLightIndices();
+    clusters.lightBuffer.Upload(clusters.lights.data(), sizeof(Utils::LightInfo) * clusters.lights.size());
+    clusters.clusterBuffer.Upload(gridClusters.data(),
+                                  sizeof(Utils::LightClusterGrid::Cluster) * gridClusters.size());
+    clusters.lightIndexBuffer.Upload(lightIndices.data(), sizeof(uint32_t) * lightIndices.size());
+    clusters.lightBuffer.Bind();
+    clusters.clusterBuffer.Bind();
+    clusters.lightIndexBuffer.Bind();
+
+    const glm::uvec3 &size = clusters.grid.GetSize();
+    Utils::LightBlock block;
+    block.view = camera.view;
+    block.clusterGrid = glm::uvec4(size, clusters.directionalCount);
+    block.clusterScale = glm::vec4(camera.size / glm::vec2(size.x, size.y), clusters.grid.GetDepthScale(),
+                                   clusters.grid.GetDepthBias());
+    block.ambient = clusters.ambient;
+
+    auto &lights = core.GetResource<Resource::UniformBuffers>().lights;
+    lights.Update(block);
+    lights.Bind();
+}
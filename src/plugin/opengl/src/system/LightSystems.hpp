@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::OpenGL::System {
+void CreateLightClusters(ES::Engine::Core &core);
+/**
+ * @brief Create the default lights of the scene: four colored point lights around the origin and a white
+ * directional light. They are plain entities with a Light component, which can be changed or destroyed.
+ */
+void CreateDefaultLights(ES::Engine::Core &core);
+/**
+ * @brief Gather the Light components, assign the point lights to the clusters of the camera frustum and upload them
+ * for the shaders. Must run after the camera matrices and the world matrices are updated.
+ */
+void UpdateLightClusters(ES::Engine::Core &core);
+} // namespace ES::Plugin::OpenGL::System
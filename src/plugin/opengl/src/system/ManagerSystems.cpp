@@ -1,10 +1,10 @@
 #include "ManagerSystems.hpp"
 #include "FontManager.hpp"
 #include "GLMeshBufferManager.hpp"
-#include "GLSpriteBufferManager.hpp"
 #include "GLTextBufferManager.hpp"
 #include "ShaderManager.hpp"
 #include "TextureManager.hpp"
+#include "ThreadPool.hpp"
 
 void ES::Plugin::OpenGL::System::LoadFontManager(ES::Engine::Core &core)
 {
@@ -26,12 +26,12 @@ void ES::Plugin::OpenGL::System::LoadGLTextBufferManager(ES::Engine::Core &core)
     core.RegisterResource<Resource::GLTextBufferManager>(Resource::GLTextBufferManager());
 }
 
-void ES::Plugin::OpenGL::System::LoadGLSpriteBufferManager(ES::Engine::Core &core)
+void ES::Plugin::OpenGL::System::LoadShaderManager(ES::Engine::Core &core)
 {
-    core.RegisterResource<Resource::GLSpriteBufferManager>(Resource::GLSpriteBufferManager());
+    core.RegisterResource<Resource::ShaderManager>(Resource::ShaderManager());
 }
 
-void ES::Plugin::OpenGL::System::LoadShaderManager(ES::Engine::Core &core)
+void ES::Plugin::OpenGL::System::CreateThreadPool(ES::Engine::Core &core)
 {
-    core.RegisterResource<Resource::ShaderManager>(Resource::ShaderManager());
+    core.RegisterResource<ES::Utils::ThreadPool>(ES::Utils::ThreadPool());
 }
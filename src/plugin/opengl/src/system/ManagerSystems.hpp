@@ -6,7 +6,10 @@ namespace ES::Plugin::OpenGL::System {
 void LoadFontManager(ES::Engine::Core &core);
 void LoadTextureManager(ES::Engine::Core &core);
 void LoadGLMeshBufferManager(ES::Engine::Core &core);
-void LoadGLSpriteBufferManager(ES::Engine::Core &core);
 void LoadGLTextBufferManager(ES::Engine::Core &core);
 void LoadShaderManager(ES::Engine::Core &core);
+/**
+ * @brief Register the ES::Utils::ThreadPool resource shared by the systems working in parallel.
+ */
+void CreateThreadPool(ES::Engine::Core &core);
 } // namespace ES::Plugin::OpenGL::System
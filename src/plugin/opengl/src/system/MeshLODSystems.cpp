@@ -0,0 +1,128 @@
+#include "MeshLODSystems.hpp"
+#include "Camera.hpp"
+#include "GLMeshBufferManager.hpp"
+#include "MeshCulling.hpp"
+#include "MeshLOD.hpp"
+#include "MeshLODGenerator.hpp"
+#include "ModelHandle.hpp"
+#include "Object.hpp"
+#include "ThreadPool.hpp"
+#include "WorldBounds.hpp"
+
+#include <chrono>
+#include <fmt/format.h>
+#include <memory>
+
+/**
+ * @brief Get the name of the mesh buffer of a simplified level of a model.
+ */
+static std::string GetLevelName(const std::string &model, const ES::Plugin::OpenGL::Resource::MeshLODKey &key,
+                                std::size_t level)
+{
+    return fmt::format("{}#lod{}x{}#{}", model, key.levelCount, key.reduction, level);
+}
+
+void ES::Plugin::OpenGL::System::CreateMeshLODGenerator(ES::Engine::Core &core)
+{
+    core.RegisterResource<Resource::MeshLODGenerator>({});
+}
+
+void ES::Plugin::OpenGL::System::GenerateMeshLODs(ES::Engine::Core &core)
+{
+    auto &generator = core.GetResource<Resource::MeshLODGenerator>();
+    auto &glBufferManager = core.GetResource<Resource::GLMeshBufferManager>();
+    auto &threadPool = core.GetResource<ES::Utils::ThreadPool>();
+
+    // Upload the levels of the finished jobs, without waiting for the others
+    std::erase_if(generator.jobs, [&](Resource::MeshLODGenerator::Job &job) {
+        if (job.levels.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return false;
+        }
+        std::vector<ES::Plugin::Object::Component::Mesh> levels = job.levels.get();
+        Resource::MeshLODGenerator::Levels &models = generator.levels[job.key];
+        models.names.push_back(job.model);
+        for (std::size_t level = 0; level < levels.size(); level++)
+        {
+            models.names.push_back(GetLevelName(job.model, job.key, level + 1));
+            Utils::GLMeshBuffer buffer;
+            buffer.GenerateGLMeshBuffers(levels[level]);
+            glBufferManager.Add(entt::hashed_string(models.names.back().c_str()), std::move(buffer));
+        }
+        // Hashed once every name is in place, so that the ids keep pointing to them
+        for (const std::string &name : models.names)
+        {
+            models.ids.emplace_back(name.c_str());
+        }
+        return true;
+    });
+
+    // Entities sharing a model and settings share its levels: they are generated once, even across frames
+    core.GetRegistry().view<Component::ModelHandle, ES::Plugin::Object::Component::Mesh, Component::MeshLOD>().each(
+        [&](Component::ModelHandle &model, ES::Plugin::Object::Component::Mesh &mesh, Component::MeshLOD &meshLOD) {
+            if (!meshLOD.models.empty())
+            {
+                return;
+            }
+            Resource::MeshLODKey key{model.id.value(), meshLOD.levelCount, meshLOD.reduction};
+            if (auto levels = generator.levels.find(key); levels != generator.levels.end())
+            {
+                meshLOD.models = levels->second.ids;
+                return;
+            }
+            if (!generator.attempted.insert(key).second)
+            {
+                return;
+            }
+            // The worker simplifies a copy, the Mesh may change or be destroyed before it is done
+            auto source = std::make_shared<ES::Plugin::Object::Component::Mesh>(mesh);
+            generator.jobs.push_back(Resource::MeshLODGenerator::Job{
+                key, model.name, threadPool.Submit([source, key]() {
+                    return ES::Plugin::Object::Utils::GenerateLODs(*source, key.levelCount, key.reduction);
+                })});
+        });
+}
+
+void ES::Plugin::OpenGL::System::SelectMeshLODs(ES::Engine::Core &core)
+{
+    auto &camera = core.GetResource<Resource::Camera>();
+    auto &registry = core.GetRegistry();
+
+    glm::vec3 eye = camera.viewer.getViewPoint();
+    float focalLength = camera.projection[1][1];
+    for (entt::entity entity : core.GetResource<Resource::MeshCulling>().visible)
+    {
+        auto meshLOD = registry.try_get<Component::MeshLOD>(entity);
+        if (meshLOD == nullptr)
+        {
+            continue;
+        }
+        meshLOD->current = 0;
+        if (meshLOD->models.size() < 2)
+        {
+            continue;
+        }
+
+        // CullMeshes updated the world bounds of every visible entity this frame
+        const Utils::BoundingBox &bounds = registry.get<Component::WorldBounds>(entity).box;
+        float radius = glm::length(bounds.GetExtents());
+        float distance = glm::length(bounds.GetCenter() - eye);
+        if (distance <= radius)
+        {
+            continue;
+        }
+        // Fraction of the screen height covered by the bounding sphere of the mesh
+        float screenSize = radius * focalLength / distance;
+        if (screenSize >= meshLOD->screenSize)
+        {
+            continue;
+        }
+        std::size_t level = 1;
+        for (float threshold = meshLOD->screenSize / 2.0f; screenSize < threshold && level + 1 < meshLOD->models.size();
+             threshold /= 2.0f)
+        {
+            level++;
+        }
+        meshLOD->current = static_cast<uint8_t>(level);
+    }
+}
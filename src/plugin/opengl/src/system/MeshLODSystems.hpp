@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::OpenGL::System {
+void CreateMeshLODGenerator(ES::Engine::Core &core);
+/**
+ * @brief Generate the levels of detail of the models of the entities with a MeshLOD, if they weren't yet, and
+ * upload them to the GLMeshBufferManager. Models are simplified on the ThreadPool, and their levels are uploaded
+ * on the first frame they are ready, without waiting for them.
+ *
+ * @note To be used after LoadGLMeshBuffer.
+ */
+void GenerateMeshLODs(ES::Engine::Core &core);
+/**
+ * @brief Pick the level of detail of the visible entities with a MeshLOD from the size they cover on screen.
+ *
+ * @note To be used after CullMeshes.
+ */
+void SelectMeshLODs(ES::Engine::Core &core);
+} // namespace ES::Plugin::OpenGL::System
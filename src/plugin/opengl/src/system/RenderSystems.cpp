@@ -4,68 +4,192 @@
 #include "FontHandle.hpp"
 #include "FontManager.hpp"
 #include "GLMeshBufferManager.hpp"
-#include "GLSpriteBufferManager.hpp"
 #include "GLTextBufferManager.hpp"
-#include "Light.hpp"
+#include "LightClusters.hpp"
 #include "MaterialCache.hpp"
 #include "MaterialHandle.hpp"
+#include "MeshCulling.hpp"
+#include "MeshLOD.hpp"
 #include "ModelHandle.hpp"
 #include "Object.hpp"
+#include "RenderQueue.hpp"
 #include "ShaderHandle.hpp"
 #include "ShaderManager.hpp"
 #include "Sprite.hpp"
-#include "SpriteHandle.hpp"
+#include "SpriteAtlas.hpp"
+#include "SpriteBatcher.hpp"
 #include "Text.hpp"
 #include "TextHandle.hpp"
 #include "TextureHandle.hpp"
 #include "TextureManager.hpp"
+#include "UniformBuffers.hpp"
 
+#include <cstring>
 #include <glm/gtc/type_ptr.hpp>
+#include <optional>
 
-static void BindTextureIfNeeded(ES::Engine::Core &core, ES::Engine::Entity entity)
+namespace {
+/**
+ * @brief Uniforms of a mesh shader set per draw, resolved once when the shader gets used. Those the shader doesn't
+ * have are invalid handles, set without any error.
+ */
+struct MeshUniforms {
+    ES::Plugin::OpenGL::Utils::Uniform<glm::vec3> ka;
+    ES::Plugin::OpenGL::Utils::Uniform<glm::vec3> kd;
+    ES::Plugin::OpenGL::Utils::Uniform<glm::vec3> ks;
+    ES::Plugin::OpenGL::Utils::Uniform<float> shiness;
+    ES::Plugin::OpenGL::Utils::Uniform<glm::mat3> normalMatrix;
+    ES::Plugin::OpenGL::Utils::Uniform<glm::mat4> modelMatrix;
+    ES::Plugin::OpenGL::Utils::Uniform<glm::mat4> mvp;
+
+    explicit MeshUniforms(const ES::Plugin::OpenGL::Utils::ShaderProgram &shader)
+        : ka(shader.findUniform<glm::vec3>("Material.Ka")), kd(shader.findUniform<glm::vec3>("Material.Kd")),
+          ks(shader.findUniform<glm::vec3>("Material.Ks")), shiness(shader.findUniform<float>("Material.Shiness")),
+          normalMatrix(shader.findUniform<glm::mat3>("NormalMatrix")),
+          modelMatrix(shader.findUniform<glm::mat4>("ModelMatrix")), mvp(shader.findUniform<glm::mat4>("MVP"))
+    {
+    }
+};
+} // namespace
+
+/**
+ * @brief Set the material uniforms of a shader that doesn't declare the material uniform block.
+ */
+static void LoadMaterial(const MeshUniforms &uniforms, const ES::Plugin::OpenGL::Utils::Material &material)
 {
-    ES::Plugin::OpenGL::Component::TextureHandle *textureHandle =
-        ES::Engine::Entity(entity).TryGetComponent<ES::Plugin::OpenGL::Component::TextureHandle>(core);
-    if (textureHandle)
-        core.GetResource<ES::Plugin::OpenGL::Resource::TextureManager>().Get(textureHandle->id).Bind();
+    uniforms.ka.Set(material.Ka);
+    uniforms.kd.Set(material.Kd);
+    uniforms.ks.Set(material.Ks);
+    uniforms.shiness.Set(material.Shiness);
 }
 
-static void LoadMaterial(ES::Plugin::OpenGL::Utils::ShaderProgram &shader,
-                         const ES::Plugin::OpenGL::Utils::Material &material)
+/**
+ * @brief Draw the instances of a batch one at a time, for shaders that don't read the instance attributes.
+ */
+static void DrawBatchWithoutInstancing(const MeshUniforms &uniforms,
+                                       const ES::Plugin::OpenGL::Utils::GLMeshBuffer &glBuffer,
+                                       const ES::Plugin::OpenGL::Resource::RenderBatch &batch,
+                                       const std::vector<ES::Plugin::OpenGL::Utils::InstanceData> &instances,
+                                       const glm::mat4 &viewProjection)
 {
-    glUniform3fv(shader.uniform("Material.Ka"), 1, glm::value_ptr(material.Ka));
-    glUniform3fv(shader.uniform("Material.Kd"), 1, glm::value_ptr(material.Kd));
-    glUniform3fv(shader.uniform("Material.Ks"), 1, glm::value_ptr(material.Ks));
-    glUniform1fv(shader.uniform("Material.Shiness"), 1, &material.Shiness);
+    for (GLsizei i = 0; i < batch.instanceCount; i++)
+    {
+        const auto &instance = instances[batch.firstInstance + i];
+        uniforms.normalMatrix.Set(instance.normalMatrix);
+        uniforms.modelMatrix.Set(instance.modelMatrix);
+        uniforms.mvp.Set(viewProjection * instance.modelMatrix);
+        glBindVertexArray(glBuffer.VAO);
+        glDrawElements(GL_TRIANGLES, glBuffer.indexCount, GL_UNSIGNED_INT, nullptr);
+    }
+    glBindVertexArray(0);
+}
+
+/**
+ * @brief Upload every material used by the batches of the frame to the material uniform buffer, each at an offset
+ * that can be bound with BindRange.
+ */
+static void UploadMaterials(ES::Plugin::OpenGL::Resource::UniformBuffers &uniformBuffers,
+                            ES::Plugin::OpenGL::Resource::MaterialCache &materialCache,
+                            const std::vector<ES::Plugin::OpenGL::Resource::RenderBatch> &batches)
+{
+    uniformBuffers.materialOffsets.clear();
+    uniformBuffers.materialData.clear();
+    for (const auto &batch : batches)
+    {
+        auto [it, inserted] = uniformBuffers.materialOffsets.try_emplace(
+            batch.material.value(), static_cast<GLintptr>(uniformBuffers.materialData.size()));
+        if (!inserted)
+            continue;
+
+        ES::Plugin::OpenGL::Utils::MaterialBlock block(materialCache.Get(batch.material));
+        uniformBuffers.materialData.resize(uniformBuffers.materialData.size() + uniformBuffers.materialStride);
+        std::memcpy(uniformBuffers.materialData.data() + it->second, &block, sizeof(block));
+    }
+
+    if (uniformBuffers.materialData.empty())
+        return;
+    auto size = static_cast<GLsizeiptr>(uniformBuffers.materialData.size());
+    uniformBuffers.materials.Reserve(size);
+    uniformBuffers.materials.Update(uniformBuffers.materialData.data(), size);
 }
 
 void ES::Plugin::OpenGL::System::RenderMeshes(ES::Engine::Core &core)
 {
-    auto &view = core.GetResource<Resource::Camera>().view;
-    auto &projection = core.GetResource<Resource::Camera>().projection;
+    auto &camera = core.GetResource<Resource::Camera>();
+    auto &renderQueue = core.GetResource<Resource::RenderQueue>();
+    auto &uniformBuffers = core.GetResource<Resource::UniformBuffers>();
+    auto &shaderManager = core.GetResource<Resource::ShaderManager>();
+    auto &materialCache = core.GetResource<Resource::MaterialCache>();
+    auto &textureManager = core.GetResource<Resource::TextureManager>();
+    auto &glBufferManager = core.GetResource<Resource::GLMeshBufferManager>();
 
-    core.GetRegistry()
-        .view<Component::ModelHandle, ES::Plugin::Object::Component::Transform, ES::Plugin::Object::Component::Mesh,
-              Component::MaterialHandle>()
-        .each([&](auto entity, Component::ModelHandle &modelHandle, ES::Plugin::Object::Component::Transform &transform,
-                  ES::Plugin::Object::Component::Mesh &mesh, Component::MaterialHandle &materialHandle) {
-            auto shaderHandle = ES::Engine::Entity(entity).TryGetComponent<Component::ShaderHandle>(core);
-            auto shaderId = shaderHandle ? shaderHandle->id : entt::hashed_string{"default"};
-            auto &shader = core.GetResource<Resource::ShaderManager>().Get(shaderId);
-            const auto &material = core.GetResource<Resource::MaterialCache>().Get(materialHandle.id);
-            const auto &glBuffer = core.GetResource<Resource::GLMeshBufferManager>().Get(modelHandle.id);
-            shader.use();
-            LoadMaterial(shader, material);
-            glm::mat4 modelmat = transform.getTransformationMatrix();
-            glm::mat4 mvp = projection * view * modelmat;
-            auto nmat = glm::mat3(glm::transpose(glm::inverse(modelmat))); // normal matrix
-            glUniformMatrix3fv(shader.uniform("NormalMatrix"), 1, GL_FALSE, glm::value_ptr(nmat));
-            glUniformMatrix4fv(shader.uniform("ModelMatrix"), 1, GL_FALSE, glm::value_ptr(modelmat));
-            glUniformMatrix4fv(shader.uniform("MVP"), 1, GL_FALSE, glm::value_ptr(mvp));
-            BindTextureIfNeeded(core, entity);
-            glBuffer.Draw(mesh);
-            shader.disable();
-        });
+    renderQueue.Clear();
+    auto &registry = core.GetRegistry();
+    for (entt::entity entity : core.GetResource<Resource::MeshCulling>().visible)
+    {
+        const auto &[modelHandle, worldMatrix, materialHandle] =
+            registry.get<Component::ModelHandle, ES::Plugin::Object::Component::WorldMatrix, Component::MaterialHandle>(
+                entity);
+        auto shaderHandle = registry.try_get<Component::ShaderHandle>(entity);
+        auto textureHandle = registry.try_get<Component::TextureHandle>(entity);
+        auto meshLOD = registry.try_get<Component::MeshLOD>(entity);
+        const entt::hashed_string &model =
+            meshLOD && meshLOD->current > 0 ? meshLOD->models[meshLOD->current] : modelHandle.id;
+        renderQueue.Submit(shaderHandle ? shaderHandle->id : entt::hashed_string{"default"}, materialHandle.id,
+                           textureHandle ? textureHandle->id : entt::hashed_string{}, textureHandle != nullptr, model,
+                           worldMatrix.model, worldMatrix.normal);
+    }
+    renderQueue.Build();
+    UploadMaterials(uniformBuffers, materialCache, renderQueue.GetBatches());
+
+    glm::mat4 viewProjection = camera.projection * camera.view;
+    const Resource::RenderBatch *previous = nullptr;
+    Utils::ShaderProgram *shader = nullptr;
+    std::optional<MeshUniforms> uniforms;
+    bool instancing = false;
+    bool materialBlock = false;
+
+    // Batches are sorted by shader, then material, then texture: only bind what changed since the previous batch
+    for (const auto &batch : renderQueue.GetBatches())
+    {
+        bool shaderChanged = previous == nullptr || previous->shader.value() != batch.shader.value();
+        if (shaderChanged)
+        {
+            shader = &shaderManager.Get(batch.shader);
+            shader->use();
+            instancing = shader->isInstanced();
+            materialBlock = shader->hasUniformBlock("MaterialBlock");
+            uniforms.emplace(*shader);
+        }
+        if (shaderChanged || previous->material.value() != batch.material.value())
+        {
+            if (materialBlock)
+                uniformBuffers.materials.BindRange(uniformBuffers.materialOffsets.at(batch.material.value()),
+                                                   sizeof(Utils::MaterialBlock));
+            else
+                LoadMaterial(*uniforms, materialCache.Get(batch.material));
+        }
+        if (batch.hasTexture &&
+            (shaderChanged || !previous->hasTexture || previous->texture.value() != batch.texture.value()))
+        {
+            textureManager.Get(batch.texture).Bind();
+        }
+        previous = &batch;
+
+        auto &glBuffer = glBufferManager.Get(batch.model);
+        if (!instancing)
+        {
+            DrawBatchWithoutInstancing(*uniforms, glBuffer, batch, renderQueue.GetInstances(), viewProjection);
+            continue;
+        }
+        glBuffer.SetInstanceBuffer(renderQueue.GetInstanceBuffer());
+        glBuffer.DrawInstanced(batch.instanceCount, batch.firstInstance);
+    }
+
+    if (shader != nullptr)
+    {
+        shader->disable();
+    }
 }
 
 void ES::Plugin::OpenGL::System::RenderText(ES::Engine::Core &core)
@@ -81,7 +205,7 @@ void ES::Plugin::OpenGL::System::RenderText(ES::Engine::Core &core)
             auto fontHandle = ES::Engine::Entity(entity).TryGetComponent<Component::FontHandle>(core);
             auto shaderHandle = ES::Engine::Entity(entity).TryGetComponent<Component::ShaderHandle>(core);
             auto fontId = fontHandle ? fontHandle->id : entt::hashed_string{"textDefault"};
-            auto shaderId = shaderHandle ? shaderHandle->id : entt::hashed_string{"default"};
+            auto shaderId = shaderHandle ? shaderHandle->id : entt::hashed_string{"textDefault"};
             const auto &font = core.GetResource<Resource::FontManager>().Get(fontId);
             auto &shader = core.GetResource<Resource::ShaderManager>().Get(shaderId);
 
@@ -101,37 +225,66 @@ void ES::Plugin::OpenGL::System::RenderText(ES::Engine::Core &core)
 
 void ES::Plugin::OpenGL::System::RenderSprites(ES::Engine::Core &core)
 {
-    auto &view = core.GetResource<Resource::Camera>().view;
-
     auto &size = core.GetResource<Resource::Camera>().size;
+    auto &batcher = core.GetResource<Resource::SpriteBatcher>();
+    const auto &atlas = core.GetResource<Resource::SpriteAtlas>();
+    auto &textureManager = core.GetResource<Resource::TextureManager>();
+    auto &shaderManager = core.GetResource<Resource::ShaderManager>();
 
     glm::mat4 projection = glm::ortho(0.0f, size.x, 0.f, size.y, -1.0f, 1.0f);
 
-    core.GetRegistry().view<Component::Sprite, ES::Plugin::Object::Component::Transform>().each(
-        [&](auto entity, Component::Sprite &sprite, ES::Plugin::Object::Component::Transform &transform) {
-            auto spriteHandle = ES::Engine::Entity(entity).TryGetComponent<Component::SpriteHandle>(core);
+    batcher.Clear();
+    core.GetRegistry().view<Component::Sprite, ES::Plugin::Object::Component::WorldMatrix>().each(
+        [&](auto entity, Component::Sprite &sprite, ES::Plugin::Object::Component::WorldMatrix &worldMatrix) {
             auto shaderHandle = ES::Engine::Entity(entity).TryGetComponent<Component::ShaderHandle>(core);
-            auto spriteId = spriteHandle ? spriteHandle->id : entt::hashed_string{"2DDefault"};
-            auto shaderId = shaderHandle ? shaderHandle->id : entt::hashed_string{"default"};
-            const auto &glBuffer = core.GetResource<Resource::GLSpriteBufferManager>().Get(spriteId);
-            auto &shader = core.GetResource<Resource::ShaderManager>().Get(shaderId);
-
-            shader.use();
-
-            glUniform4f(shader.uniform("color"), sprite.color.red, sprite.color.green, sprite.color.blue,
-                        sprite.color.alpha);
-            glUniformMatrix4fv(shader.uniform("model"), 1, GL_FALSE,
-                               glm::value_ptr(transform.getTransformationMatrix()));
-            glUniformMatrix4fv(shader.uniform("projection"), 1, GL_FALSE, glm::value_ptr(projection));
+            auto textureHandle = ES::Engine::Entity(entity).TryGetComponent<Component::TextureHandle>(core);
+            auto shaderId = shaderHandle ? shaderHandle->id : entt::hashed_string{"2DDefault"};
 
-            Component::TextureHandle *textureHandle =
-                ES::Engine::Entity(entity).TryGetComponent<Component::TextureHandle>(core);
+            // Untextured sprites and sprites packed in the atlas all share the atlas texture
+            GLuint texture = atlas.GetTexture();
+            glm::vec4 uvRegion = atlas.GetWhiteRegion();
             if (textureHandle)
-                core.GetResource<Resource::TextureManager>().Get(textureHandle->id).Bind();
+            {
+                if (const glm::vec4 *region = atlas.Find(textureHandle->id.value()))
+                {
+                    uvRegion = *region;
+                }
+                else
+                {
+                    texture = textureManager.Get(textureHandle->id).GetID();
+                    uvRegion = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+                }
+            }
 
-            glBuffer.Draw();
-            shader.disable();
+            batcher.Submit(shaderId, texture, worldMatrix.model, sprite.rect.size, uvRegion,
+                           glm::vec4(sprite.color.red, sprite.color.green, sprite.color.blue, sprite.color.alpha));
         });
+    batcher.Upload();
+
+    const Resource::SpriteDrawCall *previous = nullptr;
+    Utils::ShaderProgram *shader = nullptr;
+    glActiveTexture(GL_TEXTURE0);
+    for (const auto &drawCall : batcher.GetDrawCalls())
+    {
+        if (previous == nullptr || previous->shader.value() != drawCall.shader.value())
+        {
+            shader = &shaderManager.Get(drawCall.shader);
+            shader->use();
+            shader->getUniform<glm::mat4>("projection").Set(projection);
+            shader->getUniform<int>("Texture").Set(0);
+        }
+        if (previous == nullptr || previous->texture != drawCall.texture)
+        {
+            glBindTexture(GL_TEXTURE_2D, drawCall.texture);
+        }
+        previous = &drawCall;
+        batcher.Draw(drawCall);
+    }
+
+    if (shader != nullptr)
+    {
+        shader->disable();
+    }
 }
 
 void ES::Plugin::OpenGL::System::CreateCamera(ES::Engine::Core &core)
@@ -139,6 +292,28 @@ void ES::Plugin::OpenGL::System::CreateCamera(ES::Engine::Core &core)
     core.RegisterResource<Resource::Camera>(Resource::Camera(DEFAULT_WIDTH, DEFAULT_HEIGHT));
 }
 
+void ES::Plugin::OpenGL::System::CreateRenderQueue(ES::Engine::Core &core)
+{
+    core.RegisterResource<Resource::RenderQueue>(Resource::RenderQueue());
+}
+
+void ES::Plugin::OpenGL::System::CreateUniformBuffers(ES::Engine::Core &core)
+{
+    auto &uniformBuffers = core.RegisterResource<Resource::UniformBuffers>({});
+    uniformBuffers.camera.Create(Utils::CameraBlock::BINDING, sizeof(Utils::CameraBlock));
+    uniformBuffers.lights.Create(Utils::LightBlock::BINDING, sizeof(Utils::LightBlock));
+
+    GLsizeiptr alignment = Utils::UniformBuffer::GetOffsetAlignment();
+    uniformBuffers.materialStride = (sizeof(Utils::MaterialBlock) + alignment - 1) / alignment * alignment;
+    uniformBuffers.materials.Create(Utils::MaterialBlock::BINDING, uniformBuffers.materialStride * 16);
+}
+
+void ES::Plugin::OpenGL::System::CreateSpriteBatcher(ES::Engine::Core &core)
+{
+    core.RegisterResource<Resource::SpriteBatcher>(Resource::SpriteBatcher());
+    core.RegisterResource<Resource::SpriteAtlas>(Resource::SpriteAtlas()).Create();
+}
+
 void ES::Plugin::OpenGL::System::LoadMaterialCache(ES::Engine::Core &core)
 {
     auto &materialCache = core.RegisterResource<Resource::MaterialCache>({});
@@ -149,46 +324,29 @@ void ES::Plugin::OpenGL::System::UpdateMatrices(ES::Engine::Core &core)
 {
     auto &cam = core.GetResource<Resource::Camera>();
     cam.view = glm::lookAt(cam.viewer.getViewPoint(), cam.viewer.getViewCenter(), cam.viewer.getUpVector());
-    cam.projection = glm::perspective(glm::radians(45.0f), cam.size.x / cam.size.y, 0.1f, 100.0f);
+    cam.projection = glm::perspective(glm::radians(45.0f), cam.size.x / cam.size.y, cam.zNear, cam.zFar);
 }
 
-void ES::Plugin::OpenGL::System::SetupLights(ES::Engine::Core &core)
+void ES::Plugin::OpenGL::System::SetupCamera(ES::Engine::Core &core)
 {
-    auto &shader = core.GetResource<Resource::ShaderManager>().Get(entt::hashed_string{"default"});
-
-    std::array<ES::Plugin::OpenGL::Utils::Light, 5> light = {
-        ES::Plugin::OpenGL::Utils::Light{glm::vec4(0, 0, 0, 1), glm::vec3(0.0f, 0.8f, 0.8f)},
-        ES::Plugin::OpenGL::Utils::Light{glm::vec4(0, 0, 0, 1), glm::vec3(0.0f, 0.0f, 0.8f)},
-        ES::Plugin::OpenGL::Utils::Light{glm::vec4(0, 0, 0, 1), glm::vec3(0.8f, 0.0f, 0.0f)},
-        ES::Plugin::OpenGL::Utils::Light{glm::vec4(0, 0, 0, 1), glm::vec3(0.0f, 0.8f, 0.0f)},
-        ES::Plugin::OpenGL::Utils::Light{glm::vec4(0, 0, 0, 1), glm::vec3(0.8f, 0.8f, 0.8f)}
-    };
-
-    float nbr_lights = 5.f;
-    float scale = 2.f * glm::pi<float>() / nbr_lights;
-
-    light[0].position = glm::vec4(5.f * cosf(scale * 0.f), 5.f, 5.f * sinf(scale * 0.f), 1.f);
-    light[1].position = glm::vec4(5.f * cosf(scale * 1.f), 5.f, 5.f * sinf(scale * 1.f), 1.f);
-    light[2].position = glm::vec4(5.f * cosf(scale * 2.f), 5.f, 5.f * sinf(scale * 2.f), 1.f);
-    light[3].position = glm::vec4(5.f * cosf(scale * 3.f), 5.f, 5.f * sinf(scale * 3.f), 1.f);
-    light[4].position = glm::vec4(5.f * cosf(scale * 4.f), 5.f, 5.f * sinf(scale * 4.f), 1.f);
-
-    shader.use();
-    for (int i = 0; i < 5; i++)
-    {
-        glUniform4fv(shader.uniform(fmt::format("Light[{}].Position", i).c_str()), 1,
-                     glm::value_ptr(light[i].position));
-        glUniform3fv(shader.uniform(fmt::format("Light[{}].Intensity", i).c_str()), 1,
-                     glm::value_ptr(light[i].intensity));
-    }
-    shader.disable();
+    auto &camera = core.GetResource<Resource::Camera>();
+    Utils::CameraBlock block;
+    block.viewProjection = camera.projection * camera.view;
+    block.position = camera.viewer.getViewPoint();
+
+    auto &cameraBuffer = core.GetResource<Resource::UniformBuffers>().camera;
+    cameraBuffer.Update(block);
+    cameraBuffer.Bind();
 }
 
-void ES::Plugin::OpenGL::System::SetupCamera(ES::Engine::Core &core)
+void ES::Plugin::OpenGL::System::DestroyRenderResources(ES::Engine::Core &core)
 {
-    auto &shaderProgram = core.GetResource<Resource::ShaderManager>().Get(entt::hashed_string{"default"});
-    shaderProgram.use();
-    glUniform3fv(shaderProgram.uniform("CamPos"), 1,
-                 glm::value_ptr(core.GetResource<Resource::Camera>().viewer.getViewPoint()));
-    shaderProgram.disable();
+    core.GetResource<Resource::RenderQueue>().Destroy();
+    core.GetResource<Resource::SpriteBatcher>().Destroy();
+    core.GetResource<Resource::SpriteAtlas>().Destroy();
+
+    auto &clusters = core.GetResource<Resource::LightClusters>();
+    clusters.lightBuffer.Destroy();
+    clusters.clusterBuffer.Destroy();
+    clusters.lightIndexBuffer.Destroy();
 }
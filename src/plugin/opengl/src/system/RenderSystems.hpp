@@ -11,8 +11,15 @@ void RenderText(ES::Engine::Core &core);
 void RenderSprites(ES::Engine::Core &core);
 
 void CreateCamera(ES::Engine::Core &core);
+void CreateRenderQueue(ES::Engine::Core &core);
+void CreateUniformBuffers(ES::Engine::Core &core);
+void CreateSpriteBatcher(ES::Engine::Core &core);
 void LoadMaterialCache(ES::Engine::Core &core);
 void UpdateMatrices(ES::Engine::Core &core);
-void SetupLights(ES::Engine::Core &core);
 void SetupCamera(ES::Engine::Core &core);
+/**
+ * @brief Delete the OpenGL objects of the RenderQueue, the SpriteBatcher, the SpriteAtlas and the LightClusters,
+ * while the context is still alive.
+ */
+void DestroyRenderResources(ES::Engine::Core &core);
 } // namespace ES::Plugin::OpenGL::System
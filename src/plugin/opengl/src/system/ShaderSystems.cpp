@@ -1,6 +1,12 @@
 #include "ShaderSystems.hpp"
+#include "ShaderBinaryCache.hpp"
 #include "ShaderManager.hpp"
 
+void ES::Plugin::OpenGL::System::CreateShaderBinaryCache(ES::Engine::Core &core)
+{
+    core.RegisterResource<Resource::ShaderBinaryCache>(Resource::ShaderBinaryCache());
+}
+
 void ES::Plugin::OpenGL::System::LoadDefaultShader(ES::Engine::Core &core)
 {
     const char *vertexShader = R"(
@@ -8,19 +14,23 @@ void ES::Plugin::OpenGL::System::LoadDefaultShader(ES::Engine::Core &core)
 
         layout (location = 0) in vec4 VertexPosition;
         layout (location = 1) in vec3 VertexNormal;
+        layout (location = 3) in mat4 InstanceModelMatrix;
+        layout (location = 7) in mat3 InstanceNormalMatrix;
 
         out vec3 Position;
         out vec3 Normal;
 
-        uniform mat4 ModelMatrix;
-        uniform mat3 NormalMatrix;
-        uniform mat4 MVP;
+        layout (std140, binding = 0) uniform CameraBlock {
+            mat4 ViewProjection;
+            vec3 CamPos;
+        };
 
         void main()
         {
-            Normal = normalize(NormalMatrix * VertexNormal);
-            Position = (ModelMatrix * VertexPosition).xyz;
-            gl_Position = MVP * VertexPosition;
+            vec4 worldPosition = InstanceModelMatrix * VertexPosition;
+            Normal = normalize(InstanceNormalMatrix * VertexNormal);
+            Position = worldPosition.xyz;
+            gl_Position = ViewProjection * worldPosition;
         }
     )";
 
@@ -30,42 +40,67 @@ void ES::Plugin::OpenGL::System::LoadDefaultShader(ES::Engine::Core &core)
         in vec3 Position;
         in vec3 Normal;
 
-        uniform vec3 CamPos;
+        layout (std140, binding = 0) uniform CameraBlock {
+            mat4 ViewProjection;
+            vec3 CamPos;
+        };
 
         struct LightInfo {
-            vec4 Position; // Light position in eye coords.
+            vec4 Position; // World position and radius, or direction toward the light for directional lights
             vec3 Intensity; // Light intensity
         };
-        uniform LightInfo Light[5];
+        layout (std140, binding = 1) uniform LightBlock {
+            mat4 View;
+            uvec4 ClusterGrid; // Number of clusters, and number of directional lights in w
+            vec4 ClusterScale; // Size of a cluster in pixels, then scale and bias giving the slice of a depth
+            vec3 Ambient;
+        };
+        layout (std430, binding = 0) readonly buffer LightBuffer {
+            LightInfo Lights[];
+        };
+        layout (std430, binding = 1) readonly buffer ClusterBuffer {
+            uvec2 Clusters[]; // Offset and count of the lights of every cluster in LightIndices
+        };
+        layout (std430, binding = 2) readonly buffer LightIndexBuffer {
+            uint LightIndices[];
+        };
 
-        struct MaterialInfo {
+        layout (std140, binding = 2) uniform MaterialBlock {
             vec3 Ka; // Ambient reflectivity
             vec3 Kd; // Diffuse reflectivity
             vec3 Ks; // Specular reflectivity
             float Shiness; // Specular shininess factor (phong exponent)
-        };
-        uniform MaterialInfo Material;
+        } Material;
 
         out vec4 FragColor;
 
+        vec3 Shade(vec3 Intensity, vec3 L, vec3 V) {
+            vec3 diffuse = Material.Kd * Intensity * max( dot(L, Normal), 0.0);
+            vec3 HalfwayVector = normalize(V + L);
+            vec3 specular = Material.Ks * Intensity * pow( max( dot( HalfwayVector, Normal), 0.0), Material.Shiness);
+            return diffuse + specular;
+        }
+
         void main() {
-            vec3 finalColor = vec3(0,0,0);
-            vec3 ambient = Material.Ka * Light[0].Intensity;
-            for (int i = 0; i < 4; i++) {
-                vec3 L = normalize(Light[i].Position.xyz - Position);
-                vec3 V = normalize(CamPos - Position);
-                vec3 diffuse = Material.Kd * Light[i].Intensity * max( dot(L, Normal), 0.0);
-                vec3 HalfwayVector = normalize(V + L);
-                vec3 specular = Material.Ks * Light[i].Intensity * pow( max( dot( HalfwayVector, Normal), 0.0), Material.Shiness);
-                finalColor = finalColor + diffuse + specular;
-            }
-            vec3 L = normalize(Light[4].Position.xyz);
             vec3 V = normalize(CamPos - Position);
-            vec3 diffuse = Material.Kd * Light[4].Intensity * max( dot(L, Normal), 0.0);
-            vec3 HalfwayVector = normalize(V + L);
-            vec3 specular = Material.Ks * Light[4].Intensity * pow( max( dot( HalfwayVector, Normal), 0.0), Material.Shiness);
-            finalColor = finalColor + diffuse + specular;
-            finalColor = ambient + finalColor;
+            vec3 finalColor = Material.Ka * Ambient;
+            for (uint i = 0; i < ClusterGrid.w; i++) {
+                finalColor += Shade(Lights[i].Intensity, normalize(Lights[i].Position.xyz), V);
+            }
+
+            float depth = -(View * vec4(Position, 1.0)).z;
+            uvec3 cluster = uvec3(uvec2(gl_FragCoord.xy / ClusterScale.xy),
+                                  uint(max(log(depth) * ClusterScale.z + ClusterScale.w, 0.0)));
+            cluster = min(cluster, ClusterGrid.xyz - 1u);
+            uvec2 range = Clusters[cluster.x + ClusterGrid.x * (cluster.y + ClusterGrid.y * cluster.z)];
+            for (uint i = range.x; i < range.x + range.y; i++) {
+                LightInfo light = Lights[ClusterGrid.w + LightIndices[i]];
+                vec3 toLight = light.Position.xyz - Position;
+                float distance = length(toLight);
+                // Fades out at the radius of the light, so that it doesn't end sharply at the edge of its clusters
+                float fade = clamp(1.0 - pow(distance / light.Position.w, 4.0), 0.0, 1.0);
+                finalColor += Shade(light.Intensity, toLight / distance, V) * fade * fade;
+            }
             FragColor = vec4(finalColor, 1.0);
         }
     )";
@@ -73,7 +108,7 @@ void ES::Plugin::OpenGL::System::LoadDefaultShader(ES::Engine::Core &core)
     auto &shaderManager = core.GetResource<Resource::ShaderManager>();
     Utils::ShaderProgram &sp = shaderManager.Add(entt::hashed_string{"default"});
     sp.Create();
-    sp.initFromStrings(vertexShader, fragmentShader);
+    sp.initFromStrings(vertexShader, fragmentShader, core.GetResource<Resource::ShaderBinaryCache>());
 }
 
 void ES::Plugin::OpenGL::System::LoadDefaultTextShader(ES::Engine::Core &core)
@@ -109,62 +144,48 @@ void ES::Plugin::OpenGL::System::LoadDefaultTextShader(ES::Engine::Core &core)
     auto &shaderManager = core.GetResource<Resource::ShaderManager>();
     Utils::ShaderProgram &sp = shaderManager.Add(entt::hashed_string{"textDefault"});
     sp.Create();
-    sp.initFromStrings(vertexShader, fragmentShader);
+    sp.initFromStrings(vertexShader, fragmentShader, core.GetResource<Resource::ShaderBinaryCache>());
 }
 
 void ES::Plugin::OpenGL::System::LoadDefaultSpriteShader(ES::Engine::Core &core)
 {
     const char *vertexShader = R"(
         #version 330 core
-        layout (location = 0) in vec3 aPos;
+        layout (location = 0) in vec3 Position;
+        layout (location = 1) in vec2 TexCoords;
+        layout (location = 2) in vec4 Color;
 
-        uniform mat4 model;
-        uniform mat4 projection;
+        out vec2 FragTexCoords;
+        out vec4 FragTint;
 
+        uniform mat4 projection;
 
         void main()
         {
-            // gl_Position = vec4(aPos, 1.0) + vec4(0.5, 0.5, 0.0, 0.0);
-            gl_Position = projection * model * vec4(aPos, 1.0);
+            FragTexCoords = TexCoords;
+            FragTint = Color;
+            gl_Position = projection * vec4(Position, 1.0);
         }
     )";
 
     const char *fragmentShader = R"(
         #version 330 core
+        in vec2 FragTexCoords;
+        in vec4 FragTint;
         out vec4 FragColor;
-        uniform vec4 color;
+
+        uniform sampler2D Texture;
+
         void main()
         {
-            FragColor = color;
+            FragColor = FragTint * texture(Texture, FragTexCoords);
         }
     )";
 
     auto &shaderManager = core.GetResource<Resource::ShaderManager>();
     Utils::ShaderProgram &sp = shaderManager.Add(entt::hashed_string{"2DDefault"});
     sp.Create();
-    sp.initFromStrings(vertexShader, fragmentShader);
-}
-
-void ES::Plugin::OpenGL::System::SetupShaderUniforms(ES::Engine::Core &core)
-{
-    auto &m_shaderProgram = core.GetResource<Resource::ShaderManager>().Get(entt::hashed_string{"default"});
-
-    // Add uniforms
-    m_shaderProgram.addUniform("MVP");
-    m_shaderProgram.addUniform("ModelMatrix");  // View*Model : mat4
-    m_shaderProgram.addUniform("NormalMatrix"); // Refer next slide : mat3
-
-    for (int i = 0; i < 5; i++)
-    {
-        m_shaderProgram.addUniform(fmt::format("Light[{}].Position", i));
-        m_shaderProgram.addUniform(fmt::format("Light[{}].Intensity", i));
-    }
-    m_shaderProgram.addUniform("Material.Ka");
-    m_shaderProgram.addUniform("Material.Kd");
-    m_shaderProgram.addUniform("Material.Ks");
-    m_shaderProgram.addUniform("Material.Shiness");
-
-    m_shaderProgram.addUniform("CamPos");
+    sp.initFromStrings(vertexShader, fragmentShader, core.GetResource<Resource::ShaderBinaryCache>());
 }
 
 void ES::Plugin::OpenGL::System::SetupTextShaderUniforms(ES::Engine::Core &core)
@@ -180,7 +201,6 @@ void ES::Plugin::OpenGL::System::SetupSpriteShaderUniforms(ES::Engine::Core &cor
 {
     auto &m_shaderProgram = core.GetResource<Resource::ShaderManager>().Get(entt::hashed_string{"2DDefault"});
 
-    m_shaderProgram.addUniform("color");
-    m_shaderProgram.addUniform("model");
     m_shaderProgram.addUniform("projection");
+    m_shaderProgram.addUniform("Texture");
 }
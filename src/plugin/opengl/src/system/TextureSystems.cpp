@@ -0,0 +1,13 @@
+#include "TextureSystems.hpp"
+#include "TextureLoader.hpp"
+#include "TextureManager.hpp"
+
+void ES::Plugin::OpenGL::System::CreateTextureLoader(ES::Engine::Core &core)
+{
+    core.RegisterResource<Resource::TextureLoader>(Resource::TextureLoader());
+}
+
+void ES::Plugin::OpenGL::System::UploadTextures(ES::Engine::Core &core)
+{
+    core.GetResource<Resource::TextureLoader>().Upload(core.GetResource<Resource::TextureManager>());
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::OpenGL::System {
+void CreateTextureLoader(ES::Engine::Core &core);
+/**
+ * @brief Upload the textures decoded by the TextureLoader since the last frame, within its budget.
+ */
+void UploadTextures(ES::Engine::Core &core);
+} // namespace ES::Plugin::OpenGL::System
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <limits>
+#include <span>
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief Axis aligned bounding box. A default constructed box is empty, merging anything into it returns that thing.
+ */
+struct BoundingBox {
+    glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+
+    BoundingBox() = default;
+    BoundingBox(const glm::vec3 &min, const glm::vec3 &max) : min(min), max(max) {}
+
+    /**
+     * @brief Get the box holding every point.
+     */
+    static BoundingBox FromPoints(std::span<const glm::vec3> points)
+    {
+        BoundingBox box;
+        for (const auto &point : points)
+        {
+            box.min = glm::min(box.min, point);
+            box.max = glm::max(box.max, point);
+        }
+        return box;
+    }
+
+    inline bool IsEmpty() const { return min.x > max.x || min.y > max.y || min.z > max.z; }
+    inline glm::vec3 GetCenter() const { return (min + max) * 0.5f; }
+    inline glm::vec3 GetExtents() const { return (max - min) * 0.5f; }
+
+    inline float GetSurfaceArea() const
+    {
+        glm::vec3 size = max - min;
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    inline void Merge(const BoundingBox &other)
+    {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    /**
+     * @brief Get the box holding this box once transformed, without transforming its 8 corners.
+     *
+     * @param matrix An affine transformation.
+     */
+    BoundingBox Transformed(const glm::mat4 &matrix) const
+    {
+        if (IsEmpty())
+            return *this;
+
+        glm::vec3 center = glm::vec3(matrix * glm::vec4(GetCenter(), 1.0f));
+        glm::vec3 extents = GetExtents();
+        glm::mat3 absolute(glm::abs(glm::vec3(matrix[0])), glm::abs(glm::vec3(matrix[1])),
+                           glm::abs(glm::vec3(matrix[2])));
+        glm::vec3 transformedExtents = absolute * extents;
+        return BoundingBox(center - transformedExtents, center + transformedExtents);
+    }
+};
+} // namespace ES::Plugin::OpenGL::Utils
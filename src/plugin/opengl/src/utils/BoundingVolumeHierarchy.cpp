@@ -0,0 +1,213 @@
+#include "BoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+void BoundingVolumeHierarchy::Build(std::span<const BoundingBox> boxes)
+{
+    _nodes.clear();
+    _items.resize(boxes.size());
+    for (uint32_t i = 0; i < _items.size(); i++)
+    {
+        _items[i] = i;
+    }
+
+    if (!_items.empty())
+    {
+        _nodes.reserve(2 * (_items.size() / MAX_LEAF_SIZE + 1));
+        BuildNode(boxes, 0, static_cast<uint32_t>(_items.size()));
+    }
+
+    _centerX.resize(_items.size());
+    _centerY.resize(_items.size());
+    _centerZ.resize(_items.size());
+    _extentX.resize(_items.size());
+    _extentY.resize(_items.size());
+    _extentZ.resize(_items.size());
+    for (uint32_t i = 0; i < _items.size(); i++)
+    {
+        SetItemBounds(i, boxes[_items[i]]);
+    }
+
+    _builtSurfaceArea = _nodes.empty() ? 0.0f : _nodes[0].box.GetSurfaceArea();
+}
+
+uint32_t BoundingVolumeHierarchy::BuildNode(std::span<const BoundingBox> boxes, uint32_t first, uint32_t count)
+{
+    auto index = static_cast<uint32_t>(_nodes.size());
+    _nodes.push_back(Node{BoundingBox(), first, count, 0});
+
+    BoundingBox bounds;
+    BoundingBox centers;
+    for (uint32_t i = first; i < first + count; i++)
+    {
+        const BoundingBox &box = boxes[_items[i]];
+        bounds.Merge(box);
+        glm::vec3 center = box.GetCenter();
+        centers.Merge(BoundingBox(center, center));
+    }
+    _nodes[index].box = bounds;
+
+    if (count <= MAX_LEAF_SIZE)
+        return index;
+
+    // Median split on the axis along which the centers are the most spread
+    glm::vec3 spread = centers.max - centers.min;
+    int axis = spread.x > spread.y ? (spread.x > spread.z ? 0 : 2) : (spread.y > spread.z ? 1 : 2);
+    uint32_t half = count / 2;
+    std::nth_element(_items.begin() + first, _items.begin() + first + half, _items.begin() + first + count,
+                     [&boxes, axis](uint32_t a, uint32_t b) {
+                         return boxes[a].GetCenter()[axis] < boxes[b].GetCenter()[axis];
+                     });
+
+    BuildNode(boxes, first, half);
+    uint32_t right = BuildNode(boxes, first + half, count - half);
+    _nodes[index].right = right;
+    return index;
+}
+
+void BoundingVolumeHierarchy::SetItemBounds(uint32_t item, const BoundingBox &box)
+{
+    glm::vec3 center = box.GetCenter();
+    glm::vec3 extents = box.GetExtents();
+    _centerX[item] = center.x;
+    _centerY[item] = center.y;
+    _centerZ[item] = center.z;
+    _extentX[item] = extents.x;
+    _extentY[item] = extents.y;
+    _extentZ[item] = extents.z;
+}
+
+void BoundingVolumeHierarchy::Refit(std::span<const BoundingBox> boxes)
+{
+    for (uint32_t i = 0; i < _items.size(); i++)
+    {
+        SetItemBounds(i, boxes[_items[i]]);
+    }
+
+    // Children are always stored after their parent
+    for (auto index = static_cast<uint32_t>(_nodes.size()); index-- > 0;)
+    {
+        Node &node = _nodes[index];
+        BoundingBox bounds;
+        if (node.IsLeaf())
+        {
+            for (uint32_t i = node.first; i < node.first + node.count; i++)
+            {
+                bounds.Merge(boxes[_items[i]]);
+            }
+        }
+        else
+        {
+            bounds = _nodes[index + 1].box;
+            bounds.Merge(_nodes[node.right].box);
+        }
+        node.box = bounds;
+    }
+}
+
+bool BoundingVolumeHierarchy::NeedsRebuild() const
+{
+    return !_nodes.empty() && _nodes[0].box.GetSurfaceArea() > _builtSurfaceArea * REBUILD_RATIO;
+}
+
+void BoundingVolumeHierarchy::AppendItems(const Node &node, std::vector<uint32_t> &visible) const
+{
+    visible.insert(visible.end(), _items.begin() + node.first, _items.begin() + node.first + node.count);
+}
+
+void BoundingVolumeHierarchy::CullNodes(const Frustum &frustum, std::vector<uint32_t> &stack,
+                                        std::vector<uint32_t> &visible) const
+{
+    std::array<uint8_t, MAX_LEAF_SIZE> leafVisible{};
+
+    while (!stack.empty())
+    {
+        const Node &node = _nodes[stack.back()];
+        stack.pop_back();
+
+        Frustum::Result result = frustum.Classify(node.box);
+        if (result == Frustum::Result::Outside)
+            continue;
+        if (result == Frustum::Result::Inside)
+        {
+            AppendItems(node, visible);
+            continue;
+        }
+        if (!node.IsLeaf())
+        {
+            stack.push_back(node.right);
+            stack.push_back(static_cast<uint32_t>(&node - _nodes.data()) + 1);
+            continue;
+        }
+
+        uint32_t first = node.first;
+        frustum.TestBatch(&_centerX[first], &_centerY[first], &_centerZ[first], &_extentX[first], &_extentY[first],
+                          &_extentZ[first], node.count, leafVisible.data());
+        for (uint32_t i = 0; i < node.count; i++)
+        {
+            if (leafVisible[i])
+                visible.push_back(_items[first + i]);
+        }
+    }
+}
+
+void BoundingVolumeHierarchy::Cull(const Frustum &frustum, std::vector<uint32_t> &visible,
+                                   ES::Utils::ThreadPool *threadPool) const
+{
+    visible.clear();
+    if (_nodes.empty())
+        return;
+
+    std::vector<uint32_t> stack{0};
+    std::size_t threadCount = threadPool != nullptr ? threadPool->GetThreadCount() : 1;
+    if (_items.size() < PARALLEL_CULL_THRESHOLD || threadCount < 2)
+    {
+        CullNodes(frustum, stack, visible);
+        return;
+    }
+
+    // Open the top of the tree until there are enough subtrees to keep every thread busy, then cull them in parallel
+    std::vector<uint32_t> subtrees;
+    std::size_t wantedSubtrees = threadCount * 4;
+    while (!stack.empty() && stack.size() + subtrees.size() < wantedSubtrees)
+    {
+        const Node &node = _nodes[stack.front()];
+        stack.erase(stack.begin());
+
+        Frustum::Result result = frustum.Classify(node.box);
+        if (result == Frustum::Result::Outside)
+            continue;
+        if (result == Frustum::Result::Inside)
+        {
+            AppendItems(node, visible);
+            continue;
+        }
+        if (node.IsLeaf())
+        {
+            subtrees.push_back(static_cast<uint32_t>(&node - _nodes.data()));
+            continue;
+        }
+        stack.push_back(static_cast<uint32_t>(&node - _nodes.data()) + 1);
+        stack.push_back(node.right);
+    }
+    subtrees.insert(subtrees.end(), stack.begin(), stack.end());
+
+    std::size_t taskCount = std::min(threadCount, subtrees.size());
+    std::vector<std::vector<uint32_t>> taskVisible(taskCount);
+    threadPool->ParallelFor(taskCount, [this, &frustum, &subtrees, &taskVisible, taskCount](std::size_t task) {
+        std::vector<uint32_t> taskStack;
+        for (std::size_t i = task; i < subtrees.size(); i += taskCount)
+        {
+            taskStack.push_back(subtrees[i]);
+            CullNodes(frustum, taskStack, taskVisible[task]);
+        }
+    });
+    for (const auto &indices : taskVisible)
+    {
+        visible.insert(visible.end(), indices.begin(), indices.end());
+    }
+}
+} // namespace ES::Plugin::OpenGL::Utils
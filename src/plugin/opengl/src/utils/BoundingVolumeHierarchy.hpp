@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BoundingBox.hpp"
+#include "Frustum.hpp"
+#include "ThreadPool.hpp"
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief Bounding volume hierarchy over a set of boxes, used to cull them against a frustum.
+ *
+ * The tree is built top-down by median splits, and refitted when the boxes move but the set of boxes is the same.
+ * A node fully inside the frustum accepts its whole subtree without testing it, and leaves crossing the frustum test
+ * their boxes as a batch, see Frustum::TestBatch. Large trees are culled by the threads of a ThreadPool.
+ */
+class BoundingVolumeHierarchy {
+  public:
+    /// @brief Maximum number of boxes in a leaf.
+    inline static constexpr uint32_t MAX_LEAF_SIZE = 8;
+    /// @brief Minimum number of boxes for the cull to be split across threads.
+    inline static constexpr std::size_t PARALLEL_CULL_THRESHOLD = 16384;
+    /// @brief The tree should be rebuilt once refits made its root this many times larger than when it was built.
+    inline static constexpr float REBUILD_RATIO = 2.0f;
+
+    BoundingVolumeHierarchy() = default;
+    ~BoundingVolumeHierarchy() = default;
+
+    /**
+     * @brief Build the tree over boxes, replacing the previous one.
+     */
+    void Build(std::span<const BoundingBox> boxes);
+
+    /**
+     * @brief Update the bounds of the tree, without changing its structure.
+     *
+     * @param boxes The new boxes, in the same order and the same number as when the tree was built.
+     */
+    void Refit(std::span<const BoundingBox> boxes);
+
+    /**
+     * @brief Check if refits degraded the tree enough for it to be worth rebuilding.
+     */
+    bool NeedsRebuild() const;
+
+    /**
+     * @brief Find the boxes at least partially inside a frustum.
+     *
+     * @param frustum The frustum.
+     * @param visible Filled with the indices of the visible boxes, in the order they were given to Build.
+     * Not sorted.
+     * @param threadPool Threads culling large trees, or nullptr to cull on the calling thread only.
+     */
+    void Cull(const Frustum &frustum, std::vector<uint32_t> &visible,
+              ES::Utils::ThreadPool *threadPool = nullptr) const;
+
+    inline std::size_t Size() const { return _items.size(); }
+
+  private:
+    struct Node {
+        BoundingBox box;
+        /// @brief First item of the subtree in _items.
+        uint32_t first = 0;
+        /// @brief Number of items of the subtree.
+        uint32_t count = 0;
+        /// @brief Index of the right child, the left one being right after this node. 0 for leaves.
+        uint32_t right = 0;
+
+        inline bool IsLeaf() const { return right == 0; }
+    };
+
+    uint32_t BuildNode(std::span<const BoundingBox> boxes, uint32_t first, uint32_t count);
+
+    void SetItemBounds(uint32_t item, const BoundingBox &box);
+
+    /**
+     * @brief Cull the subtrees of some nodes.
+     */
+    void CullNodes(const Frustum &frustum, std::vector<uint32_t> &stack, std::vector<uint32_t> &visible) const;
+
+    void AppendItems(const Node &node, std::vector<uint32_t> &visible) const;
+
+    std::vector<Node> _nodes;
+    /// @brief Indices of the boxes, in leaf order.
+    std::vector<uint32_t> _items;
+
+    /// @brief Centers and extents of the boxes in leaf order, as structure of arrays for Frustum::TestBatch.
+    std::vector<float> _centerX;
+    std::vector<float> _centerY;
+    std::vector<float> _centerZ;
+    std::vector<float> _extentX;
+    std::vector<float> _extentY;
+    std::vector<float> _extentZ;
+
+    float _builtSurfaceArea = 0.0f;
+};
+} // namespace ES::Plugin::OpenGL::Utils
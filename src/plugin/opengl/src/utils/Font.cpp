@@ -1,5 +1,6 @@
 #include "Font.hpp"
 #include "Logger.hpp"
+#include <algorithm>
 #include <array>
 #include <fmt/format.h>
 #include <fstream>
@@ -12,6 +13,15 @@ namespace ES::Plugin::OpenGL::Utils {
 
 Font::Font(const std::string &fontPath, int fontSize) { LoadFont(fontPath, fontSize); }
 
+Font::~Font()
+{
+    if (!atlasTexture)
+        return;
+
+    glDeleteTextures(1, &atlasTexture);
+    atlasTexture = 0;
+}
+
 void Font::LoadFont(const std::string &fontPath, int fontSize)
 {
     fontBuffer = std::make_shared<std::vector<unsigned char>>();
@@ -44,6 +54,14 @@ void Font::LoadFont(const std::string &fontPath, int fontSize)
     ascent = static_cast<int>(ascent * scale);
     descent = static_cast<int>(descent * scale);
 
+    // Render every glyph first, to know the size of the atlas
+    struct Glyph {
+        unsigned char *bitmap;
+        glm::ivec2 position;
+    };
+    std::array<Glyph, 96> glyphs{};
+    int atlasWidth = MIN_ATLAS_WIDTH;
+
     for (unsigned char c = 32; c < 128; c++)
     {
         int width;
@@ -52,18 +70,9 @@ void Font::LoadFont(const std::string &fontPath, int fontSize)
         int yOffset;
         unsigned char *bitmap =
             stbtt_GetCodepointBitmap(fontInfo.get(), 0, scale, c, &width, &height, &xOffset, &yOffset);
-
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, bitmap);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glyphs[c - 32].bitmap = bitmap;
+        // The atlas is at least as wide as its widest glyph, so that every glyph fits on a shelf
+        atlasWidth = std::max(atlasWidth, width + 2 * ATLAS_PADDING);
 
         int advance;
         int lsb;
@@ -71,16 +80,64 @@ void Font::LoadFont(const std::string &fontPath, int fontSize)
         float scaledAdvance = (advance * scale);
 
         Character character;
-        character.textureID = texture;
         character.size = {(float) width, (float) height};
         character.bearing = {(float) xOffset, (float) yOffset};
         character.advance = scaledAdvance;
 
         characters[c] = character;
+    }
+
+    // Then pack them on shelves
+    int cursorX = 0;
+    int shelfY = 0;
+    int shelfHeight = 0;
+    for (unsigned char c = 32; c < 128; c++)
+    {
+        const glm::ivec2 &size = characters[c].size;
+        if (cursorX + size.x + 2 * ATLAS_PADDING > atlasWidth)
+        {
+            shelfY += shelfHeight;
+            shelfHeight = 0;
+            cursorX = 0;
+        }
+        glyphs[c - 32].position = {cursorX + ATLAS_PADDING, shelfY + ATLAS_PADDING};
+        cursorX += size.x + 2 * ATLAS_PADDING;
+        shelfHeight = std::max(shelfHeight, size.y + 2 * ATLAS_PADDING);
+    }
 
-        stbtt_FreeBitmap(bitmap, nullptr);
+    // Then copy them into the atlas and upload it once
+    int atlasHeight = std::max(shelfY + shelfHeight, 1);
+    std::vector<unsigned char> pixels(static_cast<std::size_t>(atlasWidth) * atlasHeight, 0);
+    for (unsigned char c = 32; c < 128; c++)
+    {
+        const Glyph &glyph = glyphs[c - 32];
+        Character &character = characters[c];
+        for (int row = 0; row < character.size.y; row++)
+        {
+            std::copy_n(glyph.bitmap + row * character.size.x, character.size.x,
+                        pixels.begin() + (glyph.position.y + row) * atlasWidth + glyph.position.x);
+        }
+        character.uvRegion = glm::vec4(static_cast<float>(glyph.position.x) / atlasWidth,
+                                       static_cast<float>(glyph.position.y) / atlasHeight,
+                                       static_cast<float>(glyph.position.x + character.size.x) / atlasWidth,
+                                       static_cast<float>(glyph.position.y + character.size.y) / atlasHeight);
+        stbtt_FreeBitmap(glyph.bitmap, nullptr);
     }
 
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glGenTextures(1, &atlasTexture);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, atlasWidth, atlasHeight, 0, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
     ES::Utils::Log::Info(fmt::format("Font loaded: {}", fontPath));
 }
 
@@ -12,7 +12,8 @@
 namespace ES::Plugin::OpenGL::Utils {
 
 struct Character {
-    GLuint textureID;
+    /// @brief Region of the glyph in the atlas texture of its font, as (u0, v0, u1, v1).
+    glm::vec4 uvRegion;
     glm::ivec2 size;
     glm::ivec2 bearing;
     GLuint advance;
@@ -21,14 +22,29 @@ struct Character {
 class Font {
   public:
     explicit Font(const std::string &fontPath, int fontSize);
-    ~Font() = default;
+    ~Font();
+
+    // The atlas texture is deleted with the font, it can't be shared by copies
+    Font(const Font &) = delete;
+    Font &operator=(const Font &) = delete;
 
     inline const Character &GetCharacter(char c) const { return characters.at(c); }
 
     inline bool HasCharacter(char c) const { return characters.contains(c); }
 
+    /**
+     * @brief Get the texture holding every glyph of the font, in its red channel.
+     */
+    inline GLuint GetAtlasTexture() const { return atlasTexture; }
+
   private:
+    /// @brief Minimum width of the glyph atlas, its height depends on the size of the glyphs.
+    static constexpr int MIN_ATLAS_WIDTH = 512;
+    /// @brief Empty pixels around every glyph of the atlas.
+    static constexpr int ATLAS_PADDING = 1;
+
     std::unordered_map<char, Character> characters;
+    GLuint atlasTexture = 0;
     std::shared_ptr<stbtt_fontinfo> fontInfo;
     std::shared_ptr<std::vector<unsigned char>> fontBuffer;
 
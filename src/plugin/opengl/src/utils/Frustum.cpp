@@ -0,0 +1,69 @@
+#include "Frustum.hpp"
+
+#include <cmath>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+Frustum::Frustum(const glm::mat4 &viewProjection)
+{
+    // Gribb & Hartmann: every plane is the sum or difference of the last row of the matrix and one of the others
+    glm::mat4 m = glm::transpose(viewProjection);
+    std::array<glm::vec4, PLANE_COUNT> planes = {m[3] + m[0], m[3] - m[0], m[3] + m[1],
+                                                 m[3] - m[1], m[3] + m[2], m[3] - m[2]};
+
+    for (std::size_t i = 0; i < PLANE_COUNT; i++)
+    {
+        float length = glm::length(glm::vec3(planes[i]));
+        _normalX[i] = planes[i].x / length;
+        _normalY[i] = planes[i].y / length;
+        _normalZ[i] = planes[i].z / length;
+        _distance[i] = planes[i].w / length;
+    }
+}
+
+Frustum::Result Frustum::Classify(const BoundingBox &box) const
+{
+    glm::vec3 center = box.GetCenter();
+    glm::vec3 extents = box.GetExtents();
+    Result result = Result::Inside;
+
+    for (std::size_t i = 0; i < PLANE_COUNT; i++)
+    {
+        float distance = _normalX[i] * center.x + _normalY[i] * center.y + _normalZ[i] * center.z + _distance[i];
+        float radius = std::abs(_normalX[i]) * extents.x + std::abs(_normalY[i]) * extents.y +
+                       std::abs(_normalZ[i]) * extents.z;
+        if (distance + radius < 0.0f)
+            return Result::Outside;
+        if (distance - radius < 0.0f)
+            result = Result::Intersect;
+    }
+    return result;
+}
+
+void Frustum::TestBatch(const float *centerX, const float *centerY, const float *centerZ, const float *extentX,
+                        const float *extentY, const float *extentZ, std::size_t count, uint8_t *visible) const
+{
+    for (std::size_t b = 0; b < count; b++)
+    {
+        visible[b] = 1;
+    }
+
+    // Planes in the outer loop, boxes in the inner one: the inner loop has no branch and is vectorized
+    for (std::size_t i = 0; i < PLANE_COUNT; i++)
+    {
+        float nx = _normalX[i];
+        float ny = _normalY[i];
+        float nz = _normalZ[i];
+        float d = _distance[i];
+        float ax = std::abs(nx);
+        float ay = std::abs(ny);
+        float az = std::abs(nz);
+        for (std::size_t b = 0; b < count; b++)
+        {
+            float distance = nx * centerX[b] + ny * centerY[b] + nz * centerZ[b] + d;
+            float radius = ax * extentX[b] + ay * extentY[b] + az * extentZ[b];
+            visible[b] &= static_cast<uint8_t>(distance + radius >= 0.0f);
+        }
+    }
+}
+} // namespace ES::Plugin::OpenGL::Utils
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+#include "BoundingBox.hpp"
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief The 6 planes of a camera frustum, pointing inwards, used to cull bounding boxes.
+ *
+ * Planes are stored as structure of arrays so that batches of boxes are tested against them with loops the compiler
+ * vectorizes.
+ */
+class Frustum {
+  public:
+    /// @brief Result of a box test.
+    enum class Result : uint8_t {
+        /// @brief The box is fully outside the frustum.
+        Outside,
+        /// @brief The box crosses at least one plane of the frustum.
+        Intersect,
+        /// @brief The box is fully inside the frustum.
+        Inside
+    };
+
+    inline static constexpr std::size_t PLANE_COUNT = 6;
+
+    Frustum() = default;
+
+    /**
+     * @brief Extract the frustum of a view projection matrix.
+     */
+    explicit Frustum(const glm::mat4 &viewProjection);
+
+    /**
+     * @brief Test a box against the frustum.
+     */
+    Result Classify(const BoundingBox &box) const;
+
+    /**
+     * @brief Test a batch of boxes, given by their centers and extents, against the frustum.
+     *
+     * @param centerX, centerY, centerZ Centers of the boxes.
+     * @param extentX, extentY, extentZ Half sizes of the boxes.
+     * @param count Number of boxes of the batch.
+     * @param visible For every box, set to 1 if it is at least partially inside the frustum, 0 otherwise.
+     */
+    void TestBatch(const float *centerX, const float *centerY, const float *centerZ, const float *extentX,
+                   const float *extentY, const float *extentZ, std::size_t count, uint8_t *visible) const;
+
+  private:
+    std::array<float, PLANE_COUNT> _normalX{};
+    std::array<float, PLANE_COUNT> _normalY{};
+    std::array<float, PLANE_COUNT> _normalZ{};
+    std::array<float, PLANE_COUNT> _distance{};
+};
+} // namespace ES::Plugin::OpenGL::Utils
@@ -1,11 +1,77 @@
 #include "GLMeshBuffer.hpp"
+#include "InstanceData.hpp"
+
+#include <cstddef>
 
 namespace ES::Plugin::OpenGL::Utils {
 
+namespace {
+/**
+ * @brief Overwrite the content of a buffer, growing it only if the data doesn't fit in its capacity.
+ */
+template <typename T> void UploadData(GLenum target, GLuint buffer, const std::vector<T> &data, GLsizeiptr &capacity)
+{
+    auto size = static_cast<GLsizeiptr>(data.size() * sizeof(T));
+    glBindBuffer(target, buffer);
+    if (size > capacity)
+    {
+        // Data modified after its first upload is likely to be modified again
+        glBufferData(target, size, data.data(), GL_DYNAMIC_DRAW);
+        capacity = size;
+    }
+    else if (size > 0)
+    {
+        glBufferSubData(target, 0, size, data.data());
+    }
+}
+} // namespace
+
 void GLMeshBuffer::Draw(const Object::Component::Mesh &mesh) const noexcept
 {
     glBindVertexArray(VAO);
-    glDrawElements(GL_TRIANGLES, mesh.indices.size() * sizeof(uint32_t), GL_UNSIGNED_INT, nullptr);
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mesh.indices.size()), GL_UNSIGNED_INT, nullptr);
+    glBindVertexArray(0);
+}
+
+void GLMeshBuffer::DrawInstanced(GLsizei instanceCount, GLuint baseInstance) const noexcept
+{
+    glBindVertexArray(VAO);
+    glDrawElementsInstancedBaseInstance(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount,
+                                        baseInstance);
+    glBindVertexArray(0);
+}
+
+void GLMeshBuffer::SetInstanceBuffer(GLuint buffer) noexcept
+{
+    if (instanceBuffer == buffer)
+    {
+        return;
+    }
+    instanceBuffer = buffer;
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+    // A matrix attribute takes one location per column
+    for (GLuint column = 0; column < 4; column++)
+    {
+        GLuint location = InstanceData::MODEL_MATRIX_LOCATION + column;
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(
+            location, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
+            reinterpret_cast<const void *>(offsetof(InstanceData, modelMatrix) + column * sizeof(glm::vec4)));
+        glVertexAttribDivisor(location, 1);
+    }
+    for (GLuint column = 0; column < 3; column++)
+    {
+        GLuint location = InstanceData::NORMAL_MATRIX_LOCATION + column;
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(
+            location, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
+            reinterpret_cast<const void *>(offsetof(InstanceData, normalMatrix) + column * sizeof(glm::vec3)));
+        glVertexAttribDivisor(location, 1);
+    }
+
     glBindVertexArray(0);
 }
 
@@ -13,12 +79,16 @@ void GLMeshBuffer::DestroyGLMeshBuffers() const noexcept
 {
     glDeleteBuffers(1, &VBO_position);
     glDeleteBuffers(1, &VBO_normal);
+    glDeleteBuffers(1, &VBO_texCoords);
     glDeleteBuffers(1, &IBO);
     glDeleteVertexArrays(1, &VAO);
 }
 
 void GLMeshBuffer::GenerateGLMeshBuffers(const Object::Component::Mesh &mesh) noexcept
 {
+    indexCount = static_cast<GLsizei>(mesh.indices.size());
+    bounds = BoundingBox::FromPoints(mesh.vertices);
+
     // create vao, vbo and ibo here... (We didn't use std::vector here...)
     glGenVertexArrays(1, &VAO);
     glBindVertexArray(VAO);
@@ -50,27 +120,24 @@ void GLMeshBuffer::GenerateGLMeshBuffers(const Object::Component::Mesh &mesh) no
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(uint32_t), mesh.indices.data(), GL_STATIC_DRAW);
 
     glBindVertexArray(0);
+
+    _positionCapacity = static_cast<GLsizeiptr>(mesh.vertices.size() * sizeof(glm::vec3));
+    _normalCapacity = static_cast<GLsizeiptr>(mesh.normals.size() * sizeof(glm::vec3));
+    _texCoordsCapacity = static_cast<GLsizeiptr>(mesh.texCoords.size() * sizeof(glm::vec2));
+    _indexCapacity = static_cast<GLsizeiptr>(mesh.indices.size() * sizeof(uint32_t));
 }
 
-void GLMeshBuffer::Update(const Object::Component::Mesh &mesh) const noexcept
+void GLMeshBuffer::Update(const Object::Component::Mesh &mesh) noexcept
 {
-    glBindVertexArray(VAO);
+    indexCount = static_cast<GLsizei>(mesh.indices.size());
+    bounds = BoundingBox::FromPoints(mesh.vertices);
 
-    // Vertex positions VBO
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_position);
-    glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(glm::vec3), mesh.vertices.data(), GL_STATIC_DRAW);
-
-    // Vertex Normal VBO
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_normal);
-    glBufferData(GL_ARRAY_BUFFER, mesh.normals.size() * sizeof(glm::vec3), mesh.normals.data(), GL_STATIC_DRAW);
-
-    // Vertex Texture Coordinates VBO
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_texCoords);
-    glBufferData(GL_ARRAY_BUFFER, mesh.texCoords.size() * sizeof(glm::vec2), mesh.texCoords.data(), GL_STATIC_DRAW);
+    glBindVertexArray(VAO);
 
-    // Element indices buffer
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(uint32_t), mesh.indices.data(), GL_STATIC_DRAW);
+    UploadData(GL_ARRAY_BUFFER, VBO_position, mesh.vertices, _positionCapacity);
+    UploadData(GL_ARRAY_BUFFER, VBO_normal, mesh.normals, _normalCapacity);
+    UploadData(GL_ARRAY_BUFFER, VBO_texCoords, mesh.texCoords, _texCoordsCapacity);
+    UploadData(GL_ELEMENT_ARRAY_BUFFER, IBO, mesh.indices, _indexCapacity);
 
     glBindVertexArray(0);
 }
@@ -25,6 +25,7 @@
 
 #include <vector>
 
+#include "BoundingBox.hpp"
 #include "Loader.hpp"
 
 #include "Mesh.hpp"
@@ -43,17 +44,51 @@ class GLMeshBuffer {
 
     void Draw(const Object::Component::Mesh &mesh) const noexcept;
 
+    /**
+     * @brief Draw several instances of the mesh, reading their data from the bound instance buffer.
+     *
+     * @param instanceCount Number of instances to draw.
+     * @param baseInstance Index of the first instance in the instance buffer.
+     * @see SetInstanceBuffer
+     */
+    void DrawInstanced(GLsizei instanceCount, GLuint baseInstance) const noexcept;
+
+    /**
+     * @brief Attach an instance buffer, holding Utils::InstanceData, to the vertex array of the mesh.
+     * Does nothing if it is already attached.
+     *
+     * @param buffer The instance buffer.
+     */
+    void SetInstanceBuffer(GLuint buffer) noexcept;
+
     void DestroyGLMeshBuffers() const noexcept;
 
     void GenerateGLMeshBuffers(const Object::Component::Mesh &mesh) noexcept;
 
-    void Update(const Object::Component::Mesh &mesh) const noexcept;
+    /**
+     * @brief Upload a modified mesh to the existing buffers.
+     *
+     * Buffers are overwritten in place with glBufferSubData, and only reallocated when the mesh grew past their
+     * capacity. It is only called for meshes tagged with GLMeshBufferDirty.
+     */
+    void Update(const Object::Component::Mesh &mesh) noexcept;
 
     GLuint VAO = 0;
     GLuint VBO_position = 0;
     GLuint VBO_normal = 0;
     GLuint VBO_texCoords = 0;
     GLuint IBO = 0;
+    GLuint instanceBuffer = 0;
+    GLsizei indexCount = 0;
+    /// @brief Bounds of the vertices of the mesh, in model space.
+    BoundingBox bounds;
+
+  private:
+    /// @brief Allocated size of the buffers, in bytes.
+    GLsizeiptr _positionCapacity = 0;
+    GLsizeiptr _normalCapacity = 0;
+    GLsizeiptr _texCoordsCapacity = 0;
+    GLsizeiptr _indexCapacity = 0;
 };
 
 } // namespace ES::Plugin::OpenGL::Utils
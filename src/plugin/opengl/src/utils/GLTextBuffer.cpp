@@ -1,5 +1,7 @@
 #include "GLTextBuffer.hpp"
 
+#include <array>
+
 namespace ES::Plugin::OpenGL::Utils {
 
 void GLTextBuffer::DestroyGLTextBuffers() const noexcept
@@ -15,7 +17,6 @@ void GLTextBuffer::GenerateGLTextBuffers() noexcept
 
     glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, nullptr, GL_DYNAMIC_DRAW);
 
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), nullptr);
@@ -23,14 +24,17 @@ void GLTextBuffer::GenerateGLTextBuffers() noexcept
     glBindVertexArray(0);
 }
 
-void GLTextBuffer::RenderText(const ES::Plugin::UI::Component::Text &text,
+bool GLTextBuffer::IsUpToDate(const ES::Plugin::UI::Component::Text &text,
                               const ES::Plugin::OpenGL::Utils::Font &font) const
 {
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    return _builtFont == &font && _builtScale == text.scale && _builtPosition == text.position &&
+           _builtText == text.text;
+}
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindVertexArray(VAO);
+void GLTextBuffer::Update(const ES::Plugin::UI::Component::Text &text, const ES::Plugin::OpenGL::Utils::Font &font)
+{
+    std::vector<std::array<float, 4>> vertices;
+    vertices.reserve(text.text.size() * 6);
 
     float x = text.position.x;
     float y = text.position.y;
@@ -51,24 +55,56 @@ void GLTextBuffer::RenderText(const ES::Plugin::UI::Component::Text &text,
         float w = ch.size.x * text.scale;
         float h = ch.size.y * text.scale;
 
-        std::array<std::array<float, 4>, 6> vertices = {
-            {{xpos, ypos + h, 0.0f, 0.0f},
-             {xpos, ypos, 0.0f, 1.0f},
-             {xpos + w, ypos, 1.0f, 1.0f},
-
-             {xpos, ypos + h, 0.0f, 0.0f},
-             {xpos + w, ypos, 1.0f, 1.0f},
-             {xpos + w, ypos + h, 1.0f, 0.0f}}
-        };
-
-        glBindTexture(GL_TEXTURE_2D, ch.textureID);
-        glBindBuffer(GL_ARRAY_BUFFER, VBO);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices.data(), GL_DYNAMIC_DRAW);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+        const glm::vec4 &uv = ch.uvRegion;
+        vertices.insert(vertices.end(), {
+                                            {xpos, ypos + h, uv.x, uv.y},
+                                            {xpos, ypos, uv.x, uv.w},
+                                            {xpos + w, ypos, uv.z, uv.w},
+                                            {xpos, ypos + h, uv.x, uv.y},
+                                            {xpos + w, ypos, uv.z, uv.w},
+                                            {xpos + w, ypos + h, uv.z, uv.y},
+                                        });
 
         x += ch.advance * text.scale;
     }
 
+    // The buffer is only reallocated when the text grows, shorter texts are written in place
+    auto size = static_cast<GLsizeiptr>(vertices.size() * sizeof(vertices[0]));
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    if (size > _capacity)
+    {
+        glBufferData(GL_ARRAY_BUFFER, size, vertices.data(), _capacity == 0 ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
+        _capacity = size;
+    }
+    else if (size > 0)
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, size, vertices.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    vertexCount = static_cast<GLsizei>(vertices.size());
+
+    _builtText = text.text;
+    _builtPosition = text.position;
+    _builtScale = text.scale;
+    _builtFont = &font;
+}
+
+void GLTextBuffer::RenderText(const ES::Plugin::UI::Component::Text &text,
+                              const ES::Plugin::OpenGL::Utils::Font &font)
+{
+    if (!IsUpToDate(text, font))
+        Update(text, font);
+    if (vertexCount == 0)
+        return;
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, font.GetAtlasTexture());
+    glBindVertexArray(VAO);
+    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+
     glBindVertexArray(0);
     glBindTexture(GL_TEXTURE_2D, 0);
     glDisable(GL_BLEND);
@@ -23,6 +23,7 @@
 
 #include <GL/glew.h>
 
+#include <string>
 #include <vector>
 
 #include "Font.hpp"
@@ -45,10 +46,31 @@ class GLTextBuffer {
 
     void GenerateGLTextBuffers() noexcept;
 
-    void RenderText(const ES::Plugin::UI::Component::Text &text, const ES::Plugin::OpenGL::Utils::Font &font) const;
+    /**
+     * @brief Draw a text in a single call. Its vertices are only rebuilt when its string, position, scale or font
+     * changed since the previous call.
+     */
+    void RenderText(const ES::Plugin::UI::Component::Text &text, const ES::Plugin::OpenGL::Utils::Font &font);
+
+    /**
+     * @brief Rebuild the vertices of the glyphs of a text and upload them.
+     */
+    void Update(const ES::Plugin::UI::Component::Text &text, const ES::Plugin::OpenGL::Utils::Font &font);
 
     GLuint VAO = 0;
     GLuint VBO = 0;
+    GLsizei vertexCount = 0;
+
+  private:
+    bool IsUpToDate(const ES::Plugin::UI::Component::Text &text, const ES::Plugin::OpenGL::Utils::Font &font) const;
+
+    /// @brief State of the text the vertices were last built from.
+    std::string _builtText;
+    glm::vec2 _builtPosition = glm::vec2(0.0f);
+    float _builtScale = 0.0f;
+    const Font *_builtFont = nullptr;
+    /// @brief Allocated size of the vertex buffer, in bytes.
+    GLsizeiptr _capacity = 0;
 };
 
 } // namespace ES::Plugin::OpenGL::Utils
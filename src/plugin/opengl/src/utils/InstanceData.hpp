@@ -0,0 +1,28 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief Per instance data of an instanced mesh draw, as laid out in the instance buffer of the RenderQueue.
+ *
+ * Shaders supporting instancing read it as vertex attributes:
+ * @code
+ * layout (location = 3) in mat4 InstanceModelMatrix;  // locations 3 to 6
+ * layout (location = 7) in mat3 InstanceNormalMatrix; // locations 7 to 9
+ * @endcode
+ * The view projection matrix is read from the camera uniform block, see CameraBlock.
+ */
+struct InstanceData {
+    /// @brief First attribute location of the model matrix.
+    static constexpr GLuint MODEL_MATRIX_LOCATION = 3;
+    /// @brief First attribute location of the normal matrix.
+    static constexpr GLuint NORMAL_MATRIX_LOCATION = 7;
+    /// @brief Name of the model matrix attribute, used to detect shaders supporting instancing.
+    static constexpr const char *MODEL_MATRIX_ATTRIBUTE = "InstanceModelMatrix";
+
+    glm::mat4 modelMatrix;
+    glm::mat3 normalMatrix;
+};
+} // namespace ES::Plugin::OpenGL::Utils
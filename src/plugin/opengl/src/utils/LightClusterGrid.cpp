@@ -0,0 +1,150 @@
+#include "LightClusterGrid.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+namespace {
+/**
+ * @brief Check if a sphere touches a box, by the distance from its center to the closest point of the box.
+ */
+bool SphereIntersectsBox(const glm::vec3 &center, float radius, const BoundingBox &box)
+{
+    glm::vec3 closest = glm::clamp(center, box.min, box.max);
+    glm::vec3 delta = center - closest;
+    return glm::dot(delta, delta) <= radius * radius;
+}
+} // namespace
+
+LightClusterGrid::LightClusterGrid(const glm::uvec3 &size) { SetSize(size); }
+
+void LightClusterGrid::SetSize(const glm::uvec3 &size)
+{
+    _size = glm::max(size, glm::uvec3(1));
+    std::size_t count = static_cast<std::size_t>(_size.x) * _size.y * _size.z;
+    _clusters.assign(count, Cluster{});
+    _bounds.resize(count);
+    _sliceIndices.resize(_size.z);
+    _lightIndices.clear();
+    // Forces the bounds to be computed again
+    _zNear = 0.0f;
+}
+
+void LightClusterGrid::UpdateBounds(const glm::mat4 &projection, float zNear, float zFar)
+{
+    if (projection == _projection && zNear == _zNear && zFar == _zFar)
+    {
+        return;
+    }
+    _projection = projection;
+    _zNear = zNear;
+    _zFar = zFar;
+
+    float logRatio = std::log(zFar / zNear);
+    _depthScale = static_cast<float>(_size.z) / logRatio;
+    _depthBias = -static_cast<float>(_size.z) * std::log(zNear) / logRatio;
+
+    glm::mat4 inverseProjection = glm::inverse(projection);
+    // Point of the near plane seen at some normalized device coordinates
+    auto unproject = [&inverseProjection](float x, float y) {
+        glm::vec4 point = inverseProjection * glm::vec4(x, y, -1.0f, 1.0f);
+        return glm::vec3(point) / point.w;
+    };
+
+    std::size_t index = 0;
+    for (uint32_t z = 0; z < _size.z; z++)
+    {
+        float sliceNear = zNear * std::pow(zFar / zNear, static_cast<float>(z) / static_cast<float>(_size.z));
+        float sliceFar = zNear * std::pow(zFar / zNear, static_cast<float>(z + 1) / static_cast<float>(_size.z));
+        for (uint32_t y = 0; y < _size.y; y++)
+        {
+            for (uint32_t x = 0; x < _size.x; x++, index++)
+            {
+                glm::vec2 tileMin = glm::vec2(x, y) / glm::vec2(_size.x, _size.y) * 2.0f - 1.0f;
+                glm::vec2 tileMax = glm::vec2(x + 1, y + 1) / glm::vec2(_size.x, _size.y) * 2.0f - 1.0f;
+                glm::vec3 nearMin = unproject(tileMin.x, tileMin.y);
+                glm::vec3 nearMax = unproject(tileMax.x, tileMax.y);
+                // The tile is a pyramid from the eye, its section at a depth is the near one scaled
+                std::array<glm::vec3, 4> corners = {
+                    nearMin * (sliceNear / -nearMin.z), nearMax * (sliceNear / -nearMax.z),
+                    nearMin * (sliceFar / -nearMin.z), nearMax * (sliceFar / -nearMax.z)};
+                _bounds[index] = BoundingBox::FromPoints(corners);
+            }
+        }
+    }
+}
+
+void LightClusterGrid::Build(const glm::mat4 &projection, float zNear, float zFar, std::span<const glm::vec4> lights,
+                             ES::Utils::ThreadPool *threadPool)
+{
+    UpdateBounds(projection, zNear, zFar);
+
+    std::size_t threadCount = threadPool != nullptr ? threadPool->GetThreadCount() : 1;
+    if (lights.size() < PARALLEL_BUILD_THRESHOLD || threadCount < 2)
+    {
+        BuildSlices(lights, 0, _size.z);
+    }
+    else
+    {
+        // Every task builds contiguous slices, so that each thread writes its own clusters and lists
+        uint32_t taskCount = static_cast<uint32_t>(std::min<std::size_t>(threadCount, _size.z));
+        uint32_t slicesPerTask = (_size.z + taskCount - 1) / taskCount;
+        threadPool->ParallelFor(taskCount, [this, lights, slicesPerTask](std::size_t task) {
+            uint32_t first = static_cast<uint32_t>(task) * slicesPerTask;
+            BuildSlices(lights, std::min(first, _size.z), std::min(first + slicesPerTask, _size.z));
+        });
+    }
+
+    _lightIndices.clear();
+    std::size_t clustersPerSlice = static_cast<std::size_t>(_size.x) * _size.y;
+    for (uint32_t z = 0; z < _size.z; z++)
+    {
+        auto base = static_cast<uint32_t>(_lightIndices.size());
+        for (std::size_t i = 0; i < clustersPerSlice; i++)
+        {
+            _clusters[z * clustersPerSlice + i].offset += base;
+        }
+        _lightIndices.insert(_lightIndices.end(), _sliceIndices[z].begin(), _sliceIndices[z].end());
+    }
+}
+
+void LightClusterGrid::BuildSlices(std::span<const glm::vec4> lights, uint32_t firstSlice, uint32_t lastSlice)
+{
+    std::size_t clustersPerSlice = static_cast<std::size_t>(_size.x) * _size.y;
+    std::vector<uint32_t> candidates;
+    for (uint32_t z = firstSlice; z < lastSlice; z++)
+    {
+        std::size_t first = z * clustersPerSlice;
+        // Every cluster of a slice has the same depth range
+        float sliceNear = -_bounds[first].max.z;
+        float sliceFar = -_bounds[first].min.z;
+
+        candidates.clear();
+        for (std::size_t i = 0; i < lights.size(); i++)
+        {
+            float depth = -lights[i].z;
+            if (depth + lights[i].w >= sliceNear && depth - lights[i].w <= sliceFar)
+            {
+                candidates.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        auto &indices = _sliceIndices[z];
+        indices.clear();
+        for (std::size_t cluster = first; cluster < first + clustersPerSlice; cluster++)
+        {
+            auto offset = static_cast<uint32_t>(indices.size());
+            for (uint32_t light : candidates)
+            {
+                if (SphereIntersectsBox(glm::vec3(lights[light]), lights[light].w, _bounds[cluster]))
+                {
+                    indices.push_back(light);
+                }
+            }
+            _clusters[cluster] = Cluster{offset, static_cast<uint32_t>(indices.size()) - offset};
+        }
+    }
+}
+} // namespace ES::Plugin::OpenGL::Utils
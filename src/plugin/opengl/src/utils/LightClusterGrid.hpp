@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <vector>
+
+#include "BoundingBox.hpp"
+#include "ThreadPool.hpp"
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief Grid of clusters splitting the view frustum, listing the point lights reaching every cluster.
+ *
+ * The screen is split in tiles, and the depth of every tile in slices whose thickness grows exponentially with the
+ * distance to the camera, so that clusters keep about the same shape along the frustum. A fragment finds its cluster
+ * from its window coordinates and its view depth, then only evaluates the lights of that cluster.
+ *
+ * Lights are given in view space, as spheres of influence. Slices are independent, so large sets of lights are
+ * assigned by the threads of a ThreadPool, each building the lists of some slices.
+ */
+class LightClusterGrid {
+  public:
+    /// @brief Default number of clusters along the width, height and depth of the frustum.
+    inline static constexpr glm::uvec3 DEFAULT_SIZE = glm::uvec3(16, 9, 24);
+    /// @brief Minimum number of lights for the build to be split across threads.
+    inline static constexpr std::size_t PARALLEL_BUILD_THRESHOLD = 128;
+
+    /**
+     * @brief Lights of a cluster, as a range of GetLightIndices(). Matches a std430 uvec2.
+     */
+    struct Cluster {
+        uint32_t offset = 0;
+        uint32_t count = 0;
+    };
+
+    LightClusterGrid() : LightClusterGrid(DEFAULT_SIZE) {}
+    explicit LightClusterGrid(const glm::uvec3 &size);
+    ~LightClusterGrid() = default;
+
+    /**
+     * @brief Assign lights to the clusters of a frustum.
+     *
+     * @param projection Projection matrix of the camera.
+     * @param zNear, zFar Distances of the near and far planes of the projection.
+     * @param lights Point lights, in view space: xyz is the position of the light and w the radius of its influence.
+     * @param threadPool Threads assigning large sets of lights, or nullptr to build on the calling thread only.
+     */
+    void Build(const glm::mat4 &projection, float zNear, float zFar, std::span<const glm::vec4> lights,
+               ES::Utils::ThreadPool *threadPool = nullptr);
+
+    /**
+     * @brief Change the number of clusters. The lists are empty until the next Build.
+     */
+    void SetSize(const glm::uvec3 &size);
+
+    inline const glm::uvec3 &GetSize() const { return _size; }
+
+    /**
+     * @brief Get the clusters, x first, then y, then z.
+     */
+    inline const std::vector<Cluster> &GetClusters() const { return _clusters; }
+
+    /**
+     * @brief Get the lists of lights of every cluster, one after the other. Values are indices in the lights given to
+     * Build.
+     */
+    inline const std::vector<uint32_t> &GetLightIndices() const { return _lightIndices; }
+
+    /**
+     * @brief Get the scale and bias giving the slice of a view depth: floor(log(depth) * scale + bias).
+     */
+    inline float GetDepthScale() const { return _depthScale; }
+    inline float GetDepthBias() const { return _depthBias; }
+
+  private:
+    /**
+     * @brief Compute the view space bounds of the clusters, if the projection changed since the last build.
+     */
+    void UpdateBounds(const glm::mat4 &projection, float zNear, float zFar);
+
+    /**
+     * @brief Build the lists of the slices in [firstSlice, lastSlice).
+     */
+    void BuildSlices(std::span<const glm::vec4> lights, uint32_t firstSlice, uint32_t lastSlice);
+
+    glm::uvec3 _size;
+    std::vector<Cluster> _clusters;
+    std::vector<uint32_t> _lightIndices;
+
+    /// @brief View space bounds of the clusters, in the same order as _clusters.
+    std::vector<BoundingBox> _bounds;
+    /// @brief Lists of lights of every slice, merged into _lightIndices once every slice is built.
+    std::vector<std::vector<uint32_t>> _sliceIndices;
+
+    glm::mat4 _projection = glm::mat4(0.0f);
+    float _zNear = 0.0f;
+    float _zFar = 0.0f;
+    float _depthScale = 0.0f;
+    float _depthBias = 0.0f;
+};
+} // namespace ES::Plugin::OpenGL::Utils
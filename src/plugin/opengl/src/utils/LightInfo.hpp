@@ -0,0 +1,23 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief A light as read by the shaders, matching the std430 layout of:
+ *
+ * @code
+ * struct LightInfo {
+ *     vec4 Position; // xyz: world position, w: radius. Directional lights: direction toward the light, w: 0
+ *     vec3 Intensity;
+ * };
+ * @endcode
+ */
+struct LightInfo {
+    glm::vec4 position = glm::vec4(0.0f);
+    glm::vec3 intensity = glm::vec3(0.0f);
+    float padding = 0.0f;
+};
+
+static_assert(sizeof(LightInfo) == 32, "LightInfo must match its std430 layout");
+} // namespace ES::Plugin::OpenGL::Utils
@@ -9,10 +9,15 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "Exception.hpp"
+#include "InstanceData.hpp"
 #include "Logger.hpp"
 #include "OpenGLError.hpp"
+#include "ProgramBinaryCache.hpp"
+#include "Uniform.hpp"
 
 #include <GL/glew.h>
 
@@ -40,6 +45,12 @@ class ShaderProgram {
     // Map of uniforms and their binding locations
     std::map<std::string, int, std::less<>> uniformMap;
 
+    // Map of uniform blocks and their indices
+    std::map<std::string, GLuint, std::less<>> uniformBlockMap;
+
+    // Does the program read the matrices of its instances from the instance attributes?
+    bool instanced = false;
+
     // Has this shader program been initialised?
 
     // ---------- PRIVATE METHODS ----------
@@ -154,10 +165,72 @@ class ShaderProgram {
                 fmt::format("Shader program validation failed: {}", getInfoLog(ObjectType::PROGRAM, programId)));
         }
 
+        reflectUniforms();
+        reflectAttributes();
+
         // Finally, the shader program is initialised
         initialised = true;
     }
 
+    // Private method to resolve the location of every active uniform, and the index of every uniform block, once
+    // the program is linked - so that nothing has to be looked up by name with OpenGL when drawing
+    void reflectUniforms()
+    {
+        GLint uniformCount = 0;
+        GLint maxNameLength = 0;
+        glGetProgramiv(programId, GL_ACTIVE_UNIFORMS, &uniformCount);
+        glGetProgramiv(programId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+        std::vector<GLchar> name(maxNameLength + 1);
+
+        for (GLuint i = 0; i < static_cast<GLuint>(uniformCount); i++)
+        {
+            // Members of uniform blocks have no location, they are set through a uniform buffer
+            GLint blockIndex = -1;
+            glGetActiveUniformsiv(programId, 1, &i, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+            if (blockIndex != -1)
+            {
+                continue;
+            }
+
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(programId, i, maxNameLength, &length, &size, &type, name.data());
+            std::string uniformName(name.data(), length);
+            uniformMap[uniformName] = glGetUniformLocation(programId, uniformName.c_str());
+
+            // Arrays are reported by their first element, register their plain name and every other element too
+            if (uniformName.ends_with("[0]"))
+            {
+                std::string arrayName = uniformName.substr(0, uniformName.size() - 3);
+                uniformMap[arrayName] = uniformMap[uniformName];
+                for (GLint element = 1; element < size; element++)
+                {
+                    std::string elementName = fmt::format("{}[{}]", arrayName, element);
+                    uniformMap[elementName] = glGetUniformLocation(programId, elementName.c_str());
+                }
+            }
+        }
+
+        GLint blockCount = 0;
+        glGetProgramiv(programId, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+        glGetProgramiv(programId, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxNameLength);
+        name.resize(maxNameLength + 1);
+        for (GLuint i = 0; i < static_cast<GLuint>(blockCount); i++)
+        {
+            GLsizei length = 0;
+            glGetActiveUniformBlockName(programId, i, maxNameLength, &length, name.data());
+            uniformBlockMap[std::string(name.data(), length)] = i;
+        }
+    }
+
+    // Private method to detect, once the program is linked, whether it supports instancing - see InstanceData
+    void reflectAttributes()
+    {
+        instanced = glGetAttribLocation(programId, InstanceData::MODEL_MATRIX_ATTRIBUTE) ==
+                    static_cast<GLint>(InstanceData::MODEL_MATRIX_LOCATION);
+    }
+
     // Private method to load the shader source code from a file
     std::string loadShaderFromFile(const std::string &filename) const
     {
@@ -257,6 +330,37 @@ class ShaderProgram {
         initialise(vertexShaderSource, fragmentShaderSource);
     }
 
+    // Method to initialise a shader program from shaders provided as files, going through a program binary cache
+    void initFromFiles(const std::string &vertexShaderFilename, const std::string &fragmentShaderFilename,
+                       const ProgramBinaryCache &cache)
+    {
+        initFromStrings(loadShaderFromFile(vertexShaderFilename), loadShaderFromFile(fragmentShaderFilename), cache);
+    }
+
+    // Method to initialise a shader program from shaders provided as strings, loading the binary linked by a
+    // previous run from the cache. If there is none, or if the driver rejects it, the program is built from its
+    // sources and its binary is stored for the next runs.
+    void initFromStrings(const std::string &vertexShaderSource, const std::string &fragmentShaderSource,
+                         const ProgramBinaryCache &cache)
+    {
+        if (cache.Load(programId, vertexShaderSource, fragmentShaderSource))
+        {
+            if (DEBUG_SHADER)
+            {
+                ES::Utils::Log::Info("Shader program loaded from the binary cache.");
+            }
+            reflectUniforms();
+            reflectAttributes();
+            initialised = true;
+            return;
+        }
+
+        // Ask the driver to keep the binary of the program, so it can be retrieved once linked
+        glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        initialise(vertexShaderSource, fragmentShaderSource);
+        cache.Save(programId, vertexShaderSource, fragmentShaderSource);
+    }
+
     // Method to enable the shader program - we'll suggest this for inlining
     inline void use() const
     {
@@ -273,6 +377,9 @@ class ShaderProgram {
         }
     }
 
+    // Method to return the OpenGL id of the shader program
+    inline GLuint getProgramId() const { return programId; }
+
     // Method to disable the shader - we'll also suggest this for inlining
     inline void disable() const { glUseProgram(0); }
 
@@ -305,30 +412,55 @@ class ShaderProgram {
         return attributeMap[attributeName];
     }
 
-    // Method to returns the bound location of a named uniform
-    GLuint uniform(const std::string &uniformName)
+    // Method to returns the bound location of a named uniform, or -1 if the uniform was not found
+    GLint uniform(std::string_view uniformName) const
     {
-        // Note: You could do this method with the single line:
-        //
-        // 		return uniformLocList[uniform];
-        //
-        // But we're not doing that. Explanation in the attribute() method above.
+        // Uniforms are resolved when the program is linked, so this is a lookup in our map only - and a string_view
+        // lookup, so that no string gets allocated when called with a literal
+        auto uniformIter = uniformMap.find(uniformName);
 
-        // Create an iterator to look through our uniform map (only create iterator on first run -
-        // reuse it for all further calls).
-        static std::map<std::string, int, std::less<>>::const_iterator uniformIter;
-
-        // Try to find the named uniform
-        uniformIter = uniformMap.find(uniformName);
-
-        // Found it? Great - pass it back! Didn't find it? Alert user and halt.
+        // Found it? Great - pass it back! Didn't find it? Alert user and return -1, which OpenGL ignores.
         if (uniformIter == uniformMap.end())
         {
             ES::Utils::Log::Error(fmt::format("Could not find uniform in shader program: {}", uniformName));
+            return -1;
         }
 
-        // Otherwise return the attribute location from the uniform map
-        return uniformMap[uniformName];
+        return uniformIter->second;
+    }
+
+    // Method to return a typed handle to a named uniform - resolve it once, then set it without any lookup
+    template <typename T> Uniform<T> getUniform(std::string_view uniformName) const
+    {
+        return Uniform<T>(uniform(uniformName));
+    }
+
+    // Method to return a typed handle to a uniform the program may not have - an invalid handle, without any error,
+    // if it doesn't
+    template <typename T> Uniform<T> findUniform(std::string_view uniformName) const
+    {
+        auto uniformIter = uniformMap.find(uniformName);
+        return Uniform<T>(uniformIter == uniformMap.end() ? -1 : uniformIter->second);
+    }
+
+    // Method to check whether the program reads the matrices of its instances from the instance attributes, and
+    // can be drawn instanced
+    inline bool isInstanced() const { return instanced; }
+
+    // Method to check whether the program has a named uniform block
+    bool hasUniformBlock(std::string_view blockName) const { return uniformBlockMap.contains(blockName); }
+
+    // Method to attach a named uniform block to a uniform buffer binding point, for shaders that don't declare
+    // their binding in GLSL
+    void bindUniformBlock(std::string_view blockName, GLuint binding) const
+    {
+        auto blockIter = uniformBlockMap.find(blockName);
+        if (blockIter == uniformBlockMap.end())
+        {
+            ES::Utils::Log::Error(fmt::format("Could not find uniform block in shader program: {}", blockName));
+            return;
+        }
+        glUniformBlockBinding(programId, blockIter->second, binding);
     }
 
     // Method to add an attribute to the shader and return the bound location
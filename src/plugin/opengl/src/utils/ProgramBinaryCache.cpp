@@ -0,0 +1,170 @@
+#include "ProgramBinaryCache.hpp"
+
+#include "Logger.hpp"
+
+#include <array>
+#include <fmt/format.h>
+#include <fstream>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+namespace {
+/// @brief First bytes of a cache file.
+constexpr std::array<char, 4> MAGIC = {'E', 'S', 'P', 'B'};
+/// @brief Binaries larger than this are considered corrupted.
+constexpr uint64_t MAX_BINARY_SIZE = 64 * 1024 * 1024;
+
+/**
+ * @brief 64 bits FNV-1a, used rather than std::hash so that keys are the same whatever the build.
+ */
+uint64_t Hash(uint64_t hash, std::string_view data)
+{
+    for (char c : data)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string_view GetDriverString(GLenum name)
+{
+    const GLubyte *value = glGetString(name);
+    return value ? reinterpret_cast<const char *>(value) : "";
+}
+
+bool IsLinked(GLuint program)
+{
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    return linked == GL_TRUE;
+}
+} // namespace
+
+std::filesystem::path ProgramBinaryCache::GetFile(const std::string &vertexSource,
+                                                  const std::string &fragmentSource) const
+{
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if (formatCount == 0)
+    {
+        return {};
+    }
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::string_view part : {std::string_view(vertexSource), std::string_view(fragmentSource),
+                                  GetDriverString(GL_VENDOR), GetDriverString(GL_RENDERER),
+                                  GetDriverString(GL_VERSION)})
+    {
+        // Parts are separated, so that moving text from one to the next changes the key
+        hash = Hash(Hash(hash, part), std::string_view("\0", 1));
+    }
+    return _directory / fmt::format("{:016x}.bin", hash);
+}
+
+bool ProgramBinaryCache::Load(GLuint program, const std::string &vertexSource, const std::string &fragmentSource) const
+{
+    std::filesystem::path file = GetFile(vertexSource, fragmentSource);
+    if (file.empty())
+    {
+        return false;
+    }
+    std::ifstream stream(file, std::ios::binary);
+    if (!stream)
+    {
+        return false;
+    }
+
+    std::array<char, 4> magic{};
+    uint32_t format = 0;
+    uint64_t size = 0;
+    stream.read(magic.data(), magic.size());
+    stream.read(reinterpret_cast<char *>(&format), sizeof(format));
+    stream.read(reinterpret_cast<char *>(&size), sizeof(size));
+    if (!stream || magic != MAGIC || size > MAX_BINARY_SIZE)
+    {
+        ES::Utils::Log::Warn(fmt::format("Ignoring corrupted shader program binary: {}", file.string()));
+        return false;
+    }
+    std::vector<char> binary(size);
+    stream.read(binary.data(), static_cast<std::streamsize>(size));
+    if (!stream)
+    {
+        ES::Utils::Log::Warn(fmt::format("Ignoring truncated shader program binary: {}", file.string()));
+        return false;
+    }
+
+    glProgramBinary(program, format, binary.data(), static_cast<GLsizei>(size));
+    if (!IsLinked(program))
+    {
+        ES::Utils::Log::Warn(fmt::format("Shader program binary rejected by the driver: {}", file.string()));
+        return false;
+    }
+    return true;
+}
+
+void ProgramBinaryCache::Save(GLuint program, const std::string &vertexSource, const std::string &fragmentSource) const
+{
+    if (!IsLinked(program))
+    {
+        return;
+    }
+    std::filesystem::path file = GetFile(vertexSource, fragmentSource);
+    if (file.empty())
+    {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return;
+    }
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0)
+    {
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(_directory, error);
+    if (error)
+    {
+        ES::Utils::Log::Warn(
+            fmt::format("Failed to create the shader cache {}: {}", _directory.string(), error.message()));
+        return;
+    }
+
+    // Written aside then renamed, so that a run stopped while writing doesn't leave a truncated binary
+    std::filesystem::path temporary = file;
+    temporary += ".tmp";
+    {
+        auto binaryFormat = static_cast<uint32_t>(format);
+        auto size = static_cast<uint64_t>(written);
+        std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+        stream.write(MAGIC.data(), MAGIC.size());
+        stream.write(reinterpret_cast<const char *>(&binaryFormat), sizeof(binaryFormat));
+        stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        stream.write(binary.data(), written);
+        if (!stream)
+        {
+            ES::Utils::Log::Warn(fmt::format("Failed to write the shader program binary: {}", temporary.string()));
+            return;
+        }
+    }
+    std::filesystem::rename(temporary, file, error);
+    if (error)
+    {
+        ES::Utils::Log::Warn(fmt::format("Failed to write the shader program binary {}: {}", file.string(),
+                                         error.message()));
+    }
+}
+
+} // namespace ES::Plugin::OpenGL::Utils
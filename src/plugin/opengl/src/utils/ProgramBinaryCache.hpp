@@ -0,0 +1,56 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+/**
+ * ProgramBinaryCache stores linked shader programs on disk, so that later runs load them with glProgramBinary
+ * instead of compiling and linking their sources again.
+ *
+ * A binary is keyed by the sources of the program and by the vendor, renderer and version of the driver: updating
+ * the driver or editing a shader produces another key. The driver may still reject a binary, in which case Load
+ * fails and the program must be built from its sources.
+ *
+ * @see ShaderProgram::initFromStrings
+ */
+class ProgramBinaryCache {
+  public:
+    /// @brief Default directory of the cache, relative to the working directory.
+    inline static const std::filesystem::path DEFAULT_DIRECTORY = ".cache/shaders";
+
+    explicit ProgramBinaryCache(std::filesystem::path directory = DEFAULT_DIRECTORY)
+        : _directory(std::move(directory))
+    {
+    }
+
+    /**
+     * @brief Load the binary of a program from the cache and link it.
+     *
+     * @param program Program to load the binary into, created but not linked.
+     * @return true if the binary was found and linked successfully.
+     */
+    bool Load(GLuint program, const std::string &vertexSource, const std::string &fragmentSource) const;
+
+    /**
+     * @brief Save the binary of a linked program in the cache. For the driver to keep its binary, the program must
+     * be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+     */
+    void Save(GLuint program, const std::string &vertexSource, const std::string &fragmentSource) const;
+
+    inline const std::filesystem::path &GetDirectory() const { return _directory; }
+
+  private:
+    /**
+     * @brief Get the file of a program in the cache, or an empty path if the driver doesn't support program binaries.
+     */
+    std::filesystem::path GetFile(const std::string &vertexSource, const std::string &fragmentSource) const;
+
+    std::filesystem::path _directory;
+};
+
+} // namespace ES::Plugin::OpenGL::Utils
@@ -0,0 +1,48 @@
+#include "StorageBuffer.hpp"
+
+#include <algorithm>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+void StorageBuffer::Create(GLuint binding, GLsizeiptr size)
+{
+    _binding = binding;
+    _size = size;
+    glGenBuffers(1, &_id);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, _id);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, _size, nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    Bind();
+}
+
+void StorageBuffer::Reserve(GLsizeiptr size)
+{
+    if (size <= _size)
+        return;
+
+    _size = std::max(size, _size + _size / 2);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, _id);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, _size, nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void StorageBuffer::Upload(const void *data, GLsizeiptr size)
+{
+    if (size <= 0)
+        return;
+
+    Reserve(size);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, _id);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, size, data);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void StorageBuffer::Bind() const { glBindBufferBase(GL_SHADER_STORAGE_BUFFER, _binding, _id); }
+
+void StorageBuffer::Destroy()
+{
+    glDeleteBuffers(1, &_id);
+    _id = 0;
+    _size = 0;
+}
+} // namespace ES::Plugin::OpenGL::Utils
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <GL/glew.h>
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief An OpenGL shader storage buffer object, holding an array read by shaders and laid out with std430.
+ *
+ * Unlike a UniformBuffer, its size isn't limited to a few kilobytes and shaders may index it with a size only known
+ * at run time, which makes it fit for data whose amount changes every frame, such as the lights of the scene.
+ * Shaders refer to its binding point with `layout (std430, binding = N) buffer`.
+ */
+class StorageBuffer {
+  public:
+    StorageBuffer() = default;
+    ~StorageBuffer() = default;
+
+    /**
+     * @brief Create the buffer and attach it to its binding point.
+     *
+     * @param binding The binding point of the buffer.
+     * @param size The initial size of the buffer, in bytes. Must not be 0.
+     */
+    void Create(GLuint binding, GLsizeiptr size);
+
+    /**
+     * @brief Grow the buffer so it holds at least size bytes. Its content is lost if it grows.
+     */
+    void Reserve(GLsizeiptr size);
+
+    /**
+     * @brief Upload data to the buffer, growing it if needed.
+     *
+     * @param data The data to upload.
+     * @param size Size of the data, in bytes.
+     */
+    void Upload(const void *data, GLsizeiptr size);
+
+    /**
+     * @brief Attach the buffer to its binding point.
+     */
+    void Bind() const;
+
+    void Destroy();
+
+    inline GLuint GetId() const { return _id; }
+    inline GLuint GetBinding() const { return _binding; }
+    inline GLsizeiptr GetSize() const { return _size; }
+
+  private:
+    GLuint _id = 0;
+    GLuint _binding = 0;
+    GLsizeiptr _size = 0;
+};
+} // namespace ES::Plugin::OpenGL::Utils
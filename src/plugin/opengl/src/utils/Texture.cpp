@@ -3,10 +3,23 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+#include <algorithm>
+
 namespace ES::Plugin::OpenGL::Utils {
 
 Texture::Texture(const std::string &texturePath) { LoadTexture(texturePath); }
 
+Texture::Texture(const glm::u8vec4 &placeholderColor) : _width(1), _height(1), _channels(4)
+{
+    glGenTextures(1, &_textureID);
+    glBindTexture(GL_TEXTURE_2D, _textureID);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB_ALPHA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &placeholderColor);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 Texture::~Texture()
 {
     if (!_textureID)
@@ -18,30 +31,55 @@ Texture::~Texture()
 
 void Texture::LoadTexture(const std::string &texturePath)
 {
-    uint8_t *pixels = stbi_load(texturePath.c_str(), &_width, &_height, &_channels, STBI_rgb_alpha);
-
-    if (!pixels)
-    {
-        ES::Utils::Log::Error("Failed to load texture image (" + texturePath + "): " + stbi_failure_reason());
+    TextureImage image;
+    if (!image.LoadFromFile(texturePath))
         return;
-    }
 
     glGenTextures(1, &_textureID);
+    Upload(image);
+    ES::Utils::Log::Info(fmt::format("Texture loaded: {}", texturePath));
+}
+
+void Texture::Upload(const TextureImage &image)
+{
+    if (image.levels.empty())
+        return;
+
+    _width = image.width;
+    _height = image.height;
+    _channels = image.channels;
+
     glBindTexture(GL_TEXTURE_2D, _textureID);
 
     GLenum format = GL_RGBA;
     GLenum internalFormat = GL_SRGB_ALPHA;
-    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, _width, _height, 0, format, GL_UNSIGNED_BYTE, pixels);
-
-    glGenerateMipmap(GL_TEXTURE_2D);
+    int width = _width;
+    int height = _height;
+    for (std::size_t level = 0; level < image.levels.size(); level++)
+    {
+        glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat, width, height, 0, format,
+                     GL_UNSIGNED_BYTE, image.levels[level].data());
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+    if (image.levels.size() == 1)
+    {
+        // Default maximum level, the placeholder limited it to the base level
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000);
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    else
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(image.levels.size()) - 1);
+    }
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
 
-    stbi_image_free(pixels);
-    ES::Utils::Log::Info(fmt::format("Texture loaded: {}", texturePath));
+    _loaded = true;
 }
 
 void Texture::Bind() const
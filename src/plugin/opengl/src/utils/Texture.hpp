@@ -3,19 +3,42 @@
 #include <GL/glew.h>
 
 #include "Logger.hpp"
+#include "TextureImage.hpp"
 #include <fmt/format.h>
+#include <glm/glm.hpp>
 
 namespace ES::Plugin::OpenGL::Utils {
 
 class Texture {
   public:
+    /**
+     * @brief Load an image file and upload it, blocking until it is done.
+     *
+     * @see Resource::TextureLoader to load textures without blocking.
+     */
     explicit Texture(const std::string &texturePath);
+
+    /**
+     * @brief Create a 1x1 texture of the given color, standing in until the real image is uploaded with Upload.
+     * The OpenGL texture is kept by Upload, so its id can be used right away.
+     */
+    explicit Texture(const glm::u8vec4 &placeholderColor);
+
     ~Texture();
 
     void Bind() const;
 
+    /**
+     * @brief Replace the content of the texture with a decoded image. The mip chain is generated on the GPU if the
+     * image only has one level.
+     */
+    void Upload(const TextureImage &image);
+
     [[nodiscard]] int GetWidth() const { return _width; }
     [[nodiscard]] int GetHeight() const { return _height; }
+    [[nodiscard]] GLuint GetID() const { return _textureID; }
+    /// @brief Whether the image was uploaded, false while the placeholder is used.
+    [[nodiscard]] bool IsLoaded() const { return _loaded; }
 
   private:
     void LoadTexture(const std::string &texturePath);
@@ -25,6 +48,7 @@ class Texture {
     int _height = 0;
     int _channels = 0;
     GLuint _textureID = 0;
+    bool _loaded = false;
 };
 
 } // namespace ES::Plugin::OpenGL::Utils
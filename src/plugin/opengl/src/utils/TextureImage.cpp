@@ -0,0 +1,108 @@
+#include "TextureImage.hpp"
+
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fmt/format.h>
+#include <stb_image.h>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+namespace {
+const std::array<float, 256> &GetSRGBToLinearTable()
+{
+    static const std::array<float, 256> table = []() {
+        std::array<float, 256> values{};
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            float c = static_cast<float>(i) / 255.0f;
+            values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+uint8_t LinearToSRGB(float c)
+{
+    c = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+    return static_cast<uint8_t>(std::clamp(c * 255.0f + 0.5f, 0.0f, 255.0f));
+}
+} // namespace
+
+bool TextureImage::LoadFromFile(const std::string &path)
+{
+    uint8_t *pixels = stbi_load(path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+    if (!pixels)
+    {
+        ES::Utils::Log::Error("Failed to load texture image (" + path + "): " + stbi_failure_reason());
+        return false;
+    }
+
+    levels.assign(1, std::vector<uint8_t>(static_cast<std::size_t>(width) * height * 4));
+    std::memcpy(levels[0].data(), pixels, levels[0].size());
+    stbi_image_free(pixels);
+    return true;
+}
+
+void TextureImage::GenerateMipmaps()
+{
+    if (levels.empty())
+        return;
+    levels.resize(1);
+
+    const auto &toLinear = GetSRGBToLinearTable();
+    int srcWidth = width;
+    int srcHeight = height;
+    while (srcWidth > 1 || srcHeight > 1)
+    {
+        int dstWidth = std::max(1, srcWidth / 2);
+        int dstHeight = std::max(1, srcHeight / 2);
+        const std::vector<uint8_t> &src = levels.back();
+        std::vector<uint8_t> dst(static_cast<std::size_t>(dstWidth) * dstHeight * 4);
+        auto offset = [srcWidth](int x, int y) { return (static_cast<std::size_t>(y) * srcWidth + x) * 4; };
+
+        // 2x2 box filter, the last row or column of an odd level is clamped
+        for (int y = 0; y < dstHeight; y++)
+        {
+            int y0 = std::min(y * 2, srcHeight - 1);
+            int y1 = std::min(y * 2 + 1, srcHeight - 1);
+            for (int x = 0; x < dstWidth; x++)
+            {
+                int x0 = std::min(x * 2, srcWidth - 1);
+                int x1 = std::min(x * 2 + 1, srcWidth - 1);
+                std::array<std::size_t, 4> texels = {offset(x0, y0), offset(x1, y0), offset(x0, y1), offset(x1, y1)};
+
+                std::size_t out = (static_cast<std::size_t>(y) * dstWidth + x) * 4;
+                for (int channel = 0; channel < 3; channel++)
+                {
+                    float sum = 0.0f;
+                    for (std::size_t texel : texels)
+                        sum += toLinear[src[texel + channel]];
+                    dst[out + channel] = LinearToSRGB(sum * 0.25f);
+                }
+                unsigned int alpha = 0;
+                for (std::size_t texel : texels)
+                    alpha += src[texel + 3];
+                dst[out + 3] = static_cast<uint8_t>((alpha + 2) / 4);
+            }
+        }
+
+        levels.push_back(std::move(dst));
+        srcWidth = dstWidth;
+        srcHeight = dstHeight;
+    }
+}
+
+std::size_t TextureImage::GetByteSize() const
+{
+    std::size_t size = 0;
+    for (const auto &level : levels)
+        size += level.size();
+    return size;
+}
+
+} // namespace ES::Plugin::OpenGL::Utils
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+/**
+ * Decoded RGBA pixels of a texture, and optionally its mip chain, ready to be uploaded by Texture::Upload.
+ * It doesn't use OpenGL, so it can be loaded on a worker thread.
+ */
+struct TextureImage {
+    int width = 0;
+    int height = 0;
+    /// @brief Number of channels of the image file. Pixels are always stored as RGBA.
+    int channels = 0;
+    /// @brief RGBA pixels of every mip level, the first one being the full image.
+    std::vector<std::vector<uint8_t>> levels;
+
+    /**
+     * @brief Decode an image file into the first level.
+     *
+     * @return false if the file can't be decoded.
+     */
+    bool LoadFromFile(const std::string &path);
+
+    /**
+     * @brief Build the mip chain from the first level, down to 1x1. Colors are averaged in linear space, as the
+     * texture is sampled as sRGB.
+     */
+    void GenerateMipmaps();
+
+    /**
+     * @brief Get the size of the pixels of every level, in bytes.
+     */
+    std::size_t GetByteSize() const;
+};
+
+} // namespace ES::Plugin::OpenGL::Utils
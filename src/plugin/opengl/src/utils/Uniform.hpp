@@ -0,0 +1,65 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief Typed handle to a uniform of a shader program, resolved once when the program is linked.
+ *
+ * Setting a uniform through a handle is a single glUniform call, without any lookup by name. A handle to a uniform
+ * the program doesn't have is invalid, and setting it does nothing.
+ *
+ * @tparam T Type of the uniform: int, float, glm::vec2, glm::vec3, glm::vec4, glm::mat3 or glm::mat4.
+ * @see ShaderProgram::getUniform
+ *
+ * @example "Setting a uniform every frame"
+ * @code
+ * auto projection = shader.getUniform<glm::mat4>("Projection");
+ * // ...
+ * shader.use();
+ * projection.Set(camera.projection);
+ * @endcode
+ */
+template <typename T> class Uniform {
+  public:
+    Uniform() = default;
+    explicit Uniform(GLint location) : _location(location) {}
+
+    /**
+     * @brief Set the value of the uniform in the shader program currently in use.
+     */
+    void Set(const T &value) const;
+
+    inline bool IsValid() const { return _location != -1; }
+    inline GLint GetLocation() const { return _location; }
+
+  private:
+    GLint _location = -1;
+};
+
+template <> inline void Uniform<int>::Set(const int &value) const { glUniform1i(_location, value); }
+template <> inline void Uniform<float>::Set(const float &value) const { glUniform1f(_location, value); }
+template <> inline void Uniform<glm::vec2>::Set(const glm::vec2 &value) const
+{
+    glUniform2fv(_location, 1, glm::value_ptr(value));
+}
+template <> inline void Uniform<glm::vec3>::Set(const glm::vec3 &value) const
+{
+    glUniform3fv(_location, 1, glm::value_ptr(value));
+}
+template <> inline void Uniform<glm::vec4>::Set(const glm::vec4 &value) const
+{
+    glUniform4fv(_location, 1, glm::value_ptr(value));
+}
+template <> inline void Uniform<glm::mat3>::Set(const glm::mat3 &value) const
+{
+    glUniformMatrix3fv(_location, 1, GL_FALSE, glm::value_ptr(value));
+}
+template <> inline void Uniform<glm::mat4>::Set(const glm::mat4 &value) const
+{
+    glUniformMatrix4fv(_location, 1, GL_FALSE, glm::value_ptr(value));
+}
+} // namespace ES::Plugin::OpenGL::Utils
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include "Material.hpp"
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief Uniform block of the camera, uploaded once per frame.
+ *
+ * @code
+ * layout (std140, binding = 0) uniform CameraBlock {
+ *     mat4 ViewProjection;
+ *     vec3 CamPos;
+ * };
+ * @endcode
+ */
+struct CameraBlock {
+    static constexpr GLuint BINDING = 0;
+
+    glm::mat4 viewProjection = glm::mat4(1.0f);
+    glm::vec3 position = glm::vec3(0.0f);
+    float padding = 0.0f;
+};
+
+/**
+ * @brief Uniform block of the lights, uploaded once per frame. It describes the light cluster grid, the lights and
+ * the lists of lights of every cluster being in storage buffers, see Resource::LightClusters.
+ *
+ * @code
+ * layout (std140, binding = 1) uniform LightBlock {
+ *     mat4 View;
+ *     uvec4 ClusterGrid; // xyz: number of clusters, w: number of directional lights
+ *     vec4 ClusterScale; // xy: size of a cluster in pixels, zw: scale and bias giving the slice of a view depth
+ *     vec3 Ambient;
+ * };
+ * @endcode
+ */
+struct LightBlock {
+    static constexpr GLuint BINDING = 1;
+
+    glm::mat4 view = glm::mat4(1.0f);
+    glm::uvec4 clusterGrid = glm::uvec4(0);
+    glm::vec4 clusterScale = glm::vec4(0.0f);
+    glm::vec3 ambient = glm::vec3(0.0f);
+    float padding = 0.0f;
+};
+
+/**
+ * @brief Uniform block of a material. Every material used in a frame is uploaded to a single buffer, and draws
+ * select theirs by binding a range of it.
+ *
+ * @code
+ * layout (std140, binding = 2) uniform MaterialBlock {
+ *     vec3 Ka;
+ *     vec3 Kd;
+ *     vec3 Ks;
+ *     float Shiness;
+ * } Material;
+ * @endcode
+ */
+struct MaterialBlock {
+    static constexpr GLuint BINDING = 2;
+
+    glm::vec3 ka = glm::vec3(0.0f);
+    float padding0 = 0.0f;
+    glm::vec3 kd = glm::vec3(0.0f);
+    float padding1 = 0.0f;
+    glm::vec3 ks = glm::vec3(0.0f);
+    float shiness = 0.0f;
+
+    MaterialBlock() = default;
+    explicit MaterialBlock(const Material &material)
+        : ka(material.Ka), kd(material.Kd), ks(material.Ks), shiness(material.Shiness)
+    {
+    }
+};
+
+static_assert(sizeof(CameraBlock) == 80, "CameraBlock must match its std140 layout");
+static_assert(sizeof(LightBlock) == 112, "LightBlock must match its std140 layout");
+static_assert(sizeof(MaterialBlock) == 48, "MaterialBlock must match its std140 layout");
+} // namespace ES::Plugin::OpenGL::Utils
@@ -0,0 +1,57 @@
+#include "UniformBuffer.hpp"
+
+#include <algorithm>
+
+namespace ES::Plugin::OpenGL::Utils {
+
+void UniformBuffer::Create(GLuint binding, GLsizeiptr size)
+{
+    _binding = binding;
+    _size = size;
+    glGenBuffers(1, &_id);
+    glBindBuffer(GL_UNIFORM_BUFFER, _id);
+    glBufferData(GL_UNIFORM_BUFFER, _size, nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    Bind();
+}
+
+void UniformBuffer::Reserve(GLsizeiptr size)
+{
+    if (size <= _size)
+        return;
+
+    _size = std::max(size, _size + _size / 2);
+    glBindBuffer(GL_UNIFORM_BUFFER, _id);
+    glBufferData(GL_UNIFORM_BUFFER, _size, nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void UniformBuffer::Update(const void *data, GLsizeiptr size, GLintptr offset) const
+{
+    glBindBuffer(GL_UNIFORM_BUFFER, _id);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void UniformBuffer::Bind() const { glBindBufferBase(GL_UNIFORM_BUFFER, _binding, _id); }
+
+void UniformBuffer::BindRange(GLintptr offset, GLsizeiptr size) const
+{
+    glBindBufferRange(GL_UNIFORM_BUFFER, _binding, _id, offset, size);
+}
+
+void UniformBuffer::Destroy()
+{
+    glDeleteBuffers(1, &_id);
+    _id = 0;
+    _size = 0;
+}
+
+GLint UniformBuffer::GetOffsetAlignment()
+{
+    static GLint alignment = 0;
+    if (alignment == 0)
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    return alignment;
+}
+} // namespace ES::Plugin::OpenGL::Utils
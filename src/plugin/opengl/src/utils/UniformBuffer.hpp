@@ -0,0 +1,84 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <type_traits>
+
+namespace ES::Plugin::OpenGL::Utils {
+/**
+ * @brief An OpenGL uniform buffer object, holding the data of a uniform block laid out with std140.
+ *
+ * The buffer is attached to a binding point, which shaders refer to with `layout (std140, binding = N)` or
+ * ShaderProgram::bindUniformBlock. Data shared by many draws (camera, lights) is uploaded once per frame instead of
+ * being set as uniforms of every shader program.
+ *
+ * @see UniformBlocks.hpp for the blocks used by the default shader.
+ */
+class UniformBuffer {
+  public:
+    UniformBuffer() = default;
+    ~UniformBuffer() = default;
+
+    /**
+     * @brief Create the buffer and attach it to its binding point.
+     *
+     * @param binding The binding point of the buffer.
+     * @param size The initial size of the buffer, in bytes.
+     */
+    void Create(GLuint binding, GLsizeiptr size);
+
+    /**
+     * @brief Grow the buffer so it holds at least size bytes. Its content is lost if it grows.
+     */
+    void Reserve(GLsizeiptr size);
+
+    /**
+     * @brief Upload data to the buffer.
+     *
+     * @param data The data to upload.
+     * @param size Size of the data, in bytes.
+     * @param offset Offset in the buffer where the data is written, in bytes.
+     */
+    void Update(const void *data, GLsizeiptr size, GLintptr offset = 0) const;
+
+    /**
+     * @brief Upload a std140 block to the buffer.
+     * @note Pointers are excluded, so Update(data, size) always picks the raw overload.
+     */
+    template <typename TBlock>
+        requires(!std::is_pointer_v<TBlock>)
+    void Update(const TBlock &block, GLintptr offset = 0) const
+    {
+        Update(&block, sizeof(TBlock), offset);
+    }
+
+    /**
+     * @brief Attach the whole buffer to its binding point.
+     */
+    void Bind() const;
+
+    /**
+     * @brief Attach a range of the buffer to its binding point, to select one of the blocks it holds.
+     *
+     * @param offset Offset of the range, must be a multiple of GetOffsetAlignment().
+     * @param size Size of the range, in bytes.
+     */
+    void BindRange(GLintptr offset, GLsizeiptr size) const;
+
+    void Destroy();
+
+    inline GLuint GetId() const { return _id; }
+    inline GLuint GetBinding() const { return _binding; }
+    inline GLsizeiptr GetSize() const { return _size; }
+
+    /**
+     * @brief Get the alignment required by the implementation for the offset of a range.
+     */
+    static GLint GetOffsetAlignment();
+
+  private:
+    GLuint _id = 0;
+    GLuint _binding = 0;
+    GLsizeiptr _size = 0;
+};
+} // namespace ES::Plugin::OpenGL::Utils
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include "BoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ES::Plugin::OpenGL;
+
+// The frustum of the identity matrix is the cube from -1 to 1 on every axis
+static const Utils::Frustum UNIT_FRUSTUM(glm::mat4(1.0f));
+
+/**
+ * @brief Line of count boxes of size 0.1 along the x axis, starting at start and spaced by step.
+ */
+static std::vector<Utils::BoundingBox> CreateLine(std::size_t count, float start, float step)
+{
+    std::vector<Utils::BoundingBox> boxes;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        glm::vec3 min(start + static_cast<float>(i) * step, -0.05f, -0.05f);
+        boxes.emplace_back(min, min + glm::vec3(0.1f));
+    }
+    return boxes;
+}
+
+/**
+ * @brief Indices of the boxes at least partially inside the frustum, tested one by one.
+ */
+static std::vector<uint32_t> CullBruteForce(const std::vector<Utils::BoundingBox> &boxes)
+{
+    std::vector<uint32_t> visible;
+    for (uint32_t i = 0; i < boxes.size(); i++)
+    {
+        if (UNIT_FRUSTUM.Classify(boxes[i]) != Utils::Frustum::Result::Outside)
+            visible.push_back(i);
+    }
+    return visible;
+}
+
+static std::vector<uint32_t> Cull(const Utils::BoundingVolumeHierarchy &bvh,
+                                  ES::Utils::ThreadPool *threadPool = nullptr)
+{
+    std::vector<uint32_t> visible;
+    bvh.Cull(UNIT_FRUSTUM, visible, threadPool);
+    std::sort(visible.begin(), visible.end());
+    return visible;
+}
+
+TEST(BoundingVolumeHierarchy, culls_like_brute_force)
+{
+    std::vector<Utils::BoundingBox> boxes = CreateLine(100, -5.0f, 0.1f);
+    Utils::BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+
+    EXPECT_EQ(bvh.Size(), boxes.size());
+    std::vector<uint32_t> visible = Cull(bvh);
+    EXPECT_FALSE(visible.empty());
+    EXPECT_EQ(visible, CullBruteForce(boxes));
+}
+
+TEST(BoundingVolumeHierarchy, culls_empty_tree)
+{
+    Utils::BoundingVolumeHierarchy bvh;
+    bvh.Build({});
+
+    EXPECT_TRUE(Cull(bvh).empty());
+}
+
+TEST(BoundingVolumeHierarchy, refits_moved_boxes)
+{
+    std::vector<Utils::BoundingBox> boxes = CreateLine(50, 10.0f, 0.5f);
+    Utils::BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+    EXPECT_TRUE(Cull(bvh).empty());
+
+    boxes[7] = Utils::BoundingBox(glm::vec3(-0.1f), glm::vec3(0.1f));
+    bvh.Refit(boxes);
+
+    EXPECT_EQ(Cull(bvh), std::vector<uint32_t>{7});
+}
+
+TEST(BoundingVolumeHierarchy, needs_rebuild_once_bounds_grew)
+{
+    std::vector<Utils::BoundingBox> boxes = CreateLine(50, 0.0f, 0.1f);
+    Utils::BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+    EXPECT_FALSE(bvh.NeedsRebuild());
+
+    boxes[0] = Utils::BoundingBox(glm::vec3(-100.0f), glm::vec3(-99.0f));
+    bvh.Refit(boxes);
+
+    EXPECT_TRUE(bvh.NeedsRebuild());
+}
+
+TEST(BoundingVolumeHierarchy, culls_large_tree_on_thread_pool)
+{
+    std::size_t count = Utils::BoundingVolumeHierarchy::PARALLEL_CULL_THRESHOLD * 2;
+    std::vector<Utils::BoundingBox> boxes = CreateLine(count, -4.0f, 8.0f / static_cast<float>(count));
+    Utils::BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+    ES::Utils::ThreadPool threadPool(4);
+
+    std::vector<uint32_t> serial = Cull(bvh);
+    std::vector<uint32_t> parallel = Cull(bvh, &threadPool);
+
+    EXPECT_FALSE(serial.empty());
+    EXPECT_EQ(parallel, serial);
+    EXPECT_EQ(parallel, CullBruteForce(boxes));
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include "Frustum.hpp"
+
+#include <array>
+
+using namespace ES::Plugin::OpenGL;
+
+// The frustum of the identity matrix is the cube from -1 to 1 on every axis
+static const Utils::Frustum UNIT_FRUSTUM(glm::mat4(1.0f));
+
+TEST(Frustum, classifies_boxes)
+{
+    EXPECT_EQ(UNIT_FRUSTUM.Classify(Utils::BoundingBox(glm::vec3(-0.5f), glm::vec3(0.5f))),
+              Utils::Frustum::Result::Inside);
+    EXPECT_EQ(UNIT_FRUSTUM.Classify(Utils::BoundingBox(glm::vec3(0.5f), glm::vec3(1.5f))),
+              Utils::Frustum::Result::Intersect);
+    EXPECT_EQ(UNIT_FRUSTUM.Classify(Utils::BoundingBox(glm::vec3(2.0f, -0.5f, -0.5f), glm::vec3(3.0f, 0.5f, 0.5f))),
+              Utils::Frustum::Result::Outside);
+    EXPECT_EQ(UNIT_FRUSTUM.Classify(Utils::BoundingBox(glm::vec3(-0.5f, -0.5f, -3.0f), glm::vec3(0.5f, 0.5f, -2.0f))),
+              Utils::Frustum::Result::Outside);
+}
+
+TEST(Frustum, classifies_boxes_around_the_frustum)
+{
+    EXPECT_EQ(UNIT_FRUSTUM.Classify(Utils::BoundingBox(glm::vec3(-2.0f), glm::vec3(2.0f))),
+              Utils::Frustum::Result::Intersect);
+}
+
+TEST(Frustum, tests_batches)
+{
+    std::array<float, 4> centerX = {0.0f, 1.2f, 3.0f, 0.0f};
+    std::array<float, 4> centerY = {0.0f, 0.0f, 0.0f, -5.0f};
+    std::array<float, 4> centerZ = {0.0f, 0.0f, 0.0f, 0.0f};
+    std::array<float, 4> extent = {0.5f, 0.5f, 0.5f, 0.5f};
+    std::array<uint8_t, 4> visible{};
+
+    UNIT_FRUSTUM.TestBatch(centerX.data(), centerY.data(), centerZ.data(), extent.data(), extent.data(), extent.data(),
+                           visible.size(), visible.data());
+
+    EXPECT_EQ(visible[0], 1);
+    EXPECT_EQ(visible[1], 1);
+    EXPECT_EQ(visible[2], 0);
+    EXPECT_EQ(visible[3], 0);
+}
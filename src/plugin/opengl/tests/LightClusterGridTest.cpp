@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "LightClusterGrid.hpp"
+#include "ThreadPool.hpp"
+
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+
+using namespace ES::Plugin::OpenGL;
+
+static constexpr float Z_NEAR = 1.0f;
+static constexpr float Z_FAR = 100.0f;
+static const glm::uvec3 GRID_SIZE(4, 4, 8);
+
+static glm::mat4 CreateProjection() { return glm::perspective(glm::radians(90.0f), 1.0f, Z_NEAR, Z_FAR); }
+
+/**
+ * @brief Index of the cluster holding a view space point, found the way the shaders do.
+ */
+static std::size_t ClusterOf(const Utils::LightClusterGrid &grid, const glm::vec3 &position)
+{
+    glm::vec4 clip = CreateProjection() * glm::vec4(position, 1.0f);
+    glm::uvec3 size = grid.GetSize();
+    auto x = static_cast<std::size_t>((clip.x / clip.w + 1.0f) * 0.5f * static_cast<float>(size.x));
+    auto y = static_cast<std::size_t>((clip.y / clip.w + 1.0f) * 0.5f * static_cast<float>(size.y));
+    auto z = static_cast<std::size_t>(std::floor(std::log(-position.z) * grid.GetDepthScale() + grid.GetDepthBias()));
+    return (z * size.y + y) * size.x + x;
+}
+
+static std::vector<uint32_t> LightsOf(const Utils::LightClusterGrid &grid, std::size_t cluster)
+{
+    const auto &range = grid.GetClusters()[cluster];
+    const auto &indices = grid.GetLightIndices();
+    return std::vector<uint32_t>(indices.begin() + range.offset, indices.begin() + range.offset + range.count);
+}
+
+TEST(LightClusterGrid, small_light_reaches_only_its_cluster)
+{
+    Utils::LightClusterGrid grid(GRID_SIZE);
+    // Center of the tile (2, 1), in the middle of the slice 3, which spans view depths from 5.62 to 10
+    glm::vec3 position(1.875f, -1.875f, -7.5f);
+    std::vector<glm::vec4> lights = {glm::vec4(position, 0.1f)};
+
+    grid.Build(CreateProjection(), Z_NEAR, Z_FAR, lights);
+
+    std::size_t home = ClusterOf(grid, position);
+    EXPECT_EQ(home, (3 * GRID_SIZE.y + 1) * GRID_SIZE.x + 2);
+    EXPECT_EQ(grid.GetLightIndices().size(), 1);
+    for (std::size_t cluster = 0; cluster < grid.GetClusters().size(); cluster++)
+    {
+        EXPECT_EQ(grid.GetClusters()[cluster].count, cluster == home ? 1 : 0) << "cluster " << cluster;
+    }
+}
+
+TEST(LightClusterGrid, light_reaches_only_clusters_its_sphere_touches)
+{
+    Utils::LightClusterGrid grid(GRID_SIZE);
+    // The sphere spans view depths from 5.5 to 9.5, in the slices 2 and 3. Its x over depth is above -0.5 and its y
+    // over depth below 0.5, so it doesn't reach the tiles of the first column nor of the last row.
+    glm::vec3 position(1.875f, -1.875f, -7.5f);
+    std::vector<glm::vec4> lights = {glm::vec4(position, 2.0f)};
+
+    grid.Build(CreateProjection(), Z_NEAR, Z_FAR, lights);
+
+    EXPECT_EQ(LightsOf(grid, ClusterOf(grid, position)), std::vector<uint32_t>{0});
+    std::size_t reached = 0;
+    for (uint32_t z = 0; z < GRID_SIZE.z; z++)
+    {
+        for (uint32_t y = 0; y < GRID_SIZE.y; y++)
+        {
+            for (uint32_t x = 0; x < GRID_SIZE.x; x++)
+            {
+                std::size_t cluster = (z * GRID_SIZE.y + y) * GRID_SIZE.x + x;
+                if (grid.GetClusters()[cluster].count == 0)
+                    continue;
+                reached++;
+                EXPECT_TRUE(z == 2 || z == 3) << "cluster " << x << " " << y << " " << z;
+                EXPECT_NE(x, 0) << "cluster " << x << " " << y << " " << z;
+                EXPECT_NE(y, GRID_SIZE.y - 1) << "cluster " << x << " " << y << " " << z;
+            }
+        }
+    }
+    EXPECT_GT(reached, 1);
+}
+
+TEST(LightClusterGrid, lights_outside_the_frustum_reach_no_cluster)
+{
+    Utils::LightClusterGrid grid(GRID_SIZE);
+    std::vector<glm::vec4> lights = {
+        glm::vec4(0.0f, 0.0f, 5.0f, 1.0f),
+        glm::vec4(0.0f, 0.0f, -150.0f, 1.0f),
+        glm::vec4(50.0f, 0.0f, -10.0f, 1.0f),
+    };
+
+    grid.Build(CreateProjection(), Z_NEAR, Z_FAR, lights);
+
+    EXPECT_TRUE(grid.GetLightIndices().empty());
+}
+
+TEST(LightClusterGrid, large_light_reaches_every_cluster)
+{
+    Utils::LightClusterGrid grid(GRID_SIZE);
+    std::vector<glm::vec4> lights = {glm::vec4(0.0f, 0.0f, -50.0f, 1000.0f)};
+
+    grid.Build(CreateProjection(), Z_NEAR, Z_FAR, lights);
+
+    ASSERT_EQ(grid.GetLightIndices().size(), grid.GetClusters().size());
+    for (const auto &cluster : grid.GetClusters())
+    {
+        EXPECT_EQ(cluster.count, 1);
+    }
+}
+
+TEST(LightClusterGrid, many_lights_match_lights_built_one_by_one)
+{
+    // Enough lights for the build to be split across threads
+    std::vector<glm::vec4> lights;
+    for (std::size_t i = 0; i < Utils::LightClusterGrid::PARALLEL_BUILD_THRESHOLD * 2; i++)
+    {
+        float t = static_cast<float>(i);
+        lights.emplace_back(std::sin(t) * 20.0f, std::cos(t * 0.7f) * 20.0f, -2.0f - std::fmod(t * 3.7f, 90.0f),
+                            1.0f + std::fmod(t, 5.0f));
+    }
+    ES::Utils::ThreadPool threadPool(4);
+    Utils::LightClusterGrid grid(GRID_SIZE);
+    grid.Build(CreateProjection(), Z_NEAR, Z_FAR, lights, &threadPool);
+
+    std::vector<std::vector<uint32_t>> expected(grid.GetClusters().size());
+    Utils::LightClusterGrid single(GRID_SIZE);
+    for (uint32_t light = 0; light < lights.size(); light++)
+    {
+        single.Build(CreateProjection(), Z_NEAR, Z_FAR, std::span<const glm::vec4>(&lights[light], 1));
+        for (std::size_t cluster = 0; cluster < expected.size(); cluster++)
+        {
+            if (single.GetClusters()[cluster].count > 0)
+                expected[cluster].push_back(light);
+        }
+    }
+
+    for (std::size_t cluster = 0; cluster < expected.size(); cluster++)
+    {
+        EXPECT_EQ(LightsOf(grid, cluster), expected[cluster]) << "cluster " << cluster;
+    }
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "RenderQueue.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace ES::Plugin::OpenGL;
+
+static void Submit(Resource::RenderQueue &queue, const entt::hashed_string &material,
+                   const entt::hashed_string &texture, bool hasTexture, const entt::hashed_string &model)
+{
+    queue.Submit(entt::hashed_string{"default"}, material, texture, hasTexture, model, glm::mat4(1.0f),
+                 glm::mat3(1.0f));
+}
+
+TEST(RenderQueue, sorts_and_batches)
+{
+    Resource::RenderQueue queue;
+    entt::hashed_string none{"none"};
+
+    Submit(queue, entt::hashed_string{"red"}, none, false, entt::hashed_string{"cube"});
+    Submit(queue, entt::hashed_string{"blue"}, entt::hashed_string{"wood"}, true, entt::hashed_string{"cube"});
+    Submit(queue, entt::hashed_string{"red"}, none, false, entt::hashed_string{"sphere"});
+    Submit(queue, entt::hashed_string{"red"}, none, false, entt::hashed_string{"cube"});
+    Submit(queue, entt::hashed_string{"blue"}, none, false, entt::hashed_string{"cube"});
+    queue.Sort();
+
+    const auto &batches = queue.GetBatches();
+    ASSERT_EQ(batches.size(), 4);
+    // Materials first, in submission order, then untextured before textured meshes
+    EXPECT_EQ(batches[0].material, entt::hashed_string{"red"});
+    EXPECT_EQ(batches[0].model, entt::hashed_string{"cube"});
+    EXPECT_EQ(batches[0].instanceCount, 2);
+    EXPECT_EQ(batches[1].model, entt::hashed_string{"sphere"});
+    EXPECT_EQ(batches[2].material, entt::hashed_string{"blue"});
+    EXPECT_FALSE(batches[2].hasTexture);
+    EXPECT_TRUE(batches[3].hasTexture);
+
+    GLuint firstInstance = 0;
+    for (const auto &batch : batches)
+    {
+        EXPECT_EQ(batch.firstInstance, firstInstance);
+        firstInstance += batch.instanceCount;
+    }
+    EXPECT_EQ(firstInstance, queue.GetInstances().size());
+}
+
+TEST(RenderQueue, saturated_indices_keep_batches_apart)
+{
+    Resource::RenderQueue queue;
+    std::vector<std::string> names;
+    names.reserve(Resource::RenderQueue::MAX_INDEX + 2);
+    for (std::size_t i = 0; i < Resource::RenderQueue::MAX_INDEX + 2; i++)
+    {
+        names.push_back("texture" + std::to_string(i));
+    }
+
+    entt::hashed_string first{"first"};
+    entt::hashed_string second{"second"};
+    entt::hashed_string cube{"cube"};
+    for (const auto &name : names)
+    {
+        Submit(queue, first, entt::hashed_string{name.c_str()}, true, cube);
+    }
+    Submit(queue, second, entt::hashed_string{"none"}, false, cube);
+    queue.Sort();
+
+    // Textures past the last index share it, but don't spill into the material of the key
+    const auto &batches = queue.GetBatches();
+    ASSERT_EQ(batches.size(), names.size() + 1);
+    for (std::size_t i = 0; i < names.size(); i++)
+    {
+        ASSERT_EQ(batches[i].material, first);
+    }
+    EXPECT_EQ(batches.back().material, second);
+}
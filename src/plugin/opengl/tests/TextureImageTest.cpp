@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "TextureImage.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace ES::Plugin::OpenGL;
+
+static Utils::TextureImage CreateImage(int width, int height, const std::vector<uint8_t> &pixels)
+{
+    Utils::TextureImage image;
+    image.width = width;
+    image.height = height;
+    image.channels = 4;
+    image.levels.push_back(pixels);
+    return image;
+}
+
+TEST(TextureImage, generates_levels_down_to_one_texel)
+{
+    Utils::TextureImage image = CreateImage(4, 2, std::vector<uint8_t>(4 * 2 * 4, 255));
+
+    image.GenerateMipmaps();
+
+    ASSERT_EQ(image.levels.size(), 3);
+    EXPECT_EQ(image.levels[0].size(), 4 * 2 * 4);
+    EXPECT_EQ(image.levels[1].size(), 2 * 1 * 4);
+    EXPECT_EQ(image.levels[2].size(), 1 * 1 * 4);
+    EXPECT_EQ(image.GetByteSize(), 32 + 8 + 4);
+}
+
+TEST(TextureImage, clamps_odd_sizes)
+{
+    Utils::TextureImage image = CreateImage(3, 1, std::vector<uint8_t>(3 * 1 * 4, 255));
+
+    image.GenerateMipmaps();
+
+    ASSERT_EQ(image.levels.size(), 2);
+    EXPECT_EQ(image.levels[1].size(), 4);
+}
+
+TEST(TextureImage, keeps_uniform_colors)
+{
+    std::vector<uint8_t> pixels;
+    for (int i = 0; i < 4 * 4; i++)
+    {
+        pixels.insert(pixels.end(), {10, 128, 250, 200});
+    }
+    Utils::TextureImage image = CreateImage(4, 4, pixels);
+
+    image.GenerateMipmaps();
+
+    ASSERT_EQ(image.levels.size(), 3);
+    for (const auto &level : image.levels)
+    {
+        for (std::size_t i = 0; i < level.size(); i += 4)
+        {
+            EXPECT_EQ(level[i], 10);
+            EXPECT_EQ(level[i + 1], 128);
+            EXPECT_EQ(level[i + 2], 250);
+            EXPECT_EQ(level[i + 3], 200);
+        }
+    }
+}
+
+TEST(TextureImage, averages_colors_in_linear_space)
+{
+    // A black and a white texel: their average is half the light, brighter than the sRGB value 128
+    Utils::TextureImage image = CreateImage(2, 1, {0, 0, 0, 0, 255, 255, 255, 255});
+
+    image.GenerateMipmaps();
+
+    ASSERT_EQ(image.levels.size(), 2);
+    const auto &texel = image.levels[1];
+    EXPECT_EQ(texel[0], 188);
+    EXPECT_EQ(texel[1], 188);
+    EXPECT_EQ(texel[2], 188);
+    // Alpha is not a color, it is averaged as is
+    EXPECT_EQ(texel[3], 128);
+}
+
+TEST(TextureImage, regenerates_from_the_first_level)
+{
+    Utils::TextureImage image = CreateImage(2, 2, std::vector<uint8_t>(2 * 2 * 4, 255));
+    image.GenerateMipmaps();
+    image.levels[0].assign(2 * 2 * 4, 0);
+
+    image.GenerateMipmaps();
+
+    ASSERT_EQ(image.levels.size(), 2);
+    EXPECT_EQ(image.levels[1], std::vector<uint8_t>(4, 0));
+}
+
+TEST(TextureImage, ignores_empty_image)
+{
+    Utils::TextureImage image;
+
+    image.GenerateMipmaps();
+
+    EXPECT_TRUE(image.levels.empty());
+    EXPECT_EQ(image.GetByteSize(), 0);
+}
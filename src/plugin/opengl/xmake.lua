@@ -7,6 +7,8 @@ includes("../window/xmake.lua")
 includes("../colors/xmake.lua")
 includes("../math/xmake.lua")
 includes("../rendering-pipeline/xmake.lua")
+includes("../relationship/xmake.lua")
+includes("../../utils/thread-pool/xmake.lua")
 
 target("PluginOpenGL")
     set_group(PLUGINS_GROUP_NAME)
@@ -26,6 +28,8 @@ target("PluginOpenGL")
     add_deps("PluginMath")
     add_deps("PluginColors")
     add_deps("PluginRenderingPipeline")
+    add_deps("PluginRelationship")
+    add_deps("UtilsThreadPool", {public = true})
 
     add_files("src/**.cpp")
 
@@ -54,9 +58,10 @@ for _, file in ipairs(os.files("tests/**.cpp")) do
         set_languages("cxx20")
         add_links("gtest")
         add_tests("default")
-        add_packages("entt", "glm", "spdlog", "fmt", "glfw", "glew", "gtest")
+        add_packages("entt", "glm", "spdlog", "fmt", "glfw", "glew", "stb", "gtest")
 
-        add_deps("OpenGL")
+        add_deps("EngineSquaredCore")
+        add_deps("PluginOpenGL")
 
         add_files(file)
         add_files("tests/main.cpp")
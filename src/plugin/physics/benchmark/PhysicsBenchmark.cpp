@@ -0,0 +1,366 @@
+/**
+ * Headless physics benchmark.
+ *
+ * Runs standard scenes through a Core with the physics plugin, without any window or renderer, for a fixed number
+ * of ticks. The fixed time systems are stepped directly, so no time is spent waiting for the real-time clock.
+ *
+ * Memory is reported as the growth of the resident set size while a scene runs, the process peak being shared by
+ * every scene run before.
+ *
+ * Usage: PhysicsBenchmark [ticks] [--csv]
+ */
+
+#include "Core.hpp"
+#include "Entity.hpp"
+#include "FixedTimeUpdate.hpp"
+#include "JoltPhysics.hpp"
+#include "Mesh.hpp"
+#include "Shutdown.hpp"
+#include "Startup.hpp"
+#include "Transform.hpp"
+
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/HeightFieldShape.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/Constraints/PointConstraint.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fmt/format.h>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__linux__)
+    #include <unistd.h>
+#endif
+
+using ES::Plugin::Object::Component::Mesh;
+using ES::Plugin::Object::Component::Transform;
+using namespace ES::Plugin::Physics;
+
+namespace {
+struct Scene {
+    const char *name;
+    std::function<void(Resource::PhysicsConfig &)> configure;
+    std::function<void(ES::Engine::Core &)> build;
+};
+
+struct SceneResult {
+    std::string name;
+    uint32_t numBodies = 0;
+    double averageTick = 0.0;
+    double maxTick = 0.0;
+    double averageStep = 0.0;
+    double averageSync = 0.0;
+    double averageDispatch = 0.0;
+    uint64_t tempAllocatorPeak = 0;
+    uint64_t stateSize = 0;
+    long rssGrowth = 0;
+};
+
+/// @brief Current resident set size of the process in kilobytes, or 0 when it is not available.
+long GetCurrentRss()
+{
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    long size = 0;
+    long resident = 0;
+    if (!(statm >> size >> resident))
+    {
+        return 0;
+    }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+    return 0;
+#endif
+}
+
+/// @brief Ids of the fixed time systems syncing bodies, transforms and soft body meshes, whose time is reported as
+/// the sync time.
+std::unordered_set<ES::Utils::FunctionContainer::FunctionID> GetSyncSystemIds()
+{
+    using SystemFunction = void (*)(ES::Engine::Core &);
+    std::unordered_set<ES::Utils::FunctionContainer::FunctionID> ids;
+    for (SystemFunction system : {&System::ResetMovedInterpolations, &System::SyncRigidBodiesToTransforms,
+                                  &System::SyncTransformsToRigidBodies, &System::StoreInterpolatedTransforms,
+                                  &System::SyncSoftBodiesData})
+    {
+        ids.insert(ES::Engine::System<SystemFunction>::GetCallableID(system));
+    }
+    return ids;
+}
+
+ES::Engine::Entity AddRigidBody(ES::Engine::Core &core, const std::shared_ptr<JPH::ShapeSettings> &shape,
+                                const glm::vec3 &position, JPH::EMotionType motionType)
+{
+    ES::Engine::Entity entity = core.CreateEntity();
+    entity.AddComponent<Transform>(core, position);
+    entity.AddComponent<Component::RigidBody3D>(core, shape, motionType,
+                                                motionType == JPH::EMotionType::Static ? Utils::Layers::NON_MOVING
+                                                                                        : Utils::Layers::MOVING);
+    return entity;
+}
+
+void AddFloor(ES::Engine::Core &core)
+{
+    AddRigidBody(core, std::make_shared<JPH::BoxShapeSettings>(JPH::Vec3(100.0f, 1.0f, 100.0f)),
+                 glm::vec3(0.0f, -1.0f, 0.0f), JPH::EMotionType::Static);
+}
+
+/// @brief A pyramid of boxes, 20 boxes wide at its base.
+void BuildPyramid(ES::Engine::Core &core)
+{
+    constexpr int BASE = 20;
+    auto box = std::make_shared<JPH::BoxShapeSettings>(JPH::Vec3(0.5f, 0.5f, 0.5f));
+
+    AddFloor(core);
+    for (int level = 0; level < BASE; level++)
+    {
+        for (int i = 0; i < BASE - level; i++)
+        {
+            float x = static_cast<float>(i) * 1.02f + static_cast<float>(level) * 0.51f - BASE * 0.51f;
+            AddRigidBody(core, box, glm::vec3(x, 0.5f + static_cast<float>(level) * 1.0f, 0.0f),
+                         JPH::EMotionType::Dynamic);
+        }
+    }
+}
+
+/// @brief 10k spheres falling onto a heightfield.
+void BuildSpheresOnHeightField(ES::Engine::Core &core)
+{
+    constexpr uint32_t SAMPLES = 128;
+    constexpr int SIDE = 25;
+    constexpr int LAYERS = 16;
+
+    std::vector<float> heights(SAMPLES * SAMPLES);
+    for (uint32_t z = 0; z < SAMPLES; z++)
+    {
+        for (uint32_t x = 0; x < SAMPLES; x++)
+        {
+            heights[z * SAMPLES + x] = std::sin(static_cast<float>(x) * 0.2f) * std::cos(static_cast<float>(z) * 0.2f);
+        }
+    }
+    auto heightField = std::make_shared<JPH::HeightFieldShapeSettings>(
+        heights.data(), JPH::Vec3(-64.0f, 0.0f, -64.0f), JPH::Vec3(1.0f, 1.0f, 1.0f), SAMPLES);
+    AddRigidBody(core, heightField, glm::vec3(0.0f), JPH::EMotionType::Static);
+
+    auto sphere = std::make_shared<JPH::SphereShapeSettings>(0.5f);
+    for (int y = 0; y < LAYERS; y++)
+    {
+        for (int z = 0; z < SIDE; z++)
+        {
+            for (int x = 0; x < SIDE; x++)
+            {
+                glm::vec3 position(static_cast<float>(x - SIDE / 2) * 1.5f, 5.0f + static_cast<float>(y) * 1.5f,
+                                   static_cast<float>(z - SIDE / 2) * 1.5f);
+                AddRigidBody(core, sphere, position, JPH::EMotionType::Dynamic);
+            }
+        }
+    }
+}
+
+/// @brief 20 chains of 50 links, each link attached to the previous one by a point constraint.
+void BuildChains(ES::Engine::Core &core)
+{
+    constexpr int CHAINS = 20;
+    constexpr int LINKS = 50;
+    constexpr float LINK_HALF_LENGTH = 0.25f;
+    constexpr float SPACING = 2.0f * LINK_HALF_LENGTH + 0.05f;
+
+    auto &physicsSystem = core.GetResource<Resource::PhysicsManager>().GetPhysicsSystem();
+    auto link = std::make_shared<JPH::BoxShapeSettings>(JPH::Vec3(0.05f, 0.05f, LINK_HALF_LENGTH));
+
+    AddFloor(core);
+    for (int c = 0; c < CHAINS; c++)
+    {
+        float x = static_cast<float>(c - CHAINS / 2) * 2.0f;
+        ES::Engine::Entity previous =
+            AddRigidBody(core, link, glm::vec3(x, 30.0f, 0.0f), JPH::EMotionType::Static);
+
+        for (int l = 1; l < LINKS; l++)
+        {
+            float z = static_cast<float>(l) * SPACING;
+            ES::Engine::Entity current = AddRigidBody(core, link, glm::vec3(x, 30.0f, z), JPH::EMotionType::Dynamic);
+
+            JPH::PointConstraintSettings settings;
+            settings.mPoint1 = settings.mPoint2 = JPH::RVec3(x, 30.0f, z - SPACING * 0.5f);
+            physicsSystem.AddConstraint(
+                settings.Create(*previous.GetComponents<Component::RigidBody3D>(core).body,
+                                *current.GetComponents<Component::RigidBody3D>(core).body));
+            previous = current;
+        }
+    }
+}
+
+/// @brief 4 cloths of 30x30 vertices falling onto a sphere.
+void BuildCloths(ES::Engine::Core &core)
+{
+    constexpr uint32_t RESOLUTION = 30;
+    constexpr float SPACING = 0.2f;
+
+    AddFloor(core);
+    AddRigidBody(core, std::make_shared<JPH::SphereShapeSettings>(2.0f), glm::vec3(0.0f, 2.0f, 0.0f),
+                 JPH::EMotionType::Static);
+
+    for (int c = 0; c < 4; c++)
+    {
+        Mesh mesh;
+        for (uint32_t z = 0; z < RESOLUTION; z++)
+        {
+            for (uint32_t x = 0; x < RESOLUTION; x++)
+            {
+                mesh.vertices.emplace_back((static_cast<float>(x) - RESOLUTION * 0.5f) * SPACING, 0.0f,
+                                           (static_cast<float>(z) - RESOLUTION * 0.5f) * SPACING);
+                mesh.normals.emplace_back(0.0f, 1.0f, 0.0f);
+            }
+        }
+        for (uint32_t z = 0; z + 1 < RESOLUTION; z++)
+        {
+            for (uint32_t x = 0; x + 1 < RESOLUTION; x++)
+            {
+                uint32_t i = z * RESOLUTION + x;
+                mesh.indices.insert(mesh.indices.end(), {i, i + RESOLUTION, i + 1});
+                mesh.indices.insert(mesh.indices.end(), {i + 1, i + RESOLUTION, i + RESOLUTION + 1});
+            }
+        }
+
+        ES::Engine::Entity cloth = core.CreateEntity();
+        cloth.AddComponent<Transform>(core, glm::vec3(0.0f, 5.0f + static_cast<float>(c) * 1.5f, 0.0f));
+        cloth.AddComponent<Mesh>(core, std::move(mesh));
+        cloth.AddComponent<Component::SoftBody3D>(core);
+    }
+}
+
+SceneResult RunScene(const Scene &scene, uint32_t ticks)
+{
+    long baseRss = GetCurrentRss();
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    if (scene.configure)
+    {
+        scene.configure(core.GetResource<Resource::PhysicsConfig>());
+    }
+
+    // Only the startup and fixed time systems are run, the other schedulers depend on the real-time clock
+    core.GetScheduler<ES::Engine::Scheduler::Startup>().RunSystems();
+    scene.build(core);
+
+    auto &fixedTimeUpdate = core.GetScheduler<ES::Engine::Scheduler::FixedTimeUpdate>();
+    auto &stats = core.GetResource<Resource::PhysicsStats>();
+    const auto syncSystems = GetSyncSystemIds();
+    SceneResult result;
+    result.name = scene.name;
+    result.rssGrowth = GetCurrentRss() - baseRss;
+
+    double totalTick = 0.0;
+    double totalStep = 0.0;
+    double totalSync = 0.0;
+    double totalDispatch = 0.0;
+    for (uint32_t t = 0; t < ticks; t++)
+    {
+        double tickTime = 0.0;
+        for (auto const &system : fixedTimeUpdate.GetSystems())
+        {
+            auto start = std::chrono::steady_clock::now();
+            (*system)(core);
+            double systemTime =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            tickTime += systemTime;
+            if (syncSystems.contains(system->GetID()))
+            {
+                totalSync += systemTime;
+            }
+        }
+
+        totalTick += tickTime;
+        totalStep += stats.last.stepTime;
+        totalDispatch += stats.last.dispatchTime;
+        result.maxTick = std::max(result.maxTick, tickTime);
+        // Sampled outside of the timed systems, the allocations of a step can be released before it ends
+        result.rssGrowth = std::max(result.rssGrowth, GetCurrentRss() - baseRss);
+    }
+
+    result.numBodies = stats.last.numBodies;
+    result.averageTick = totalTick / ticks;
+    result.averageStep = totalStep / ticks;
+    result.averageSync = totalSync / ticks;
+    result.averageDispatch = totalDispatch / ticks;
+    result.tempAllocatorPeak = stats.peak.tempAllocatorPeak;
+
+    Utils::PhysicsSnapshot snapshot;
+    core.GetResource<Resource::PhysicsManager>().SaveSnapshot(core, snapshot);
+    result.stateSize = snapshot.GetSize();
+
+    core.GetScheduler<ES::Engine::Scheduler::Shutdown>().RunSystems();
+    return result;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    uint32_t ticks = 500;
+    bool csv = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--csv") == 0)
+        {
+            csv = true;
+        }
+        else
+        {
+            ticks = static_cast<uint32_t>(std::strtoul(argv[i], nullptr, 10));
+        }
+    }
+    if (ticks == 0)
+    {
+        fmt::print(stderr, "Usage: {} [ticks] [--csv]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<Scene> scenes = {
+        {"pyramid", nullptr, BuildPyramid},
+        {"spheres_on_heightfield",
+         [](Resource::PhysicsConfig &config) {
+             config.maxBodyPairs = 262144;
+             config.maxContactConstraints = 131072;
+         },
+         BuildSpheresOnHeightField},
+        {"chains", nullptr, BuildChains},
+        {"cloths", nullptr, BuildCloths},
+    };
+
+    if (csv)
+    {
+        fmt::print("scene,bodies,ticks,avg_tick_ms,max_tick_ms,avg_step_ms,avg_sync_ms,avg_dispatch_ms,"
+                   "temp_allocator_peak_bytes,state_bytes,rss_growth_kb\n");
+    }
+    else
+    {
+        fmt::print("{:<24} {:>7} {:>10} {:>10} {:>10} {:>10} {:>10} {:>12} {:>10} {:>12}\n", "scene", "bodies",
+                   "tick ms", "max ms", "step ms", "sync ms", "dispatch", "temp peak", "state", "rss growth kb");
+    }
+
+    for (const auto &scene : scenes)
+    {
+        SceneResult r = RunScene(scene, ticks);
+        if (csv)
+        {
+            fmt::print("{},{},{},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{},{},{}\n", r.name, r.numBodies, ticks,
+                       r.averageTick, r.maxTick, r.averageStep, r.averageSync, r.averageDispatch,
+                       r.tempAllocatorPeak, r.stateSize, r.rssGrowth);
+        }
+        else
+        {
+            fmt::print("{:<24} {:>7} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>12} {:>10} {:>12}\n",
+                       r.name, r.numBodies, r.averageTick, r.maxTick, r.averageStep, r.averageSync,
+                       r.averageDispatch, r.tempAllocatorPeak, r.stateSize, r.rssGrowth);
+        }
+    }
+    return 0;
+}
@@ -4,22 +4,50 @@
 #include <Jolt/Jolt.h>
 // clang-format on
 
+#include "component/PhysicsFocus.hpp"
 #include "component/RigidBody3D.hpp"
 #include "component/SoftBody3D.hpp"
+#include "component/StreamedBody.hpp"
+#include "component/TransformInterpolation.hpp"
 
+#include "resource/CookedShapeCache.hpp"
+#include "resource/PhysicsConfig.hpp"
 #include "resource/PhysicsManager.hpp"
+#include "resource/PhysicsStats.hpp"
+#include "resource/QueryBatch.hpp"
+#include "resource/SoftBodySettingsCache.hpp"
 
+#include "system/ClearBodyRecycler.hpp"
+#include "system/DispatchContactEvents.hpp"
+#include "system/FlushBodyRemovals.hpp"
 #include "system/InitJoltPhysics.hpp"
 #include "system/InitPhysicsManager.hpp"
+#include "system/InterpolateTransforms.hpp"
 #include "system/PhysicsUpdate.hpp"
+#include "system/RecordSnapshotHistory.hpp"
 #include "system/ShutdownJoltPhysics.hpp"
+#include "system/StreamBodies.hpp"
 
+#include "utils/BodyRecycler.hpp"
 #include "utils/BroadPhaseLayerImpl.hpp"
 #include "utils/BroadPhaseLayers.hpp"
+#include "utils/CollisionLayers.hpp"
+#include "utils/ContactCallback.hpp"
+#include "utils/ContactCallbackContainer.hpp"
+#include "utils/ContactEvent.hpp"
+#include "utils/ContactEventQueue.hpp"
 #include "utils/ContactListenerImpl.hpp"
+#include "utils/ContactRouter.hpp"
+#include "utils/CookedShapeSettings.hpp"
 #include "utils/Layers.hpp"
+#include "utils/MappedFile.hpp"
+#include "utils/MeshHash.hpp"
 #include "utils/ObjectLayerPairFilterImpl.hpp"
 #include "utils/ObjectVsBroadPhaseLayerFilterImpl.hpp"
+#include "utils/PhysicsSnapshot.hpp"
+#include "utils/ShardedCounter.hpp"
+#include "utils/SnapshotRing.hpp"
 #include "utils/SoftBodyVertexSettings.hpp"
+#include "utils/TrackingTempAllocator.hpp"
 
 #include "plugin/PluginPhysics.hpp"
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace ES::Plugin::Physics::Component {
+/// @brief A component marking an entity, usually the player or a camera, around which streamed rigid bodies are
+/// kept in the physics world.
+/// @note The focus is placed at the position of the Transform of the entity.
+/// @see StreamedBody
+struct PhysicsFocus {
+    /// @brief Streamed rigid bodies closer than this distance to the focus are added to the physics world.
+    float radius = 100.0f;
+};
+} // namespace ES::Plugin::Physics::Component
@@ -15,6 +15,9 @@
 
 namespace ES::Plugin::Physics::Component {
 /// @brief A component that represents any 3D rigid body object in the physics world.
+/// @note The physics systems read and write the Transform of the entity as a world space pose. An entity with a
+/// parent, whose Transform is relative to its parent (see ES::Plugin::Relationship::System::PropagateTransforms),
+/// must not have a RigidBody3D.
 struct RigidBody3D {
     /// @brief A reference to the shape of the rigid body.
     /// It is a shared pointer of a Jolt's ShapeSettings, so any class that inherits from ShapeSettings can be used.
@@ -27,7 +27,7 @@ struct SoftBody3D {
 
     /// @brief A reference to the shared settings of the soft body.
     /// @note This should not be constructed manually, this is handled by the systems.
-    std::shared_ptr<JPH::SoftBodySharedSettings> settings;
+    JPH::Ref<JPH::SoftBodySharedSettings> settings;
 
     /// @brief A reference to the vertex attributes of the soft body.
     JPH::SoftBodySharedSettings::VertexAttributes vertexAttributes;
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace ES::Plugin::Physics::Component {
+/// @brief A component making the rigid body of an entity only exist in the physics world while it is in range of a
+/// PhysicsFocus.
+/// Out of range bodies are destroyed, their state being kept in this component, and created again when they come
+/// back in range. It keeps large worlds under the body limit and the broadphase small.
+/// @note Add it before the RigidBody3D component, so the body is not created until it is in range.
+/// @note Without any focus, every streamed body is out of range.
+/// @see PhysicsFocus, StreamBodies
+struct StreamedBody {
+    /// @brief Linear velocity of the body when it was streamed out.
+    glm::vec3 linearVelocity = glm::vec3(0.0f);
+
+    /// @brief Angular velocity of the body when it was streamed out.
+    glm::vec3 angularVelocity = glm::vec3(0.0f);
+
+    /// @brief Whether the body was awake when it was streamed out. New bodies start awake.
+    bool active = true;
+};
+} // namespace ES::Plugin::Physics::Component
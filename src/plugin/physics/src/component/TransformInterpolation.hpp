@@ -0,0 +1,34 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace ES::Plugin::Physics::Component {
+/// @brief A component keeping the last two physics poses of a rigid body, so the pose used for rendering can be
+/// interpolated between fixed physics ticks.
+/// @note It is added to non static rigid bodies when PhysicsConfig::interpolateTransforms is set.
+/// @note The Transform of the entity always holds the simulated pose: the interpolated one is only written to its
+/// WorldMatrix. Gameplay code can still move the entity by writing to its Transform: the new pose is then rendered
+/// as is, without interpolation.
+struct TransformInterpolation {
+    /// @brief Position of the body at the tick before the last one.
+    glm::vec3 previousPosition;
+    /// @brief Rotation of the body at the tick before the last one.
+    glm::quat previousRotation;
+
+    /// @brief Position of the body at the last tick.
+    glm::vec3 currentPosition;
+    /// @brief Rotation of the body at the last tick.
+    glm::quat currentRotation;
+
+    /// @brief Construct the interpolation state of a body that starts at rest.
+    /// @param position Initial position of the body.
+    /// @param rotation Initial rotation of the body.
+    TransformInterpolation(const glm::vec3 &position = glm::vec3(0.0f),
+                           const glm::quat &rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f))
+        : previousPosition(position), previousRotation(rotation), currentPosition(position),
+          currentRotation(rotation)
+    {
+    }
+};
+} // namespace ES::Plugin::Physics::Component
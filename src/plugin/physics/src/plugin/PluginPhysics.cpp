@@ -1,14 +1,38 @@
 #include "PluginPhysics.hpp"
+#include "ClearBodyRecycler.hpp"
+#include "CookedShapeCache.hpp"
+#include "DispatchContactEvents.hpp"
 #include "FixedTimeUpdate.hpp"
+#include "FlushBodyRemovals.hpp"
 #include "InitJoltPhysics.hpp"
 #include "InitPhysicsManager.hpp"
+#include "InterpolateTransforms.hpp"
+#include "PhysicsConfig.hpp"
 #include "PhysicsManager.hpp"
+#include "PhysicsStats.hpp"
 #include "PhysicsUpdate.hpp"
+#include "QueryBatch.hpp"
+#include "RecordSnapshotHistory.hpp"
 #include "ShutdownJoltPhysics.hpp"
+#include "SoftBodySettingsCache.hpp"
 #include "Startup.hpp"
+#include "StreamBodies.hpp"
+#include "Update.hpp"
 
 void ES::Plugin::Physics::Plugin::Bind()
 {
+    // Keep the config registered before the plugin was added, if any
+    if (!GetCore().GetRegistry().ctx().contains<ES::Plugin::Physics::Resource::PhysicsConfig>())
+    {
+        RegisterResource<ES::Plugin::Physics::Resource::PhysicsConfig>(ES::Plugin::Physics::Resource::PhysicsConfig());
+    }
+    RegisterResource<ES::Plugin::Physics::Resource::PhysicsStats>(ES::Plugin::Physics::Resource::PhysicsStats());
+    RegisterResource<ES::Plugin::Physics::Resource::QueryBatch>(ES::Plugin::Physics::Resource::QueryBatch());
+    RegisterResource<ES::Plugin::Physics::Resource::SoftBodySettingsCache>(
+        ES::Plugin::Physics::Resource::SoftBodySettingsCache());
+    RegisterResource<ES::Plugin::Physics::Resource::CookedShapeCache>(
+        ES::Plugin::Physics::Resource::CookedShapeCache());
+
     RegisterSystems<ES::Engine::Scheduler::Startup>(ES::Plugin::Physics::System::InitJoltPhysics);
     RegisterSystems<ES::Engine::Scheduler::Startup>(ES::Plugin::Physics::System::InitPhysicsManager);
 
@@ -18,8 +42,15 @@ void ES::Plugin::Physics::Plugin::Bind()
         ES::Plugin::Physics::System::OnConstructLinkSoftBodiesToPhysicsSystem);
 
     RegisterSystems<ES::Engine::Scheduler::FixedTimeUpdate>(
+        ES::Plugin::Physics::System::FlushBodyRemovals, ES::Plugin::Physics::System::ResetMovedInterpolations,
+        ES::Plugin::Physics::System::StreamBodies, ES::Plugin::Physics::System::AddPendingSoftBodies,
         ES::Plugin::Physics::System::SyncRigidBodiesToTransforms, ES::Plugin::Physics::System::PhysicsUpdate,
-        ES::Plugin::Physics::System::SyncTransformsToRigidBodies, ES::Plugin::Physics::System::SyncSoftBodiesData);
+        ES::Plugin::Physics::System::SyncTransformsToRigidBodies,
+        ES::Plugin::Physics::System::StoreInterpolatedTransforms, ES::Plugin::Physics::System::SyncSoftBodiesData,
+        ES::Plugin::Physics::System::DispatchContactEvents, ES::Plugin::Physics::System::RecordSnapshotHistory);
+
+    RegisterSystems<ES::Engine::Scheduler::Update>(ES::Plugin::Physics::System::InterpolateTransforms);
 
-    RegisterSystems<ES::Engine::Scheduler::Shutdown>(ES::Plugin::Physics::System::ShutdownJoltPhysics);
+    RegisterSystems<ES::Engine::Scheduler::Shutdown>(ES::Plugin::Physics::System::ClearBodyRecycler,
+                                                     ES::Plugin::Physics::System::ShutdownJoltPhysics);
 }
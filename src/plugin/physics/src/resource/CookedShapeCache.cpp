@@ -0,0 +1,240 @@
+#include "CookedShapeCache.hpp"
+
+#include "CookedShapeSettings.hpp"
+#include "Logger.hpp"
+#include "MappedFile.hpp"
+#include "MeshHash.hpp"
+
+#include <Jolt/Core/StreamIn.h>
+#include <Jolt/Core/StreamWrapper.h>
+#include <Jolt/Geometry/IndexedTriangle.h>
+#include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
+#include <Jolt/Physics/Collision/Shape/MeshShape.h>
+#include <cstring>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+
+namespace ES::Plugin::Physics::Resource {
+/**
+ * @brief Header written before the shape in a cache file.
+ */
+struct CookedShapeHeader {
+    char magic[4] = {'E', 'S', 'C', 'S'};
+    uint32_t formatVersion = CookedShapeCache::FORMAT_VERSION;
+    uint32_t joltVersion = (JPH_VERSION_MAJOR << 16) | (JPH_VERSION_MINOR << 8) | JPH_VERSION_PATCH;
+    uint32_t padding = 0;
+    uint64_t key = 0;
+};
+
+/**
+ * @brief Jolt input stream reading from memory, used to restore shapes from a mapped file.
+ */
+class SpanStreamIn final : public JPH::StreamIn {
+  public:
+    explicit SpanStreamIn(std::span<const std::byte> data) : _data(data) {}
+
+    void ReadBytes(void *outData, size_t inNumBytes) override
+    {
+        if (_failed || inNumBytes > _data.size() - _offset)
+        {
+            _failed = true;
+            std::memset(outData, 0, inNumBytes);
+            return;
+        }
+        std::memcpy(outData, _data.data() + _offset, inNumBytes);
+        _offset += inNumBytes;
+    }
+
+    bool IsEOF() const override { return _offset >= _data.size(); }
+    bool IsFailed() const override { return _failed; }
+
+  private:
+    std::span<const std::byte> _data;
+    std::size_t _offset = 0;
+    bool _failed = false;
+};
+
+static JPH::ShapeSettings::ShapeResult BuildShape(const ES::Plugin::Object::Component::Mesh &mesh,
+                                                  CookedShapeType type)
+{
+    switch (type)
+    {
+    case CookedShapeType::ConvexHull: {
+        JPH::Array<JPH::Vec3> points;
+        points.reserve(mesh.vertices.size());
+        for (const glm::vec3 &vertex : mesh.vertices)
+        {
+            points.emplace_back(vertex.x, vertex.y, vertex.z);
+        }
+        return JPH::ConvexHullShapeSettings(points).Create();
+    }
+    case CookedShapeType::Mesh:
+    default: {
+        JPH::VertexList vertices;
+        vertices.reserve(mesh.vertices.size());
+        for (const glm::vec3 &vertex : mesh.vertices)
+        {
+            vertices.emplace_back(vertex.x, vertex.y, vertex.z);
+        }
+        JPH::IndexedTriangleList triangles;
+        triangles.reserve(mesh.indices.size() / 3);
+        for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+        {
+            triangles.emplace_back(mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]);
+        }
+        return JPH::MeshShapeSettings(vertices, triangles).Create();
+    }
+    }
+}
+
+uint64_t CookedShapeCache::MakeKey(const ES::Plugin::Object::Component::Mesh &mesh, CookedShapeType type)
+{
+    uint64_t key = Utils::HashMesh(mesh);
+    Utils::HashCombine(key, static_cast<uint64_t>(type));
+    return key;
+}
+
+std::string CookedShapeCache::GetFilePath(uint64_t key) const
+{
+    return (std::filesystem::path(_directory) / fmt::format("{:016x}{}", key, FILE_EXTENSION)).string();
+}
+
+std::string CookedShapeCache::GetFilePath(const ES::Plugin::Object::Component::Mesh &mesh, CookedShapeType type) const
+{
+    return GetFilePath(MakeKey(mesh, type));
+}
+
+JPH::ShapeRefC CookedShapeCache::GetShape(const ES::Plugin::Object::Component::Mesh &mesh, CookedShapeType type)
+{
+    uint64_t key = MakeKey(mesh, type);
+    if (auto it = _shapes.find(key); it != _shapes.end())
+    {
+        return it->second;
+    }
+
+    if (!_directory.empty())
+    {
+        if (JPH::ShapeRefC shape = Load(GetFilePath(key), key); shape != nullptr)
+        {
+            _shapes.emplace(key, shape);
+            return shape;
+        }
+    }
+
+    JPH::ShapeSettings::ShapeResult result = BuildShape(mesh, type);
+    if (result.HasError())
+    {
+        ES::Utils::Log::Error(fmt::format("CookedShapeCache: failed to build shape: {}", result.GetError()));
+        return nullptr;
+    }
+
+    JPH::ShapeRefC shape = result.Get();
+    if (!_directory.empty())
+    {
+        Save(GetFilePath(key), key, *shape);
+    }
+    _shapes.emplace(key, shape);
+    return shape;
+}
+
+std::shared_ptr<JPH::ShapeSettings> CookedShapeCache::GetShapeSettings(const ES::Plugin::Object::Component::Mesh &mesh,
+                                                                       CookedShapeType type)
+{
+    JPH::ShapeRefC shape = GetShape(mesh, type);
+    if (shape == nullptr)
+    {
+        return nullptr;
+    }
+    return std::make_shared<Utils::CookedShapeSettings>(shape);
+}
+
+bool CookedShapeCache::Cook(const ES::Plugin::Object::Component::Mesh &mesh, CookedShapeType type)
+{
+    if (_directory.empty())
+    {
+        ES::Utils::Log::Error("CookedShapeCache: can't cook a shape without a cache directory.");
+        return false;
+    }
+
+    JPH::ShapeSettings::ShapeResult result = BuildShape(mesh, type);
+    if (result.HasError())
+    {
+        ES::Utils::Log::Error(fmt::format("CookedShapeCache: failed to build shape: {}", result.GetError()));
+        return false;
+    }
+
+    uint64_t key = MakeKey(mesh, type);
+    _shapes.insert_or_assign(key, result.Get());
+    return Save(GetFilePath(key), key, *result.Get());
+}
+
+JPH::ShapeRefC CookedShapeCache::Load(const std::string &path, uint64_t key) const
+{
+    Utils::MappedFile file;
+    if (!file.Open(path))
+    {
+        return nullptr;
+    }
+
+    SpanStreamIn stream(file.GetData());
+    CookedShapeHeader expected;
+    expected.key = key;
+    CookedShapeHeader header;
+    stream.ReadBytes(&header, sizeof(header));
+    if (stream.IsFailed() || std::memcmp(&header, &expected, sizeof(header)) != 0)
+    {
+        ES::Utils::Log::Warn(fmt::format("CookedShapeCache: {} is outdated, the shape will be rebuilt.", path));
+        return nullptr;
+    }
+
+    JPH::Shape::IDToShapeMap shapeMap;
+    JPH::Shape::IDToMaterialMap materialMap;
+    JPH::Shape::ShapeResult result = JPH::Shape::sRestoreWithChildren(stream, shapeMap, materialMap);
+    if (result.HasError() || stream.IsFailed())
+    {
+        ES::Utils::Log::Warn(fmt::format("CookedShapeCache: failed to restore {}, the shape will be rebuilt.", path));
+        return nullptr;
+    }
+    return result.Get();
+}
+
+bool CookedShapeCache::Save(const std::string &path, uint64_t key, const JPH::Shape &shape) const
+{
+    std::error_code error;
+    std::filesystem::create_directories(_directory, error);
+
+    // Write to a temporary file first, so an interrupted write never leaves a truncated cache file
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            ES::Utils::Log::Error(fmt::format("CookedShapeCache: can't write {}.", tmpPath));
+            return false;
+        }
+
+        JPH::StreamOutWrapper stream(file);
+        CookedShapeHeader header;
+        header.key = key;
+        stream.WriteBytes(&header, sizeof(header));
+
+        JPH::Shape::ShapeToIDMap shapeMap;
+        JPH::Shape::MaterialToIDMap materialMap;
+        shape.SaveWithChildren(stream, shapeMap, materialMap);
+        if (stream.IsFailed())
+        {
+            ES::Utils::Log::Error(fmt::format("CookedShapeCache: can't write {}.", tmpPath));
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmpPath, path, error);
+    if (error)
+    {
+        ES::Utils::Log::Error(fmt::format("CookedShapeCache: can't write {}: {}", path, error.message()));
+        return false;
+    }
+    return true;
+}
+} // namespace ES::Plugin::Physics::Resource
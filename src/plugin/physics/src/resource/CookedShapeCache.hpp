@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Mesh.hpp"
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace ES::Plugin::Physics::Resource {
+/**
+ * @brief The kind of shape built from a mesh.
+ */
+enum class CookedShapeType : uint8_t {
+    /// @brief A triangle mesh with its BVH, for static level geometry.
+    Mesh,
+    /// @brief The convex hull of the vertices, for dynamic bodies.
+    ConvexHull
+};
+
+/**
+ * CookedShapeCache is a resource building Jolt shapes from meshes, and keeping them in memory and on disk.
+ *
+ * Building a MeshShape means building its BVH, which is slow for large level meshes. Shapes are saved to a file
+ * named after the hash of the mesh in the cache directory, which is memory mapped and restored by the next runs,
+ * skipping the build. Files can also be generated ahead of time, by calling Cook from a tool.
+ *
+ * @note Without a directory, shapes are only cached in memory.
+ * @note Files written by another version of the cache format or of Jolt are ignored and rebuilt.
+ *
+ * @example "Loading a level mesh"
+ * @code
+ * auto &cache = core.GetResource<ES::Plugin::Physics::Resource::CookedShapeCache>();
+ * cache.SetDirectory("cache/shapes");
+ * auto &mesh = level.GetComponents<ES::Plugin::Object::Component::Mesh>(core);
+ * level.AddComponent<ES::Plugin::Physics::Component::RigidBody3D>(
+ *     core, cache.GetShapeSettings(mesh, ES::Plugin::Physics::Resource::CookedShapeType::Mesh));
+ * @endcode
+ */
+class CookedShapeCache {
+  public:
+    /// @brief Version of the file format, to be increased when it changes.
+    inline static constexpr uint32_t FORMAT_VERSION = 1;
+
+    /// @brief Extension of the cache files.
+    inline static constexpr const char *FILE_EXTENSION = ".jshape";
+
+    explicit CookedShapeCache(const std::string &directory = "") : _directory(directory) {}
+    ~CookedShapeCache() = default;
+
+    inline void SetDirectory(const std::string &directory) { _directory = directory; }
+    inline const std::string &GetDirectory() const { return _directory; }
+
+    /**
+     * @brief Get the shape of a mesh, from memory, from the cache directory, or by building and saving it.
+     *
+     * @param mesh The mesh.
+     * @param type The kind of shape.
+     * @return The shape, or nullptr if it could not be built.
+     */
+    JPH::ShapeRefC GetShape(const ES::Plugin::Object::Component::Mesh &mesh, CookedShapeType type);
+
+    /**
+     * @brief Get the shape of a mesh as shape settings, to be given to a RigidBody3D.
+     *
+     * @return The settings, or nullptr if the shape could not be built.
+     * @see GetShape
+     */
+    std::shared_ptr<JPH::ShapeSettings> GetShapeSettings(const ES::Plugin::Object::Component::Mesh &mesh,
+                                                         CookedShapeType type);
+
+    /**
+     * @brief Build the shape of a mesh and save it in the cache directory, replacing the file if it exists.
+     *
+     * @return false if the shape could not be built or saved.
+     */
+    bool Cook(const ES::Plugin::Object::Component::Mesh &mesh, CookedShapeType type);
+
+    /**
+     * @brief Forget the shapes kept in memory. Files are kept.
+     */
+    inline void Clear() { _shapes.clear(); }
+
+    inline std::size_t Size() const { return _shapes.size(); }
+
+    /**
+     * @brief Get the path of the cache file of a mesh.
+     */
+    std::string GetFilePath(const ES::Plugin::Object::Component::Mesh &mesh, CookedShapeType type) const;
+
+  private:
+    static uint64_t MakeKey(const ES::Plugin::Object::Component::Mesh &mesh, CookedShapeType type);
+    std::string GetFilePath(uint64_t key) const;
+
+    JPH::ShapeRefC Load(const std::string &path, uint64_t key) const;
+    bool Save(const std::string &path, uint64_t key, const JPH::Shape &shape) const;
+
+    std::string _directory;
+    std::unordered_map<uint64_t, JPH::ShapeRefC> _shapes;
+};
+} // namespace ES::Plugin::Physics::Resource
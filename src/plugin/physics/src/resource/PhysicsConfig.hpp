@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CollisionLayers.hpp"
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/PhysicsSettings.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace ES::Plugin::Physics::Resource {
+/**
+ * PhysicsConfig is a resource holding the capacities of the physics world.
+ * It is read once, when the PhysicsManager is initialized at startup.
+ *
+ * @note The physics plugin registers a default config when it is added, if none was registered before.
+ * To change it, either register a config before adding the plugin, or edit it before the first frame runs:
+ * @code
+ * core.AddPlugins<ES::Plugin::Physics::Plugin>();
+ * auto &config = core.GetResource<ES::Plugin::Physics::Resource::PhysicsConfig>();
+ * config.maxBodies = 65536;
+ * @endcode
+ */
+struct PhysicsConfig {
+    /// @brief Size in bytes of the preallocated arena used for temporary allocations during a physics step.
+    /// @note If a step needs more than that, Jolt falls back to the default allocator.
+    std::size_t tempAllocatorSize = 32 * 1024 * 1024;
+
+    /// @brief Number of worker threads of the job system, -1 to use one less than the number of hardware threads.
+    int numThreads = -1;
+
+    /// @brief Maximum number of jobs the job system can allocate.
+    uint32_t maxJobs = JPH::cMaxPhysicsJobs;
+
+    /// @brief Maximum number of barriers the job system can allocate.
+    uint32_t maxBarriers = JPH::cMaxPhysicsBarriers;
+
+    /// @brief Maximum number of bodies in the physics world.
+    uint32_t maxBodies = 65536;
+
+    /// @brief Number of mutexes used to protect bodies, 0 to let Jolt pick a default.
+    uint32_t numBodyMutexes = 0;
+
+    /// @brief Maximum number of body pairs the broadphase can find during a step.
+    /// @note Extra pairs are ignored, so bodies may pass through each other if this is too low.
+    uint32_t maxBodyPairs = 65536;
+
+    /// @brief Maximum number of contact constraints the solver can process during a step.
+    /// @note Extra contacts are ignored, so bodies may pass through each other if this is too low.
+    uint32_t maxContactConstraints = 32768;
+
+    /// @brief Whether PhysicsStats counts the candidate body pairs of every step.
+    /// @note This adds a counter increment to the object layer filter, called for every overlapping pair: leave it
+    /// off outside of profiling.
+    /// @see PhysicsStepStats::numCandidatePairs
+    bool countCandidatePairs = false;
+
+    /// @brief Whether non static rigid bodies get a TransformInterpolation component, so that their WorldMatrix is
+    /// interpolated between physics ticks when rendering.
+    bool interpolateTransforms = true;
+
+    /// @brief Number of ticks the physics world can be rewound by, a snapshot being saved at the end of each one.
+    /// 0 disables the snapshot history.
+    /// @see PhysicsManager::Rewind
+    uint32_t snapshotHistorySize = 0;
+
+    /// @brief Maximum number of streamed rigid bodies added to the physics world during a tick, 0 for no limit.
+    /// @see StreamedBody
+    uint32_t maxStreamedInsertionsPerTick = 128;
+
+    /// @brief Extra distance, past the radius of every focus, a streamed rigid body must reach before it is removed
+    /// from the physics world.
+    /// @see PhysicsFocus
+    float streamingHysteresis = 10.0f;
+
+    /// @brief Maximum number of bodies of destroyed rigid bodies kept to be reused by new ones with the same shape,
+    /// motion type and layer. 0 destroys every body.
+    /// @see BodyRecycler
+    uint32_t bodyPoolSize = 0;
+
+    /// @brief Whether the settings of new soft bodies are built by the job system. The soft body is then added to the
+    /// physics world a few ticks after its component, once its settings are ready.
+    /// @see SoftBodySettingsCache
+    bool buildSoftBodySettingsAsync = false;
+
+    /// @brief Object layers, their broadphase layers and which of them collide.
+    /// @see CollisionLayers
+    Utils::CollisionLayers collisionLayers = Utils::CollisionLayers::Default();
+};
+} // namespace ES::Plugin::Physics::Resource
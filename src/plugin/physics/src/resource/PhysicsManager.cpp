@@ -2,29 +2,130 @@
 
 #include "BroadPhaseLayerImpl.hpp"
 #include "ContactListenerImpl.hpp"
+#include "Logger.hpp"
 #include "ObjectLayerPairFilterImpl.hpp"
 #include "ObjectVsBroadPhaseLayerFilterImpl.hpp"
+#include "Transform.hpp"
+#include "TransformInterpolation.hpp"
 
+#include <fmt/format.h>
 #include <limits>
 
 namespace ES::Plugin::Physics::Resource {
-PhysicsManager::PhysicsManager()
+PhysicsManager::PhysicsManager(const PhysicsConfig &config) : _config(config)
 {
-    _tempAllocator = std::make_shared<JPH::TempAllocatorMalloc>();
-    _jobSystem = std::make_shared<JPH::JobSystemThreadPool>(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
-    _broadPhaseLayerInterface = std::make_shared<Utils::BPLayerInterfaceImpl>();
-    _objectLayerPairFilter = std::make_shared<Utils::ObjectLayerPairFilterImpl>();
-    _objectVsBroadPhaseLayerFilter = std::make_shared<Utils::ObjectVsBroadPhaseLayerFilterImpl>();
+    // Preallocated once, so that a physics step never has to call malloc for its temporary data
+    _tempAllocator = std::make_shared<Utils::TrackingTempAllocator>(_config.tempAllocatorSize);
+    _jobSystem =
+        std::make_shared<JPH::JobSystemThreadPool>(_config.maxJobs, _config.maxBarriers, _config.numThreads);
+    auto collisionLayers = std::make_shared<const Utils::CollisionLayers>(_config.collisionLayers);
+    _broadPhaseLayerInterface = std::make_shared<Utils::BPLayerInterfaceImpl>(collisionLayers);
+    _objectLayerPairFilter = std::make_shared<Utils::ObjectLayerPairFilterImpl>(collisionLayers);
+    _objectVsBroadPhaseLayerFilter = std::make_shared<Utils::ObjectVsBroadPhaseLayerFilterImpl>(collisionLayers);
     _physicsSystem = std::make_shared<JPH::PhysicsSystem>();
     _contactListener = nullptr;
+    _snapshotHistory.Resize(_config.snapshotHistorySize);
+    _bodyRecycler = Utils::BodyRecycler(_config.bodyPoolSize);
 }
 
 void PhysicsManager::Init(ES::Engine::Core &core)
 {
-    // Default values from Jolt Physics samples
-    _physicsSystem->Init(10240, 0, 65536, 20480, *_broadPhaseLayerInterface, *_objectVsBroadPhaseLayerFilter,
+    _physicsSystem->Init(_config.maxBodies, _config.numBodyMutexes, _config.maxBodyPairs,
+                         _config.maxContactConstraints, *_broadPhaseLayerInterface, *_objectVsBroadPhaseLayerFilter,
                          *_objectLayerPairFilter);
     _contactListener = std::make_shared<Utils::ContactListenerImpl>(core);
     _physicsSystem->SetContactListener(_contactListener.get());
 }
+
+void PhysicsManager::ResetStepStats()
+{
+    _objectLayerPairFilter->ExchangePairCount();
+    _objectLayerPairFilter->SetCountingPairs(_config.countCandidatePairs);
+    _tempAllocator->ResetPeakUsage();
+    if (auto contactListener = GetContactListener(); contactListener != nullptr)
+    {
+        contactListener->ExchangeContactCount();
+    }
+}
+
+PhysicsStepStats PhysicsManager::CollectStepStats(float stepTime)
+{
+    PhysicsStepStats stats;
+    stats.stepTime = stepTime;
+
+    JPH::BodyManager::BodyStats bodyStats = _physicsSystem->GetBodyStats();
+    uint32_t numActive = bodyStats.mNumActiveBodiesDynamic + bodyStats.mNumActiveBodiesKinematic +
+                         bodyStats.mNumActiveSoftBodies;
+    uint32_t numNonStatic = bodyStats.mNumBodiesDynamic + bodyStats.mNumBodiesKinematic + bodyStats.mNumSoftBodies;
+    stats.numBodies = bodyStats.mNumBodies;
+    stats.numActiveBodies = numActive;
+    stats.numSleepingBodies = numNonStatic - numActive;
+
+    _objectLayerPairFilter->SetCountingPairs(false);
+    stats.numCandidatePairs = _objectLayerPairFilter->ExchangePairCount();
+    if (auto contactListener = GetContactListener(); contactListener != nullptr)
+    {
+        stats.numContacts = contactListener->ExchangeContactCount();
+    }
+    stats.tempAllocatorPeak = _tempAllocator->GetPeakUsage();
+    return stats;
+}
+
+void PhysicsManager::SaveSnapshot(ES::Engine::Core &core, Utils::PhysicsSnapshot &snapshot)
+{
+    snapshot.Clear();
+    _physicsSystem->SaveState(snapshot);
+
+    auto &registry = core.GetRegistry();
+    auto view = registry.view<ES::Plugin::Object::Component::Transform>();
+    snapshot.transforms.reserve(view.size());
+    for (auto entity : view)
+    {
+        snapshot.transforms.emplace_back(entity, view.get<ES::Plugin::Object::Component::Transform>(entity));
+    }
+}
+
+bool PhysicsManager::RestoreSnapshot(ES::Engine::Core &core, Utils::PhysicsSnapshot &snapshot)
+{
+    snapshot.Rewind();
+    if (snapshot.IsEmpty() || !_physicsSystem->RestoreState(snapshot))
+    {
+        ES::Utils::Log::Error("Failed to restore physics snapshot: the bodies of the world changed since it was saved");
+        return false;
+    }
+
+    auto &registry = core.GetRegistry();
+    for (const auto &[entity, savedTransform] : snapshot.transforms)
+    {
+        if (!registry.valid(entity) || !registry.all_of<ES::Plugin::Object::Component::Transform>(entity))
+        {
+            continue;
+        }
+        registry.get<ES::Plugin::Object::Component::Transform>(entity) = savedTransform;
+
+        // Don't interpolate from the pose the world had before being restored
+        if (auto *interpolation = registry.try_get<Component::TransformInterpolation>(entity))
+        {
+            *interpolation = Component::TransformInterpolation(savedTransform.position, savedTransform.rotation);
+        }
+    }
+    return true;
+}
+
+bool PhysicsManager::Rewind(ES::Engine::Core &core, std::size_t ticks)
+{
+    Utils::PhysicsSnapshot *snapshot = _snapshotHistory.Get(ticks);
+    if (snapshot == nullptr)
+    {
+        ES::Utils::Log::Warn(fmt::format("Can't rewind physics by {} ticks, only {} are kept", ticks,
+                                         _snapshotHistory.GetSize()));
+        return false;
+    }
+    if (!RestoreSnapshot(core, *snapshot))
+    {
+        return false;
+    }
+    _snapshotHistory.DropNewest(ticks);
+    return true;
+}
 } // namespace ES::Plugin::Physics::Resource
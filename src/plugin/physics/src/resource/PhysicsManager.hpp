@@ -6,8 +6,15 @@
 #include <Jolt/Jolt.h>
 // clang-format on
 
+#include "BodyRecycler.hpp"
 #include "ContactListenerImpl.hpp"
 #include "FunctionContainer.hpp"
+#include "ObjectLayerPairFilterImpl.hpp"
+#include "PhysicsConfig.hpp"
+#include "PhysicsSnapshot.hpp"
+#include "PhysicsStats.hpp"
+#include "SnapshotRing.hpp"
+#include "TrackingTempAllocator.hpp"
 
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/JobSystemThreadPool.h>
@@ -27,8 +34,10 @@ class PhysicsManager {
   public:
     /**
      * Constructor.
+     *
+     * @param config Capacities of the physics world, used to size the temp allocator and the job system.
      */
-    PhysicsManager();
+    explicit PhysicsManager(const PhysicsConfig &config = PhysicsConfig());
 
     /**
      * Destructor.
@@ -41,9 +50,17 @@ class PhysicsManager {
      * @param core A reference to the core engine, used for the contact listener.
      *
      * @return void
+     * @note The body, body pair and contact constraint limits are taken from the config given to the constructor.
      */
     void Init(ES::Engine::Core &core);
 
+    /**
+     * @brief Get the config the physics manager was created with.
+     *
+     * @return const PhysicsConfig&
+     */
+    inline const PhysicsConfig &GetConfig() const { return _config; }
+
     /**
      * @brief Get a reference to the physics system.
      *
@@ -60,6 +77,22 @@ class PhysicsManager {
      */
     inline JPH::TempAllocator *GetTempAllocator() { return _tempAllocator.get(); }
 
+    /**
+     * @brief Reset the counters measuring a physics step, to be called right before the step.
+     *
+     * @return void
+     */
+    void ResetStepStats();
+
+    /**
+     * @brief Collect the metrics of the physics step that just ran, and reset the counters.
+     *
+     * @param stepTime Wall time of the step, in milliseconds.
+     * @return PhysicsStepStats
+     * @note The contact callbacks dispatch time is measured separately, once they are called.
+     */
+    PhysicsStepStats CollectStepStats(float stepTime);
+
     /**
      * @brief Get a pointer to the job system.
      *
@@ -69,6 +102,51 @@ class PhysicsManager {
      */
     inline JPH::JobSystem *GetJobSystem() { return _jobSystem.get(); }
 
+    /**
+     * @brief Save the state of the physics world and the transforms of the entities into a snapshot.
+     *
+     * @param core The core, holding the transforms.
+     * @param snapshot The snapshot to save into. It is cleared first, keeping its memory.
+     */
+    void SaveSnapshot(ES::Engine::Core &core, Utils::PhysicsSnapshot &snapshot);
+
+    /**
+     * @brief Restore the state of the physics world and the transforms of the entities from a snapshot.
+     *
+     * @param core The core, holding the transforms.
+     * @param snapshot The snapshot to restore. It can be restored again later.
+     * @return false if the physics state could not be restored, in which case transforms are left untouched.
+     * @note The world must hold the same bodies as when the snapshot was saved. Transforms of entities destroyed
+     * since are skipped.
+     */
+    bool RestoreSnapshot(ES::Engine::Core &core, Utils::PhysicsSnapshot &snapshot);
+
+    /**
+     * @brief Restore the world as it was a number of ticks ago, from the snapshot history.
+     *
+     * @param core The core, holding the transforms.
+     * @param ticks 0 to restore the last tick, 1 the tick before, and so on.
+     * @return false if the history doesn't go back that far, or if the snapshot could not be restored.
+     * @note The snapshots newer than the restored one are dropped from the history.
+     * @see PhysicsConfig::snapshotHistorySize
+     */
+    bool Rewind(ES::Engine::Core &core, std::size_t ticks);
+
+    /**
+     * @brief Get the snapshot history, holding the state of the world at the end of the last ticks.
+     *
+     * @return Utils::SnapshotRing&
+     */
+    inline Utils::SnapshotRing &GetSnapshotHistory() { return _snapshotHistory; }
+
+    /**
+     * @brief Get the body recycler, removing the bodies of destroyed components and pooling them.
+     *
+     * @return Utils::BodyRecycler&
+     * @see PhysicsConfig::bodyPoolSize
+     */
+    inline Utils::BodyRecycler &GetBodyRecycler() { return _bodyRecycler; }
+
     /**
      * @brief Get the number of collision steps.
      *
@@ -117,7 +195,7 @@ class PhysicsManager {
     {
         if (auto contactListener = GetContactListener(); contactListener != nullptr)
         {
-            return contactListener->AddOnContactAddedCallback(std::move(callback));
+            return contactListener->AddOnContactAddedCallback<Components...>(std::move(callback));
         }
         else
         {
@@ -141,7 +219,25 @@ class PhysicsManager {
     AddContactAddedCallback(Utils::ContactCallback<Components...>::CallbackFunc fn)
     {
         auto callback = std::make_unique<Utils::ContactCallback<Components...>>(fn);
-        return AddContactAddedCallback(std::move(callback));
+        return AddContactAddedCallback<Components...>(std::move(callback));
+    }
+
+    /**
+     * @brief Add a contact added callback, that also receives the contact event, to the contact listener.
+     *
+     * @param fn The callback function to add.
+     * @tparam components The components to check for in the entities involved in the contact.
+     *
+     * @return void
+     * @note This will create a new ContactCallback object and add it to the contact listener.
+     * @note The contact event holds the contact points, normal, penetration depth and estimated impulse.
+     */
+    template <typename... Components>
+    inline ES::Utils::FunctionContainer::FunctionID
+    AddContactAddedCallback(Utils::ContactCallback<Components...>::CallbackWithEventFunc fn)
+    {
+        auto callback = std::make_unique<Utils::ContactCallback<Components...>>(fn);
+        return AddContactAddedCallback<Components...>(std::move(callback));
     }
 
     /**
@@ -158,7 +254,7 @@ class PhysicsManager {
     {
         if (auto contactListener = GetContactListener(); contactListener != nullptr)
         {
-            return contactListener->AddOnContactPersistedCallback(std::move(callback));
+            return contactListener->AddOnContactPersistedCallback<Components...>(std::move(callback));
         }
         else
         {
@@ -182,7 +278,25 @@ class PhysicsManager {
     AddContactPersistedCallback(Utils::ContactCallback<Components...>::CallbackFunc fn)
     {
         auto callback = std::make_unique<Utils::ContactCallback<Components...>>(fn);
-        return AddContactPersistedCallback(std::move(callback));
+        return AddContactPersistedCallback<Components...>(std::move(callback));
+    }
+
+    /**
+     * @brief Add a contact persisted callback, that also receives the contact event, to the contact listener.
+     *
+     * @param fn The callback function to add.
+     * @tparam components The components to check for in the entities involved in the contact.
+     *
+     * @return void
+     * @note This will create a new ContactCallback object and add it to the contact listener.
+     * @note The contact event holds the contact points, normal, penetration depth and estimated impulse.
+     */
+    template <typename... Components>
+    inline ES::Utils::FunctionContainer::FunctionID
+    AddContactPersistedCallback(Utils::ContactCallback<Components...>::CallbackWithEventFunc fn)
+    {
+        auto callback = std::make_unique<Utils::ContactCallback<Components...>>(fn);
+        return AddContactPersistedCallback<Components...>(std::move(callback));
     }
 
     /**
@@ -199,7 +313,7 @@ class PhysicsManager {
     {
         if (auto contactListener = GetContactListener(); contactListener != nullptr)
         {
-            return contactListener->AddOnContactRemovedCallback(std::move(callback));
+            return contactListener->AddOnContactRemovedCallback<Components...>(std::move(callback));
         }
         else
         {
@@ -223,7 +337,25 @@ class PhysicsManager {
     AddContactRemovedCallback(Utils::ContactCallback<Components...>::CallbackFunc fn)
     {
         auto callback = std::make_unique<Utils::ContactCallback<Components...>>(fn);
-        return AddContactRemovedCallback(std::move(callback));
+        return AddContactRemovedCallback<Components...>(std::move(callback));
+    }
+
+    /**
+     * @brief Add a contact removed callback, that also receives the contact event, to the contact listener.
+     *
+     * @param fn The callback function to add.
+     * @tparam components The components to check for in the entities involved in the contact.
+     *
+     * @return void
+     * @note This will create a new ContactCallback object and add it to the contact listener.
+     * @note The contact event holds the contact points, normal, penetration depth and estimated impulse.
+     */
+    template <typename... Components>
+    inline ES::Utils::FunctionContainer::FunctionID
+    AddContactRemovedCallback(Utils::ContactCallback<Components...>::CallbackWithEventFunc fn)
+    {
+        auto callback = std::make_unique<Utils::ContactCallback<Components...>>(fn);
+        return AddContactRemovedCallback<Components...>(std::move(callback));
     }
 
     /**
@@ -290,16 +422,21 @@ class PhysicsManager {
     }
 
   private:
+    PhysicsConfig _config;
+
     std::shared_ptr<JPH::Factory> _factory;
     std::shared_ptr<JPH::PhysicsSystem> _physicsSystem;
 
     std::shared_ptr<JPH::BroadPhaseLayerInterface> _broadPhaseLayerInterface;
     std::shared_ptr<JPH::ObjectVsBroadPhaseLayerFilter> _objectVsBroadPhaseLayerFilter;
-    std::shared_ptr<JPH::ObjectLayerPairFilter> _objectLayerPairFilter;
-    std::shared_ptr<JPH::TempAllocator> _tempAllocator;
+    std::shared_ptr<Utils::ObjectLayerPairFilterImpl> _objectLayerPairFilter;
+    std::shared_ptr<Utils::TrackingTempAllocator> _tempAllocator;
     std::shared_ptr<JPH::JobSystem> _jobSystem;
     std::shared_ptr<JPH::ContactListener> _contactListener;
 
+    Utils::SnapshotRing _snapshotHistory;
+    Utils::BodyRecycler _bodyRecycler;
+
     int _collisionSteps = 1;
 };
 } // namespace ES::Plugin::Physics::Resource
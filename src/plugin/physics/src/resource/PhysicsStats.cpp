@@ -0,0 +1,55 @@
+#include "PhysicsStats.hpp"
+
+#include <fmt/format.h>
+
+namespace ES::Plugin::Physics::Resource {
+void PhysicsStepStats::Max(const PhysicsStepStats &other)
+{
+    stepTime = std::max(stepTime, other.stepTime);
+    dispatchTime = std::max(dispatchTime, other.dispatchTime);
+    numBodies = std::max(numBodies, other.numBodies);
+    numActiveBodies = std::max(numActiveBodies, other.numActiveBodies);
+    numSleepingBodies = std::max(numSleepingBodies, other.numSleepingBodies);
+    numCandidatePairs = std::max(numCandidatePairs, other.numCandidatePairs);
+    numContacts = std::max(numContacts, other.numContacts);
+    numContactEvents = std::max(numContactEvents, other.numContactEvents);
+    tempAllocatorPeak = std::max(tempAllocatorPeak, other.tempAllocatorPeak);
+}
+
+void PhysicsStats::Record(const PhysicsStepStats &step)
+{
+    last = step;
+    peak.Max(step);
+    numSteps++;
+}
+
+void PhysicsStats::RecordDispatch(float dispatchTime, uint64_t numContactEvents)
+{
+    last.dispatchTime = dispatchTime;
+    last.numContactEvents = numContactEvents;
+    peak.Max(last);
+}
+
+void PhysicsStats::Reset()
+{
+    peak = PhysicsStepStats();
+    numSteps = 0;
+}
+
+static std::string StepStatsToJson(const PhysicsStepStats &stats)
+{
+    std::string json = "{";
+    stats.Visit([&json](const char *name, double value) {
+        json += fmt::format("{}\"{}\":{}", json.size() > 1 ? "," : "", name, value);
+    });
+    return json + "}";
+}
+
+std::string PhysicsStats::ToJson() const
+{
+    return fmt::format("{{\"steps\":{},\"last\":{},\"peak\":{},\"capacities\":{{\"bodies\":{},\"body_pairs\":{},"
+                       "\"contact_constraints\":{},\"temp_allocator_bytes\":{}}}}}",
+                       numSteps, StepStatsToJson(last), StepStatsToJson(peak), maxBodies, maxBodyPairs,
+                       maxContactConstraints, tempAllocatorSize);
+}
+} // namespace ES::Plugin::Physics::Resource
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+namespace ES::Plugin::Physics::Resource {
+/**
+ * @brief Metrics of a single physics step.
+ *
+ * @note Jolt does not expose its island count nor its contact constraint count, so the number of contacts is the
+ * number of contact manifolds reported to the contact listener (added and persisted), which is what creates
+ * contact constraints.
+ */
+struct PhysicsStepStats {
+    /// @brief Wall time of the Jolt update, in milliseconds.
+    float stepTime = 0.0f;
+    /// @brief Wall time of the contact callbacks dispatch that followed the step, in milliseconds.
+    float dispatchTime = 0.0f;
+
+    /// @brief Number of bodies in the physics world.
+    uint32_t numBodies = 0;
+    /// @brief Number of non static bodies being simulated.
+    uint32_t numActiveBodies = 0;
+    /// @brief Number of non static bodies asleep.
+    uint32_t numSleepingBodies = 0;
+
+    /// @brief Number of body pairs with overlapping bounds accepted by the object layer filter during the step, the
+    /// candidates the narrowphase tests. Only counted when PhysicsConfig::countCandidatePairs is set.
+    uint64_t numCandidatePairs = 0;
+    /// @brief Number of contact manifolds found by the narrowphase.
+    uint64_t numContacts = 0;
+    /// @brief Number of contact events dispatched to callbacks.
+    uint64_t numContactEvents = 0;
+
+    /// @brief Largest number of bytes allocated from the temp allocator during the step.
+    uint64_t tempAllocatorPeak = 0;
+
+    /**
+     * @brief Keep, for every metric, the largest value between this one and another.
+     */
+    void Max(const PhysicsStepStats &other);
+
+    /**
+     * @brief Call a function with the name and the value of every metric, to export them.
+     *
+     * @param visitor A function taking a const char* name and a double value.
+     */
+    template <typename TVisitor> void Visit(TVisitor &&visitor) const
+    {
+        visitor("step_time_ms", static_cast<double>(stepTime));
+        visitor("dispatch_time_ms", static_cast<double>(dispatchTime));
+        visitor("bodies", static_cast<double>(numBodies));
+        visitor("active_bodies", static_cast<double>(numActiveBodies));
+        visitor("sleeping_bodies", static_cast<double>(numSleepingBodies));
+        visitor("candidate_pairs", static_cast<double>(numCandidatePairs));
+        visitor("contacts", static_cast<double>(numContacts));
+        visitor("contact_events", static_cast<double>(numContactEvents));
+        visitor("temp_allocator_peak_bytes", static_cast<double>(tempAllocatorPeak));
+    }
+};
+
+/**
+ * @brief PhysicsStats is a resource holding the metrics of the physics steps, to profile the physics cost of a
+ * scene and size the capacities of the PhysicsConfig.
+ *
+ * @example "Exporting the metrics"
+ * @code
+ * auto &stats = core.GetResource<ES::Plugin::Physics::Resource::PhysicsStats>();
+ * ES::Utils::Log::Info(stats.ToJson());
+ * @endcode
+ */
+struct PhysicsStats {
+    /// @brief Metrics of the last step.
+    PhysicsStepStats last;
+    /// @brief Largest value of every metric since the last reset.
+    PhysicsStepStats peak;
+    /// @brief Number of steps since the last reset.
+    uint64_t numSteps = 0;
+
+    /// @brief Capacities the metrics can be compared to.
+    uint32_t maxBodies = 0;
+    uint32_t maxBodyPairs = 0;
+    uint32_t maxContactConstraints = 0;
+    uint64_t tempAllocatorSize = 0;
+
+    /**
+     * @brief Record the metrics of a step.
+     */
+    void Record(const PhysicsStepStats &step);
+
+    /**
+     * @brief Record the dispatch time of the last step, measured once its contact callbacks are called.
+     */
+    void RecordDispatch(float dispatchTime, uint64_t numContactEvents);
+
+    /**
+     * @brief Reset the peak metrics and the step count.
+     */
+    void Reset();
+
+    /**
+     * @brief Export the metrics as a JSON object, with "last", "peak", "steps" and "capacities" members.
+     */
+    std::string ToJson() const;
+};
+} // namespace ES::Plugin::Physics::Resource
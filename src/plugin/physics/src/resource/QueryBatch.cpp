@@ -0,0 +1,205 @@
+#include "QueryBatch.hpp"
+
+#include "ContactRouter.hpp"
+#include "PhysicsManager.hpp"
+
+#include <Jolt/Core/JobSystem.h>
+#include <Jolt/Physics/Body/BodyFilter.h>
+#include <Jolt/Physics/Body/BodyLock.h>
+#include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <algorithm>
+
+namespace ES::Plugin::Physics::Resource {
+template <typename TVec> static inline glm::vec3 ToGlmVec3(const TVec &v)
+{
+    return glm::vec3(static_cast<float>(v.GetX()), static_cast<float>(v.GetY()), static_cast<float>(v.GetZ()));
+}
+
+/**
+ * @brief Fill the entity of a hit from the user data of its body.
+ *
+ * @return false if the body was removed in the meantime
+ */
+static bool ResolveHitEntity(const JPH::PhysicsSystem &physicsSystem, QueryHit &hit)
+{
+    JPH::BodyLockRead lock(physicsSystem.GetBodyLockInterface(), hit.body);
+    if (!lock.Succeeded())
+    {
+        return false;
+    }
+    hit.entity = Utils::ContactRouter::GetEntity(lock.GetBody().GetUserData());
+    return true;
+}
+
+uint32_t QueryBatch::Add(const PhysicsQuery &query)
+{
+    _queries.push_back(query);
+    return static_cast<uint32_t>(_queries.size() - 1);
+}
+
+uint32_t QueryBatch::AddRaycast(const glm::vec3 &origin, const glm::vec3 &direction, JPH::ObjectLayer layer,
+                                JPH::BodyID ignoredBody)
+{
+    return Add(PhysicsQuery{PhysicsQuery::Type::Raycast, origin, direction, 0.0f, layer, ignoredBody});
+}
+
+uint32_t QueryBatch::AddSphereCast(const glm::vec3 &origin, float radius, const glm::vec3 &direction,
+                                   JPH::ObjectLayer layer, JPH::BodyID ignoredBody)
+{
+    return Add(PhysicsQuery{PhysicsQuery::Type::SphereCast, origin, direction, radius, layer, ignoredBody});
+}
+
+uint32_t QueryBatch::AddSphereOverlap(const glm::vec3 &center, float radius, JPH::ObjectLayer layer,
+                                      JPH::BodyID ignoredBody)
+{
+    return Add(PhysicsQuery{PhysicsQuery::Type::SphereOverlap, center, glm::vec3(0.0f), radius, layer, ignoredBody});
+}
+
+void QueryBatch::Clear()
+{
+    std::size_t used = std::min(_queries.size(), _hits.size());
+    for (std::size_t i = 0; i < used; i++)
+    {
+        _hits[i].clear();
+    }
+    _queries.clear();
+}
+
+void QueryBatch::Execute(ES::Engine::Core &core)
+{
+    auto &physicsManager = core.GetResource<PhysicsManager>();
+    const JPH::PhysicsSystem &physicsSystem = physicsManager.GetPhysicsSystem();
+    JPH::JobSystem *jobSystem = physicsManager.GetJobSystem();
+
+    if (_hits.size() < _queries.size())
+    {
+        _hits.resize(_queries.size());
+    }
+
+    if (_queries.size() <= MIN_QUERIES_PER_JOB || jobSystem == nullptr)
+    {
+        RunQueries(physicsSystem, 0, _queries.size());
+        return;
+    }
+
+    // A few jobs per thread, so threads that finish early can pick up the remaining work
+    std::size_t maxJobs = static_cast<std::size_t>(jobSystem->GetMaxConcurrency()) * 4;
+    std::size_t numJobs = std::min((_queries.size() + MIN_QUERIES_PER_JOB - 1) / MIN_QUERIES_PER_JOB, maxJobs);
+    std::size_t queriesPerJob = (_queries.size() + numJobs - 1) / numJobs;
+
+    JPH::JobSystem::Barrier *barrier = jobSystem->CreateBarrier();
+    for (std::size_t begin = 0; begin < _queries.size(); begin += queriesPerJob)
+    {
+        std::size_t end = std::min(begin + queriesPerJob, _queries.size());
+        JPH::JobHandle job = jobSystem->CreateJob("PhysicsQueries", JPH::Color::sGreen,
+                                                  [this, &physicsSystem, begin, end]() {
+                                                      RunQueries(physicsSystem, begin, end);
+                                                  });
+        barrier->AddJob(job);
+    }
+    jobSystem->WaitForJobs(barrier);
+    jobSystem->DestroyBarrier(barrier);
+}
+
+void QueryBatch::RunQueries(const JPH::PhysicsSystem &physicsSystem, std::size_t begin, std::size_t end)
+{
+    const JPH::NarrowPhaseQuery &narrowPhase = physicsSystem.GetNarrowPhaseQuery();
+
+    for (std::size_t i = begin; i < end; i++)
+    {
+        const PhysicsQuery &query = _queries[i];
+        std::vector<QueryHit> &hits = _hits[i];
+        hits.clear();
+
+        JPH::DefaultBroadPhaseLayerFilter broadPhaseFilter = physicsSystem.GetDefaultBroadPhaseLayerFilter(query.layer);
+        JPH::DefaultObjectLayerFilter layerFilter = physicsSystem.GetDefaultLayerFilter(query.layer);
+        JPH::IgnoreSingleBodyFilter bodyFilter(query.ignoredBody);
+
+        JPH::RVec3 origin(query.origin.x, query.origin.y, query.origin.z);
+        JPH::Vec3 direction(query.direction.x, query.direction.y, query.direction.z);
+
+        switch (query.type)
+        {
+        case PhysicsQuery::Type::Raycast: {
+            JPH::RRayCast ray(origin, direction);
+            JPH::RayCastResult result;
+            if (!narrowPhase.CastRay(ray, result, broadPhaseFilter, layerFilter, bodyFilter))
+            {
+                break;
+            }
+
+            JPH::BodyLockRead lock(physicsSystem.GetBodyLockInterface(), result.mBodyID);
+            if (!lock.Succeeded())
+            {
+                break;
+            }
+            const JPH::Body &body = lock.GetBody();
+            JPH::RVec3 point = ray.GetPointOnRay(result.mFraction);
+            hits.push_back(QueryHit{Utils::ContactRouter::GetEntity(body.GetUserData()), result.mBodyID,
+                                    ToGlmVec3(point),
+                                    ToGlmVec3(body.GetWorldSpaceSurfaceNormal(result.mSubShapeID2, point)),
+                                    result.mFraction});
+            break;
+        }
+        case PhysicsQuery::Type::SphereCast: {
+            JPH::SphereShape sphere(query.radius);
+            sphere.SetEmbedded();
+            JPH::RShapeCast shapeCast(&sphere, JPH::Vec3::sReplicate(1.0f), JPH::RMat44::sTranslation(origin),
+                                      direction);
+            JPH::ShapeCastSettings settings;
+            JPH::ClosestHitCollisionCollector<JPH::CastShapeCollector> collector;
+            narrowPhase.CastShape(shapeCast, settings, JPH::RVec3::sZero(), collector, broadPhaseFilter, layerFilter,
+                                  bodyFilter);
+            if (!collector.HadHit())
+            {
+                break;
+            }
+
+            const JPH::ShapeCastResult &result = collector.mHit;
+            QueryHit hit{ES::Engine::Entity(), result.mBodyID2, ToGlmVec3(result.mContactPointOn2),
+                         ToGlmVec3(-result.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero())), result.mFraction};
+            if (ResolveHitEntity(physicsSystem, hit))
+            {
+                hits.push_back(hit);
+            }
+            break;
+        }
+        case PhysicsQuery::Type::SphereOverlap: {
+            JPH::SphereShape sphere(query.radius);
+            sphere.SetEmbedded();
+            JPH::CollideShapeSettings settings;
+            JPH::AllHitCollisionCollector<JPH::CollideShapeCollector> collector;
+            narrowPhase.CollideShape(&sphere, JPH::Vec3::sReplicate(1.0f), JPH::RMat44::sTranslation(origin),
+                                     settings, JPH::RVec3::sZero(), collector, broadPhaseFilter, layerFilter,
+                                     bodyFilter);
+
+            // A body made of several sub shapes can be hit more than once, only keep its deepest hit
+            std::ranges::sort(collector.mHits, [](const JPH::CollideShapeResult &a, const JPH::CollideShapeResult &b) {
+                return a.mBodyID2 != b.mBodyID2 ? a.mBodyID2 < b.mBodyID2 : a.mPenetrationDepth > b.mPenetrationDepth;
+            });
+            for (std::size_t h = 0; h < collector.mHits.size(); h++)
+            {
+                const JPH::CollideShapeResult &result = collector.mHits[h];
+                if (h > 0 && collector.mHits[h - 1].mBodyID2 == result.mBodyID2)
+                {
+                    continue;
+                }
+
+                QueryHit hit{ES::Engine::Entity(), result.mBodyID2, ToGlmVec3(result.mContactPointOn2),
+                             ToGlmVec3(-result.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero())), 0.0f};
+                if (ResolveHitEntity(physicsSystem, hit))
+                {
+                    hits.push_back(hit);
+                }
+            }
+            break;
+        }
+        }
+    }
+}
+} // namespace ES::Plugin::Physics::Resource
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Entity.hpp"
+#include "Layers.hpp"
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/Body/BodyID.h>
+#include <Jolt/Physics/Collision/ObjectLayer.h>
+#include <Jolt/Physics/PhysicsSystem.h>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <vector>
+
+namespace ES::Plugin::Physics::Resource {
+/**
+ * @brief A query submitted to a QueryBatch.
+ */
+struct PhysicsQuery {
+    /// @brief The kind of query.
+    enum class Type : uint8_t {
+        /// @brief Closest hit along a ray.
+        Raycast,
+        /// @brief Closest hit of a sphere moving along a direction.
+        SphereCast,
+        /// @brief Every body overlapping a sphere.
+        SphereOverlap
+    };
+
+    /// @brief The kind of query.
+    Type type = Type::Raycast;
+
+    /// @brief Start of the ray or cast, or center of the overlap test.
+    glm::vec3 origin = glm::vec3(0.0f);
+
+    /// @brief Direction of the ray or cast, its length being the maximum distance. Unused by overlap tests.
+    glm::vec3 direction = glm::vec3(0.0f);
+
+    /// @brief Radius of the sphere. Unused by raycasts.
+    float radius = 0.0f;
+
+    /// @brief The query only hits bodies that a body of this layer would collide with.
+    JPH::ObjectLayer layer = Utils::Layers::MOVING;
+
+    /// @brief A body the query ignores, usually the body of the entity running the query.
+    JPH::BodyID ignoredBody;
+};
+
+/**
+ * @brief A body hit by a query.
+ */
+struct QueryHit {
+    /// @brief Entity owning the body that was hit.
+    ES::Engine::Entity entity;
+
+    /// @brief Id of the body that was hit.
+    JPH::BodyID body;
+
+    /// @brief World space hit point, on the surface of the body.
+    glm::vec3 point = glm::vec3(0.0f);
+
+    /// @brief World space surface normal of the body at the hit point.
+    glm::vec3 normal = glm::vec3(0.0f);
+
+    /// @brief Fraction of the ray or cast direction where the hit happened. Always 0 for overlap tests.
+    float fraction = 0.0f;
+};
+
+/**
+ * @brief QueryBatch is a resource running many physics queries at once, in parallel on the physics job system.
+ *
+ * Queries are submitted during a frame, then executed together, and their hits are mapped back to entities.
+ * Raycasts and sphere casts keep their closest hit only, overlap tests keep one hit per overlapping body.
+ *
+ * @note Queries must not be executed while the physics world is being stepped.
+ *
+ * @example "Line of sight checks"
+ * @code
+ * auto &batch = core.GetResource<ES::Plugin::Physics::Resource::QueryBatch>();
+ * batch.Clear();
+ * for (auto &[entity, eyes, target] : ...)
+ *     batch.AddRaycast(eyes, target - eyes);
+ * batch.Execute(core);
+ * for (uint32_t i = 0; i < batch.Size(); i++)
+ *     bool visible = batch.GetHits(i).empty();
+ * @endcode
+ */
+class QueryBatch {
+  public:
+    /// @brief Minimum number of queries run by a single job, so small batches are not split across threads.
+    inline static constexpr std::size_t MIN_QUERIES_PER_JOB = 64;
+
+    QueryBatch() = default;
+    ~QueryBatch() = default;
+
+    /**
+     * @brief Add a query to the batch.
+     *
+     * @param query The query.
+     * @return Index of the query, to get its hits once the batch is executed.
+     */
+    uint32_t Add(const PhysicsQuery &query);
+
+    /**
+     * @brief Add a raycast to the batch.
+     *
+     * @param origin Start of the ray.
+     * @param direction Direction of the ray, its length being the maximum distance.
+     * @param layer The ray only hits bodies that a body of this layer would collide with.
+     * @param ignoredBody A body the ray ignores.
+     * @return Index of the query.
+     */
+    uint32_t AddRaycast(const glm::vec3 &origin, const glm::vec3 &direction,
+                        JPH::ObjectLayer layer = Utils::Layers::MOVING, JPH::BodyID ignoredBody = JPH::BodyID());
+
+    /**
+     * @brief Add a sphere cast to the batch.
+     *
+     * @param origin Start position of the center of the sphere.
+     * @param radius Radius of the sphere, must be greater than 0.
+     * @param direction Direction of the cast, its length being the maximum distance.
+     * @param layer The cast only hits bodies that a body of this layer would collide with.
+     * @param ignoredBody A body the cast ignores.
+     * @return Index of the query.
+     */
+    uint32_t AddSphereCast(const glm::vec3 &origin, float radius, const glm::vec3 &direction,
+                           JPH::ObjectLayer layer = Utils::Layers::MOVING, JPH::BodyID ignoredBody = JPH::BodyID());
+
+    /**
+     * @brief Add a sphere overlap test to the batch.
+     *
+     * @param center Center of the sphere.
+     * @param radius Radius of the sphere, must be greater than 0.
+     * @param layer The test only hits bodies that a body of this layer would collide with.
+     * @param ignoredBody A body the test ignores.
+     * @return Index of the query.
+     */
+    uint32_t AddSphereOverlap(const glm::vec3 &center, float radius, JPH::ObjectLayer layer = Utils::Layers::MOVING,
+                              JPH::BodyID ignoredBody = JPH::BodyID());
+
+    /**
+     * @brief Run every query of the batch.
+     * Large batches are split into jobs run by the job system of the PhysicsManager, the calling thread waits for
+     * them and helps running them.
+     *
+     * @param core The core, holding the PhysicsManager.
+     */
+    void Execute(ES::Engine::Core &core);
+
+    /**
+     * @brief Get the hits of a query, once the batch is executed.
+     *
+     * @param index Index of the query, as returned when it was added.
+     * @return The hits, empty if the query hit nothing.
+     */
+    inline std::span<const QueryHit> GetHits(uint32_t index) const { return _hits.at(index); }
+
+    /**
+     * @brief Remove every query and hit from the batch. Memory is kept to be reused by the next queries.
+     */
+    void Clear();
+
+    inline uint32_t Size() const { return static_cast<uint32_t>(_queries.size()); }
+
+  private:
+    /**
+     * @brief Run the queries in [begin, end).
+     */
+    void RunQueries(const JPH::PhysicsSystem &physicsSystem, std::size_t begin, std::size_t end);
+
+    std::vector<PhysicsQuery> _queries;
+    /// @brief Hits of every query, kept across Clear so their memory is reused.
+    std::vector<std::vector<QueryHit>> _hits;
+};
+} // namespace ES::Plugin::Physics::Resource
@@ -0,0 +1,139 @@
+#include "SoftBodySettingsCache.hpp"
+
+#include "MeshHash.hpp"
+
+namespace ES::Plugin::Physics::Resource {
+/**
+ * @brief Build the settings of a soft body from the vertices and faces already copied into them.
+ */
+static void FinishSettings(JPH::SoftBodySharedSettings &settings,
+                           const JPH::SoftBodySharedSettings::VertexAttributes &vertexAttributes,
+                           bool calculateVolumeConstraintVolumes, bool calculateSkinnedConstraintNormals)
+{
+    settings.CreateConstraints(&vertexAttributes, 1, JPH::SoftBodySharedSettings::EBendType::Distance);
+
+    if (calculateVolumeConstraintVolumes)
+    {
+        settings.CalculateVolumeConstraintVolumes();
+    }
+    if (calculateSkinnedConstraintNormals)
+    {
+        settings.CalculateSkinnedConstraintNormals();
+    }
+
+    settings.Optimize();
+}
+
+SoftBodySettingsCache::Key SoftBodySettingsCache::MakeKey(const ES::Plugin::Object::Component::Mesh &mesh,
+                                                         const Component::SoftBody3D &softBody)
+{
+    uint64_t hash = Utils::HashMesh(mesh);
+
+    Utils::HashCombine(hash, softBody.vertexSettings.initialVelocity);
+    Utils::HashCombine(hash, softBody.vertexSettings.invMass);
+    Utils::HashCombine(hash, softBody.vertexAttributes.mCompliance);
+    Utils::HashCombine(hash, softBody.vertexAttributes.mShearCompliance);
+    Utils::HashCombine(hash, softBody.vertexAttributes.mBendCompliance);
+    Utils::HashCombine(hash, static_cast<uint64_t>(softBody.vertexAttributes.mLRAType));
+    Utils::HashCombine(hash, softBody.vertexAttributes.mLRAMaxDistanceMultiplier);
+    Utils::HashCombine(hash, static_cast<uint64_t>(softBody.calculateVolumeConstraintVolumes));
+    Utils::HashCombine(hash, static_cast<uint64_t>(softBody.calculateSkinnedConstraintNormals));
+
+    return Key{hash, mesh.vertices.size(), mesh.indices.size()};
+}
+
+JPH::Ref<JPH::SoftBodySharedSettings>
+SoftBodySettingsCache::Acquire(const Key &key, const ES::Plugin::Object::Component::Mesh &mesh,
+                               const Component::SoftBody3D &softBody, JPH::JobSystem *jobSystem)
+{
+    auto it = _entries.find(key);
+    if (it != _entries.end() && it->second.vertices == mesh.vertices && it->second.indices == mesh.indices)
+    {
+        return it->second.settings;
+    }
+
+    JPH::Ref<JPH::SoftBodySharedSettings> settings = new JPH::SoftBodySharedSettings();
+
+    // Copy the vertices from the mesh to the soft body settings
+    settings->mVertices.resize(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); i++)
+    {
+        JPH::SoftBodySharedSettings::Vertex v(JPH::Float3(mesh.vertices[i].x, mesh.vertices[i].y, mesh.vertices[i].z));
+        v.mVelocity = JPH::Float3(softBody.vertexSettings.initialVelocity.x, softBody.vertexSettings.initialVelocity.y,
+                                  softBody.vertexSettings.initialVelocity.z);
+        v.mInvMass = softBody.vertexSettings.invMass;
+        settings->mVertices[i] = v;
+    }
+
+    // Create faces from the mesh triangles
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+    {
+        settings->AddFace(JPH::SoftBodySharedSettings::Face(mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]));
+    }
+
+    // Another mesh has the same key: its settings are built on this thread and not cached, so the entry keeps
+    // tracking the readiness of the settings it holds
+    if (it != _entries.end())
+    {
+        FinishSettings(*settings, softBody.vertexAttributes, softBody.calculateVolumeConstraintVolumes,
+                       softBody.calculateSkinnedConstraintNormals);
+        return settings;
+    }
+
+    auto ready = std::make_shared<std::atomic<bool>>(false);
+    _entries.emplace(key, Entry{settings, ready, mesh.vertices, mesh.indices});
+
+    if (jobSystem == nullptr)
+    {
+        FinishSettings(*settings, softBody.vertexAttributes, softBody.calculateVolumeConstraintVolumes,
+                       softBody.calculateSkinnedConstraintNormals);
+        ready->store(true, std::memory_order_release);
+        return settings;
+    }
+
+    // The job system keeps a reference to the job, so its handle does not need to be kept
+    jobSystem->CreateJob("BuildSoftBodySettings", JPH::Color::sOrange,
+                         [settings, ready, vertexAttributes = softBody.vertexAttributes,
+                          calculateVolumes = softBody.calculateVolumeConstraintVolumes,
+                          calculateNormals = softBody.calculateSkinnedConstraintNormals]() {
+                             FinishSettings(*settings, vertexAttributes, calculateVolumes, calculateNormals);
+                             ready->store(true, std::memory_order_release);
+                         });
+    return settings;
+}
+
+bool SoftBodySettingsCache::IsReady(const Key &key) const
+{
+    auto it = _entries.find(key);
+    return it == _entries.end() || it->second.ready->load(std::memory_order_acquire);
+}
+
+std::vector<entt::entity> SoftBodySettingsCache::PopReadyEntities()
+{
+    std::vector<entt::entity> entities;
+    std::erase_if(_pending, [this, &entities](const auto &pending) {
+        if (!IsReady(pending.second))
+        {
+            return false;
+        }
+        entities.push_back(pending.first);
+        return true;
+    });
+    return entities;
+}
+
+void SoftBodySettingsCache::Prune()
+{
+    if (_pruneFlushes > 0)
+    {
+        _pruneFlushes--;
+    }
+    // Components, bodies and building jobs all hold a reference: the cache holds the last one of unused settings
+    std::erase_if(_entries, [](const auto &entry) { return entry.second.settings->GetRefCount() == 1; });
+}
+
+void SoftBodySettingsCache::Clear()
+{
+    std::erase_if(_entries, [](const auto &entry) { return entry.second.ready->load(std::memory_order_acquire); });
+}
+} // namespace ES::Plugin::Physics::Resource
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Mesh.hpp"
+#include "SoftBody3D.hpp"
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Core/JobSystem.h>
+#include <Jolt/Core/Reference.h>
+#include <Jolt/Physics/SoftBody/SoftBodySharedSettings.h>
+#include <atomic>
+#include <cstdint>
+#include <entt/entity/entity.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ES::Plugin::Physics::Resource {
+/**
+ * SoftBodySettingsCache is a resource sharing the finished JPH::SoftBodySharedSettings of soft bodies built from the
+ * same mesh with the same vertex and constraint parameters.
+ *
+ * Building the settings of a dense mesh (constraints, volumes, skinned normals and the final Optimize) is expensive,
+ * so it is only done once per mesh, either on the calling thread or as a job of the physics job system.
+ * Soft bodies whose settings are still being built are added to the physics world by the AddPendingSoftBodies
+ * system once they are ready.
+ *
+ * @note Meshes are identified by a 64 bits hash of their vertices and indices, not by their address, as every
+ * entity owns a copy of its mesh. The cache keeps a copy of the vertices and indices of every entry, so a hash
+ * collision builds separate settings instead of sharing the wrong ones.
+ * @see PhysicsConfig::buildSoftBodySettingsAsync
+ */
+class SoftBodySettingsCache {
+  public:
+    /// @brief Body flushes from the removal of a soft body to its destruction: one removes it from the world, the
+    /// next one destroys it.
+    inline static constexpr uint8_t PRUNE_FLUSHES = 2;
+
+    /**
+     * @brief Identity of the settings of a soft body.
+     */
+    struct Key {
+        uint64_t hash = 0;
+        std::size_t numVertices = 0;
+        std::size_t numIndices = 0;
+
+        bool operator==(const Key &other) const = default;
+    };
+
+    SoftBodySettingsCache() = default;
+    ~SoftBodySettingsCache() = default;
+
+    SoftBodySettingsCache(const SoftBodySettingsCache &) = delete;
+    SoftBodySettingsCache &operator=(const SoftBodySettingsCache &) = delete;
+    SoftBodySettingsCache(SoftBodySettingsCache &&) = default;
+    SoftBodySettingsCache &operator=(SoftBodySettingsCache &&) = default;
+
+    /**
+     * @brief Compute the key of the settings a soft body would get with a mesh.
+     */
+    static Key MakeKey(const ES::Plugin::Object::Component::Mesh &mesh, const Component::SoftBody3D &softBody);
+
+    /**
+     * @brief Get the settings of a soft body, building them if no soft body used them before.
+     *
+     * @param key Key of the settings, from MakeKey.
+     * @param mesh Mesh of the soft body.
+     * @param softBody Soft body, providing the vertex and constraint parameters.
+     * @param jobSystem Job system building the settings, or nullptr to build them on the calling thread.
+     * @return The settings. They must not be used until IsReady returns true.
+     */
+    JPH::Ref<JPH::SoftBodySharedSettings> Acquire(const Key &key, const ES::Plugin::Object::Component::Mesh &mesh,
+                                                  const Component::SoftBody3D &softBody, JPH::JobSystem *jobSystem);
+
+    /**
+     * @brief Check if the settings of a key are built.
+     */
+    bool IsReady(const Key &key) const;
+
+    /**
+     * @brief Remember an entity waiting for its settings to be built.
+     */
+    inline void AddPending(entt::entity entity, const Key &key) { _pending.emplace_back(entity, key); }
+
+    /**
+     * @brief Get the entities whose settings are now built, and forget them.
+     */
+    std::vector<entt::entity> PopReadyEntities();
+
+    /**
+     * @brief Forget the settings no soft body component nor body of the physics world uses anymore.
+     */
+    void Prune();
+
+    /**
+     * @brief Ask for the cache to be pruned once the bodies of the unlinked soft bodies are destroyed.
+     */
+    inline void RequestPrune() { _pruneFlushes = PRUNE_FLUSHES; }
+
+    /**
+     * @brief Check if the cache may hold settings no soft body uses anymore.
+     * @note The request lasts PRUNE_FLUSHES prunes, as the body of an unlinked soft body still uses its settings
+     * until the BodyRecycler destroys it.
+     */
+    inline bool IsPruneRequested() const { return _pruneFlushes > 0; }
+
+    /**
+     * @brief Forget every built settings. Soft bodies using them keep them alive, settings still being built are
+     * kept until they are finished.
+     */
+    void Clear();
+
+    inline std::size_t Size() const { return _entries.size(); }
+
+  private:
+    struct Entry {
+        JPH::Ref<JPH::SoftBodySharedSettings> settings;
+        /// @brief Set by the job building the settings once they are finished.
+        std::shared_ptr<std::atomic<bool>> ready;
+        /// @brief Mesh the settings were built from, compared on every hit.
+        std::vector<glm::vec3> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    struct KeyHash {
+        inline std::size_t operator()(const Key &key) const { return static_cast<std::size_t>(key.hash); }
+    };
+
+    std::unordered_map<Key, Entry, KeyHash> _entries;
+    std::vector<std::pair<entt::entity, Key>> _pending;
+    /// @brief Prunes left before the request is over.
+    uint8_t _pruneFlushes = 0;
+};
+} // namespace ES::Plugin::Physics::Resource
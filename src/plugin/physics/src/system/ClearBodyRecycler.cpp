@@ -0,0 +1,11 @@
+#include "ClearBodyRecycler.hpp"
+
+#include "PhysicsManager.hpp"
+
+namespace ES::Plugin::Physics::System {
+void ClearBodyRecycler(ES::Engine::Core &core)
+{
+    auto &physicsManager = core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>();
+    physicsManager.GetBodyRecycler().Clear(physicsManager.GetPhysicsSystem().GetBodyInterface());
+}
+} // namespace ES::Plugin::Physics::System
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::Physics::System {
+/**
+ * @brief Destroy the bodies still waiting in the BodyRecycler, queued, removed or pooled.
+ *
+ * @param core  core
+ * @note To be used with the "Shutdown" scheduler, before ShutdownJoltPhysics.
+ * @see BodyRecycler
+ */
+void ClearBodyRecycler(ES::Engine::Core &core);
+} // namespace ES::Plugin::Physics::System
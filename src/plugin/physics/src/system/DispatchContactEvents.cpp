@@ -0,0 +1,23 @@
+#include "DispatchContactEvents.hpp"
+
+#include "PhysicsManager.hpp"
+#include "PhysicsStats.hpp"
+
+#include <chrono>
+
+namespace ES::Plugin::Physics::System {
+void DispatchContactEvents(ES::Engine::Core &core)
+{
+    auto &physicsManager = core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>();
+
+    if (auto contactListener = physicsManager.GetContactListener(); contactListener != nullptr)
+    {
+        auto start = std::chrono::steady_clock::now();
+        contactListener->DispatchContactEvents();
+        std::chrono::duration<float, std::milli> dispatchTime = std::chrono::steady_clock::now() - start;
+
+        core.GetResource<ES::Plugin::Physics::Resource::PhysicsStats>().RecordDispatch(
+            dispatchTime.count(), contactListener->GetContactEvents().size());
+    }
+}
+} // namespace ES::Plugin::Physics::System
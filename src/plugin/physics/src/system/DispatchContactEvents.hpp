@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::Physics::System {
+/**
+ * @brief Call the contact callbacks for every contact recorded during the last physics step.
+ *
+ * @param core  core
+ * @note To be used with the "FixedTimeUpdate" scheduler, after the "PhysicsUpdate" system.
+ */
+void DispatchContactEvents(ES::Engine::Core &core);
+
+} // namespace ES::Plugin::Physics::System
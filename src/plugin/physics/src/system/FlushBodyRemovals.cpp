@@ -0,0 +1,18 @@
+#include "FlushBodyRemovals.hpp"
+
+#include "PhysicsManager.hpp"
+#include "SoftBodySettingsCache.hpp"
+
+namespace ES::Plugin::Physics::System {
+void FlushBodyRemovals(ES::Engine::Core &core)
+{
+    auto &physicsManager = core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>();
+    physicsManager.GetBodyRecycler().Flush(physicsManager.GetPhysicsSystem().GetBodyInterface());
+
+    auto &settingsCache = core.GetResource<ES::Plugin::Physics::Resource::SoftBodySettingsCache>();
+    if (settingsCache.IsPruneRequested())
+    {
+        settingsCache.Prune();
+    }
+}
+} // namespace ES::Plugin::Physics::System
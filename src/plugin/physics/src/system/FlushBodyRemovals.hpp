@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::Physics::System {
+/**
+ * @brief Remove the bodies of the rigid and soft body components destroyed since the last tick from the physics
+ * world, as a single batch, and destroy or pool the bodies removed at the last tick. Once the bodies of unlinked
+ * soft bodies are destroyed, the soft body settings no one uses anymore are pruned.
+ *
+ * @param core  core
+ * @note To be used with the "FixedTimeUpdate" scheduler, before the physics update.
+ * @see BodyRecycler
+ */
+void FlushBodyRemovals(ES::Engine::Core &core);
+} // namespace ES::Plugin::Physics::System
@@ -1,12 +1,33 @@
 #include "InitPhysicsManager.hpp"
 
+#include "PhysicsConfig.hpp"
 #include "PhysicsManager.hpp"
+#include "PhysicsStats.hpp"
 
 namespace ES::Plugin::Physics::System {
 void InitPhysicsManager(ES::Engine::Core &core)
 {
+    auto &ctx = core.GetRegistry().ctx();
+    if (!ctx.contains<ES::Plugin::Physics::Resource::PhysicsConfig>())
+    {
+        core.RegisterResource<ES::Plugin::Physics::Resource::PhysicsConfig>(
+            ES::Plugin::Physics::Resource::PhysicsConfig());
+    }
+    const auto &config = core.GetResource<ES::Plugin::Physics::Resource::PhysicsConfig>();
+
     core.RegisterResource<ES::Plugin::Physics::Resource::PhysicsManager>(
-            ES::Plugin::Physics::Resource::PhysicsManager())
+            ES::Plugin::Physics::Resource::PhysicsManager(config))
         .Init(core);
+
+    if (!ctx.contains<ES::Plugin::Physics::Resource::PhysicsStats>())
+    {
+        core.RegisterResource<ES::Plugin::Physics::Resource::PhysicsStats>(
+            ES::Plugin::Physics::Resource::PhysicsStats());
+    }
+    auto &stats = core.GetResource<ES::Plugin::Physics::Resource::PhysicsStats>();
+    stats.maxBodies = config.maxBodies;
+    stats.maxBodyPairs = config.maxBodyPairs;
+    stats.maxContactConstraints = config.maxContactConstraints;
+    stats.tempAllocatorSize = config.tempAllocatorSize;
 }
 } // namespace ES::Plugin::Physics::System
@@ -4,7 +4,7 @@
 
 namespace ES::Plugin::Physics::System {
 /**
- * @brief Init the PhysicsManager.
+ * @brief Init the PhysicsManager, using the PhysicsConfig resource (a default one is registered if missing).
  *
  * @param core  core
  * @note To be used with the "Startup" scheduler.
@@ -0,0 +1,65 @@
+#include "InterpolateTransforms.hpp"
+
+#include "FixedTimeUpdate.hpp"
+#include "Transform.hpp"
+#include "TransformInterpolation.hpp"
+#include "WorldMatrix.hpp"
+
+namespace ES::Plugin::Physics::System {
+namespace {
+bool IsAtLastTick(const Component::TransformInterpolation &interpolation,
+                  const ES::Plugin::Object::Component::Transform &transform)
+{
+    return transform.position == interpolation.currentPosition && transform.rotation == interpolation.currentRotation;
+}
+} // namespace
+
+void ResetMovedInterpolations(ES::Engine::Core &core)
+{
+    core.GetRegistry()
+        .view<Component::TransformInterpolation, ES::Plugin::Object::Component::Transform>()
+        .each([](auto &interpolation, auto &transform) {
+            if (IsAtLastTick(interpolation, transform))
+            {
+                return;
+            }
+            interpolation = Component::TransformInterpolation(transform.position, transform.rotation);
+        });
+}
+
+void StoreInterpolatedTransforms(ES::Engine::Core &core)
+{
+    core.GetRegistry()
+        .view<Component::TransformInterpolation, ES::Plugin::Object::Component::Transform>()
+        .each([](auto &interpolation, auto &transform) {
+            interpolation.previousPosition = interpolation.currentPosition;
+            interpolation.previousRotation = interpolation.currentRotation;
+            interpolation.currentPosition = transform.position;
+            interpolation.currentRotation = transform.rotation;
+        });
+}
+
+void InterpolateTransforms(ES::Engine::Core &core)
+{
+    float alpha = core.GetScheduler<ES::Engine::Scheduler::FixedTimeUpdate>().GetInterpolationFactor();
+
+    core.GetRegistry()
+        .view<Component::TransformInterpolation, ES::Plugin::Object::Component::Transform,
+              ES::Plugin::Object::Component::WorldMatrix>()
+        .each([alpha](auto &interpolation, auto &transform, auto &worldMatrix) {
+            // The transform was moved by gameplay code since the last tick, UpdateWorldMatrices renders it as is
+            if (!IsAtLastTick(interpolation, transform))
+            {
+                return;
+            }
+
+            ES::Plugin::Object::Component::Transform pose(
+                glm::mix(interpolation.previousPosition, interpolation.currentPosition, alpha), transform.scale,
+                glm::slerp(interpolation.previousRotation, interpolation.currentRotation, alpha));
+            worldMatrix.model = pose.getTransformationMatrix();
+            worldMatrix.normal = glm::mat3(glm::transpose(glm::inverse(worldMatrix.model)));
+            // Marks the matrices as up to date, so UpdateWorldMatrices doesn't replace them with the simulated pose
+            worldMatrix.source = transform;
+        });
+}
+} // namespace ES::Plugin::Physics::System
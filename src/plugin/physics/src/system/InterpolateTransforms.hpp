@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::Physics::System {
+/**
+ * @brief Stop interpolating the entities whose Transform was moved by gameplay code since the last physics tick,
+ * so they are not rendered sliding from their former pose.
+ *
+ * @param core  core
+ * @note To be used with the "FixedTimeUpdate" scheduler, before SyncRigidBodiesToTransforms.
+ */
+void ResetMovedInterpolations(ES::Engine::Core &core);
+
+/**
+ * @brief Record the pose of the physics tick that just ran, the pose of the previous tick becoming the start of
+ * the interpolation.
+ *
+ * @param core  core
+ * @note To be used with the "FixedTimeUpdate" scheduler, after SyncTransformsToRigidBodies.
+ */
+void StoreInterpolatedTransforms(ES::Engine::Core &core);
+
+/**
+ * @brief Write in the world matrices the pose interpolated between the last two physics ticks, using the time
+ * accumulated by the FixedTimeUpdate scheduler since the last tick. Transforms are left untouched.
+ *
+ * @param core  core
+ * @note To be used with the "Update" scheduler, before UpdateWorldMatrices. Entities without a WorldMatrix yet
+ * are skipped.
+ */
+void InterpolateTransforms(ES::Engine::Core &core);
+} // namespace ES::Plugin::Physics::System
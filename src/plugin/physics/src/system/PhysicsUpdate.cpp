@@ -4,20 +4,30 @@
 #include "Logger.hpp"
 #include "Mesh.hpp"
 #include "PhysicsManager.hpp"
+#include "PhysicsStats.hpp"
 #include "RigidBody3D.hpp"
+#include "SoftBodySettingsCache.hpp"
 #include "SoftBody3D.hpp"
+#include "StreamedBody.hpp"
 #include "Transform.hpp"
+#include "TransformInterpolation.hpp"
 
+#include <chrono>
 #include <fmt/format.h>
 
-// TODO: find a way to have custom signal (so that we can send Core rather than entt::registry)
-void ES::Plugin::Physics::System::LinkRigidBodiesToPhysicsSystem(entt::registry &registry, entt::entity entity)
+// Body user data holds the entity, and the component mask used to route contact callbacks
+static uint64_t MakeBodyUserData(ES::Plugin::Physics::Resource::PhysicsManager &physicsManager, entt::entity entity)
 {
-    auto &rigidBody = registry.get<ES::Plugin::Physics::Component::RigidBody3D>(entity);
-    if (rigidBody.body != nullptr)
+    if (auto contactListener = physicsManager.GetContactListener(); contactListener != nullptr)
     {
-        return;
+        return contactListener->MakeBodyUserData(entity);
     }
+    return entt::to_integral(entity);
+}
+
+JPH::Body *ES::Plugin::Physics::System::CreateRigidBody(entt::registry &registry, entt::entity entity)
+{
+    auto &rigidBody = registry.get<ES::Plugin::Physics::Component::RigidBody3D>(entity);
     // TODO: have a RequireComponent function that does this
     if (!registry.all_of<ES::Plugin::Object::Component::Transform>(entity))
     {
@@ -34,27 +44,64 @@ void ES::Plugin::Physics::System::LinkRigidBodiesToPhysicsSystem(entt::registry
     {
         ES::Utils::Log::Error(
             fmt::format("Failed to create shape for entity {}: {}", static_cast<uint32_t>(entity), shape.GetError()));
-        return;
+        return nullptr;
     }
     JPH::ShapeRefC shapeRef = shape.Get();
+    JPH::RVec3 position(transform.position.x, transform.position.y, transform.position.z);
+    JPH::Quat rotation(transform.rotation.x, transform.rotation.y, transform.rotation.z, transform.rotation.w);
+    auto &bodyInterface = physicsSystem.GetBodyInterface();
 
-    JPH::BodyCreationSettings bodySettings(
-        shapeRef, JPH::RVec3(transform.position.x, transform.position.y, transform.position.z),
-        JPH::Quat(transform.rotation.x, transform.rotation.y, transform.rotation.z, transform.rotation.w),
-        rigidBody.motionType, rigidBody.layer);
-
-    rigidBody.body = physicsSystem.GetBodyInterface().CreateBody(bodySettings);
+    // Reuse the body of a destroyed rigid body if one is pooled, so spawning doesn't allocate
+    rigidBody.body = physicsManager.GetBodyRecycler().Acquire(shapeRef.GetPtr(), rigidBody.motionType, rigidBody.layer);
+    if (rigidBody.body != nullptr)
+    {
+        bodyInterface.SetPositionAndRotation(rigidBody.body->GetID(), position, rotation,
+                                             JPH::EActivation::DontActivate);
+    }
+    else
+    {
+        JPH::BodyCreationSettings bodySettings(shapeRef, position, rotation, rigidBody.motionType, rigidBody.layer);
+        rigidBody.body = bodyInterface.CreateBody(bodySettings);
+    }
 
     if (rigidBody.body == nullptr)
     {
         ES::Utils::Log::Error(
             fmt::format("Failed to create rigid body for entity {}: returned nullptr", static_cast<uint32_t>(entity)));
-        return;
+        return nullptr;
     }
 
-    rigidBody.body->SetUserData(entt::to_integral(entity));
+    rigidBody.body->SetUserData(MakeBodyUserData(physicsManager, entity));
 
-    physicsSystem.GetBodyInterface().AddBody(rigidBody.body->GetID(), JPH::EActivation::Activate);
+    if (physicsManager.GetConfig().interpolateTransforms && rigidBody.motionType != JPH::EMotionType::Static)
+    {
+        registry.emplace_or_replace<ES::Plugin::Physics::Component::TransformInterpolation>(
+            entity, transform.position, transform.rotation);
+    }
+    return rigidBody.body;
+}
+
+// TODO: find a way to have custom signal (so that we can send Core rather than entt::registry)
+void ES::Plugin::Physics::System::LinkRigidBodiesToPhysicsSystem(entt::registry &registry, entt::entity entity)
+{
+    auto &rigidBody = registry.get<ES::Plugin::Physics::Component::RigidBody3D>(entity);
+    if (rigidBody.body != nullptr)
+    {
+        return;
+    }
+    // Streamed bodies are only created once they are in range of a focus, by the StreamBodies system
+    if (registry.all_of<ES::Plugin::Physics::Component::StreamedBody>(entity))
+    {
+        return;
+    }
+
+    JPH::Body *body = CreateRigidBody(registry, entity);
+    if (body == nullptr)
+    {
+        return;
+    }
+    auto &physicsManager = registry.ctx().get<ES::Plugin::Physics::Resource::PhysicsManager>();
+    physicsManager.GetPhysicsSystem().GetBodyInterface().AddBody(body->GetID(), JPH::EActivation::Activate);
 }
 
 void ES::Plugin::Physics::System::LinkSoftBodiesToPhysicsSystem(entt::registry &registry, entt::entity entity)
@@ -79,53 +126,39 @@ void ES::Plugin::Physics::System::LinkSoftBodiesToPhysicsSystem(entt::registry &
                                          static_cast<uint32_t>(entity)));
     }
 
-    auto &initialTransform = registry.get<ES::Plugin::Object::Component::Transform>(entity);
     auto &mesh = registry.get<ES::Plugin::Object::Component::Mesh>(entity);
+    auto &physicsManager = registry.ctx().get<ES::Plugin::Physics::Resource::PhysicsManager>();
+    auto &settingsCache = registry.ctx().get<ES::Plugin::Physics::Resource::SoftBodySettingsCache>();
 
-    softBody.settings = std::make_shared<JPH::SoftBodySharedSettings>();
-
-    softBody.settings->SetEmbedded();
-
-    // Copy the vertices from the mesh to the soft body settings
-    softBody.settings->mVertices.resize(mesh.vertices.size());
-
-    for (size_t i = 0; i < mesh.vertices.size(); i++)
-    {
-        JPH::SoftBodySharedSettings::Vertex v(JPH::Float3(mesh.vertices[i].x, mesh.vertices[i].y, mesh.vertices[i].z));
-        v.mVelocity = JPH::Float3(softBody.vertexSettings.initialVelocity.x, softBody.vertexSettings.initialVelocity.y,
-                                  softBody.vertexSettings.initialVelocity.z);
-        v.mInvMass = softBody.vertexSettings.invMass;
-        softBody.settings->mVertices[i] = v;
-    }
+    // Soft bodies made from the same mesh share their settings, which are expensive to build
+    auto key = ES::Plugin::Physics::Resource::SoftBodySettingsCache::MakeKey(mesh, softBody);
+    JPH::JobSystem *jobSystem =
+        physicsManager.GetConfig().buildSoftBodySettingsAsync ? physicsManager.GetJobSystem() : nullptr;
+    softBody.settings = settingsCache.Acquire(key, mesh, softBody, jobSystem);
 
-    // Create faces from the mesh triangles
-    for (size_t i = 0; i < mesh.indices.size(); i += 3)
+    if (!settingsCache.IsReady(key))
     {
-        JPH::SoftBodySharedSettings::Face f(mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]);
-        softBody.settings->AddFace(f);
+        settingsCache.AddPending(entity, key);
+        return;
     }
 
-    // Create constraints
-    softBody.settings->CreateConstraints(&softBody.vertexAttributes, 1,
-                                         JPH::SoftBodySharedSettings::EBendType::Distance);
-
-    if (softBody.calculateVolumeConstraintVolumes)
-    {
-        softBody.settings->CalculateVolumeConstraintVolumes();
-    }
-    if (softBody.calculateSkinnedConstraintNormals)
+    JPH::Body *body = CreateSoftBody(registry, entity);
+    if (body == nullptr)
     {
-        softBody.settings->CalculateSkinnedConstraintNormals();
+        return;
     }
+    physicsManager.GetPhysicsSystem().GetBodyInterface().AddBody(body->GetID(), JPH::EActivation::Activate);
+}
 
-    softBody.settings->Optimize();
-
-    // Add the soft body to the physics system
+JPH::Body *ES::Plugin::Physics::System::CreateSoftBody(entt::registry &registry, entt::entity entity)
+{
+    auto &softBody = registry.get<ES::Plugin::Physics::Component::SoftBody3D>(entity);
+    auto &initialTransform = registry.get<ES::Plugin::Object::Component::Transform>(entity);
     auto &physicsManager = registry.ctx().get<ES::Plugin::Physics::Resource::PhysicsManager>();
     auto &physicsSystem = physicsManager.GetPhysicsSystem();
 
     JPH::SoftBodyCreationSettings creationSettings(
-        softBody.settings.get(),
+        softBody.settings.GetPtr(),
         JPH::RVec3(initialTransform.position.x, initialTransform.position.y, initialTransform.position.z),
         JPH::Quat(initialTransform.rotation.x, initialTransform.rotation.y, initialTransform.rotation.z,
                   initialTransform.rotation.w),
@@ -139,12 +172,39 @@ void ES::Plugin::Physics::System::LinkSoftBodiesToPhysicsSystem(entt::registry &
     {
         ES::Utils::Log::Error(
             fmt::format("Failed to create soft body for entity {}: returned nullptr", static_cast<uint32_t>(entity)));
-        return;
+        return nullptr;
     }
 
-    softBody.body->SetUserData(entt::to_integral(entity));
+    softBody.body->SetUserData(MakeBodyUserData(physicsManager, entity));
+    return softBody.body;
+}
+
+void ES::Plugin::Physics::System::AddPendingSoftBodies(ES::Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+    auto &settingsCache = core.GetResource<ES::Plugin::Physics::Resource::SoftBodySettingsCache>();
+    auto &bodyInterface =
+        core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>().GetPhysicsSystem().GetBodyInterface();
+
+    for (entt::entity entity : settingsCache.PopReadyEntities())
+    {
+        // The entity may have been destroyed, or its soft body replaced, while its settings were built
+        if (!registry.valid(entity) || !registry.all_of<ES::Plugin::Physics::Component::SoftBody3D>(entity))
+        {
+            continue;
+        }
+        const auto &softBody = registry.get<ES::Plugin::Physics::Component::SoftBody3D>(entity);
+        if (softBody.body != nullptr || softBody.settings == nullptr)
+        {
+            continue;
+        }
 
-    physicsSystem.GetBodyInterface().AddBody(softBody.body->GetID(), JPH::EActivation::Activate);
+        JPH::Body *body = CreateSoftBody(registry, entity);
+        if (body != nullptr)
+        {
+            bodyInterface.AddBody(body->GetID(), JPH::EActivation::Activate);
+        }
+    }
 }
 
 void ES::Plugin::Physics::System::UnlinkRigidBodiesToPhysicsSystem(entt::registry &registry, entt::entity entity)
@@ -156,10 +216,12 @@ void ES::Plugin::Physics::System::UnlinkRigidBodiesToPhysicsSystem(entt::registr
     }
 
     auto &physicsManager = registry.ctx().get<ES::Plugin::Physics::Resource::PhysicsManager>();
-    auto &physicsSystem = physicsManager.GetPhysicsSystem();
 
-    physicsSystem.GetBodyInterface().RemoveBody(rigidBody.body->GetID());
+    // The body is removed and destroyed, or pooled, with the others at the next tick
+    physicsManager.GetBodyRecycler().Queue(rigidBody.body, true);
     rigidBody.body = nullptr;
+
+    registry.remove<ES::Plugin::Physics::Component::TransformInterpolation>(entity);
 }
 
 void ES::Plugin::Physics::System::UnlinkSoftBodiesToPhysicsSystem(entt::registry &registry, entt::entity entity)
@@ -171,10 +233,12 @@ void ES::Plugin::Physics::System::UnlinkSoftBodiesToPhysicsSystem(entt::registry
     }
 
     auto &physicsManager = registry.ctx().get<ES::Plugin::Physics::Resource::PhysicsManager>();
-    auto &physicsSystem = physicsManager.GetPhysicsSystem();
 
-    physicsSystem.GetBodyInterface().RemoveBody(softBody.body->GetID());
+    physicsManager.GetBodyRecycler().Queue(softBody.body, false);
     softBody.body = nullptr;
+
+    // The settings can only be forgotten once the body is destroyed, which FlushBodyRemovals checks
+    registry.ctx().get<ES::Plugin::Physics::Resource::SoftBodySettingsCache>().RequestPrune();
 }
 
 void ES::Plugin::Physics::System::OnConstructLinkRigidBodiesToPhysicsSystem(ES::Engine::Core &core)
@@ -320,8 +384,15 @@ void ES::Plugin::Physics::System::SyncSoftBodiesData(ES::Engine::Core &core)
     core.GetRegistry()
         .view<ES::Plugin::Physics::Component::SoftBody3D, ES::Plugin::Object::Component::Transform,
               ES::Plugin::Object::Component::Mesh>()
-        .each([&](auto &softBody, auto &transform, auto &mesh) {
+        .each([&](auto entity, auto &softBody, auto &transform, auto &mesh) {
+            // Bodies whose settings are still being built are not in the physics world yet
+            if (softBody.body == nullptr)
+            {
+                return;
+            }
             UpdateSoftBodyEntity(core, softBody, transform, mesh);
+            // The mesh is modified in place: notify its observers, such as the renderer uploading it to the GPU
+            core.GetRegistry().patch<ES::Plugin::Object::Component::Mesh>(entity);
         });
 }
 
@@ -329,6 +400,13 @@ void ES::Plugin::Physics::System::PhysicsUpdate(ES::Engine::Core &core)
 {
     auto dt = core.GetScheduler<ES::Engine::Scheduler::FixedTimeUpdate>().GetTickRate();
     auto &physicsManager = core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>();
+
+    physicsManager.ResetStepStats();
+    auto start = std::chrono::steady_clock::now();
     physicsManager.GetPhysicsSystem().Update(dt, physicsManager.GetCollisionSteps(), physicsManager.GetTempAllocator(),
                                              physicsManager.GetJobSystem());
+    std::chrono::duration<float, std::milli> stepTime = std::chrono::steady_clock::now() - start;
+
+    core.GetResource<ES::Plugin::Physics::Resource::PhysicsStats>().Record(
+        physicsManager.CollectStepStats(stepTime.count()));
 }
@@ -2,6 +2,12 @@
 
 #include "Core.hpp"
 
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/Body/Body.h>
+
 namespace ES::Plugin::Physics::System {
 /**
  * @brief Applies every update of the physics system.
@@ -16,6 +22,29 @@ void SyncTransformsToRigidBodies(ES::Engine::Core &core);
 void SyncRigidBodiesToTransforms(ES::Engine::Core &core);
 void SyncSoftBodiesData(ES::Engine::Core &core);
 
+/**
+ * @brief Create the Jolt body of a rigid body, without adding it to the physics world.
+ *
+ * @return The body, also stored in the RigidBody3D component, or nullptr if it could not be created.
+ */
+JPH::Body *CreateRigidBody(entt::registry &registry, entt::entity entity);
+
+/**
+ * @brief Create the Jolt body of a soft body from its settings, without adding it to the physics world.
+ *
+ * @return The body, also stored in the SoftBody3D component, or nullptr if it could not be created.
+ */
+JPH::Body *CreateSoftBody(entt::registry &registry, entt::entity entity);
+
+/**
+ * @brief Add the soft bodies whose settings were built by the job system since the last tick to the physics world.
+ *
+ * @param core  core
+ * @note To be used with the "FixedTimeUpdate" scheduler, before the physics update.
+ * @see SoftBodySettingsCache
+ */
+void AddPendingSoftBodies(ES::Engine::Core &core);
+
 // IMPORTANT: This function should only be used by OnConstructLinkRigidBodieToPhysicsSystem system.
 void LinkRigidBodiesToPhysicsSystem(entt::registry &registry, entt::entity entity);
 void LinkSoftBodiesToPhysicsSystem(entt::registry &registry, entt::entity entity);
@@ -0,0 +1,17 @@
+#include "RecordSnapshotHistory.hpp"
+
+#include "PhysicsManager.hpp"
+
+namespace ES::Plugin::Physics::System {
+void RecordSnapshotHistory(ES::Engine::Core &core)
+{
+    auto &physicsManager = core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>();
+    auto &history = physicsManager.GetSnapshotHistory();
+
+    if (history.GetCapacity() == 0)
+    {
+        return;
+    }
+    physicsManager.SaveSnapshot(core, history.Push());
+}
+} // namespace ES::Plugin::Physics::System
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::Physics::System {
+/**
+ * @brief Save the state of the physics world into the snapshot history of the PhysicsManager, so it can be rewound
+ * to this tick later. Does nothing if the history is disabled.
+ *
+ * @param core  core
+ * @note To be used with the "FixedTimeUpdate" scheduler, at the end of the physics systems.
+ * @see PhysicsManager::Rewind
+ */
+void RecordSnapshotHistory(ES::Engine::Core &core);
+} // namespace ES::Plugin::Physics::System
@@ -0,0 +1,146 @@
+#include "StreamBodies.hpp"
+
+#include "PhysicsFocus.hpp"
+#include "PhysicsManager.hpp"
+#include "PhysicsUpdate.hpp"
+#include "RigidBody3D.hpp"
+#include "StreamedBody.hpp"
+#include "Transform.hpp"
+#include "TransformInterpolation.hpp"
+
+#include <Jolt/Physics/Body/BodyInterface.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace ES::Plugin::Physics::System {
+/**
+ * @brief A focus, with the position of its entity.
+ */
+struct FocusPoint {
+    glm::vec3 position;
+    float radius;
+};
+
+/**
+ * @brief Distance from a position to the range of the closest focus, negative when inside of it.
+ */
+static float DistanceToRange(const std::vector<FocusPoint> &foci, const glm::vec3 &position)
+{
+    float distance = std::numeric_limits<float>::max();
+    for (const FocusPoint &focus : foci)
+    {
+        distance = std::min(distance, glm::distance(focus.position, position) - focus.radius);
+    }
+    return distance;
+}
+
+void StreamBodies(ES::Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+    auto &physicsManager = core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>();
+    const auto &config = physicsManager.GetConfig();
+    JPH::BodyInterface &bodyInterface = physicsManager.GetPhysicsSystem().GetBodyInterface();
+
+    std::vector<FocusPoint> foci;
+    registry.view<Component::PhysicsFocus, ES::Plugin::Object::Component::Transform>().each(
+        [&foci](const auto &focus, const auto &transform) { foci.push_back({transform.position, focus.radius}); });
+
+    std::vector<std::pair<float, entt::entity>> candidates;
+    std::vector<JPH::BodyID> removed;
+
+    for (auto &&[entity, streamed, rigidBody] : registry.view<Component::StreamedBody, Component::RigidBody3D>().each())
+    {
+        const auto *transform = registry.try_get<ES::Plugin::Object::Component::Transform>(entity);
+        float distance = DistanceToRange(foci, transform != nullptr ? transform->position : glm::vec3(0.0f));
+
+        if (rigidBody.body == nullptr)
+        {
+            if (distance <= 0.0f)
+            {
+                candidates.emplace_back(distance, entity);
+            }
+            continue;
+        }
+        if (distance <= config.streamingHysteresis)
+        {
+            continue;
+        }
+
+        // Keep the state of the body so it moves on where it stopped once it comes back in range
+        if (!rigidBody.body->IsStatic())
+        {
+            JPH::Vec3 linearVelocity = rigidBody.body->GetLinearVelocity();
+            JPH::Vec3 angularVelocity = rigidBody.body->GetAngularVelocity();
+            streamed.linearVelocity = glm::vec3(linearVelocity.GetX(), linearVelocity.GetY(), linearVelocity.GetZ());
+            streamed.angularVelocity =
+                glm::vec3(angularVelocity.GetX(), angularVelocity.GetY(), angularVelocity.GetZ());
+        }
+        streamed.active = rigidBody.body->IsActive();
+        // Removed from the world below, so it is not simulated anymore, then pooled for the next streamed body of
+        // its shape by the next flush
+        removed.push_back(rigidBody.body->GetID());
+        physicsManager.GetBodyRecycler().AddRemoved(rigidBody.body, true);
+        rigidBody.body = nullptr;
+        registry.remove<Component::TransformInterpolation>(entity);
+    }
+    if (!removed.empty())
+    {
+        bodyInterface.RemoveBodies(removed.data(), static_cast<int>(removed.size()));
+    }
+
+    if (candidates.empty())
+    {
+        return;
+    }
+
+    // Closest bodies first, the others wait for the next ticks
+    std::size_t numInsertions = candidates.size();
+    if (config.maxStreamedInsertionsPerTick != 0 && numInsertions > config.maxStreamedInsertionsPerTick)
+    {
+        numInsertions = config.maxStreamedInsertionsPerTick;
+        std::ranges::nth_element(candidates, candidates.begin() + static_cast<std::ptrdiff_t>(numInsertions));
+    }
+
+    std::vector<JPH::BodyID> added;
+    std::vector<JPH::BodyID> activated;
+    added.reserve(numInsertions);
+    for (std::size_t i = 0; i < numInsertions; i++)
+    {
+        entt::entity entity = candidates[i].second;
+        JPH::Body *body = CreateRigidBody(registry, entity);
+        if (body == nullptr)
+        {
+            continue;
+        }
+
+        const auto &streamed = registry.get<Component::StreamedBody>(entity);
+        if (!body->IsStatic())
+        {
+            body->SetLinearVelocity(
+                JPH::Vec3(streamed.linearVelocity.x, streamed.linearVelocity.y, streamed.linearVelocity.z));
+            body->SetAngularVelocity(
+                JPH::Vec3(streamed.angularVelocity.x, streamed.angularVelocity.y, streamed.angularVelocity.z));
+            if (streamed.active)
+            {
+                activated.push_back(body->GetID());
+            }
+        }
+        added.push_back(body->GetID());
+    }
+
+    if (added.empty())
+    {
+        return;
+    }
+    // Inserting the bodies as a batch builds a single broadphase node for all of them
+    JPH::BodyInterface::AddState addState =
+        bodyInterface.AddBodiesPrepare(added.data(), static_cast<int>(added.size()));
+    bodyInterface.AddBodiesFinalize(added.data(), static_cast<int>(added.size()), addState,
+                                    JPH::EActivation::DontActivate);
+    if (!activated.empty())
+    {
+        bodyInterface.ActivateBodies(activated.data(), static_cast<int>(activated.size()));
+    }
+}
+} // namespace ES::Plugin::Physics::System
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::Physics::System {
+/**
+ * @brief Add streamed rigid bodies that came in range of a focus to the physics world, and remove those that went
+ * out of range.
+ *
+ * A body is in range if it is closer than the radius of at least one focus. It is only removed once it is further
+ * than the radius plus PhysicsConfig::streamingHysteresis from every focus, so bodies on the border do not flicker.
+ * Removed bodies are queued in the BodyRecycler, to be removed from the world with the destroyed ones and pooled.
+ * Insertions are limited to PhysicsConfig::maxStreamedInsertionsPerTick per tick, the closest bodies first, and
+ * added as a single batch to the broadphase.
+ *
+ * @param core  core
+ * @note To be used with the "FixedTimeUpdate" scheduler, before the physics update.
+ * @see StreamedBody, PhysicsFocus
+ */
+void StreamBodies(ES::Engine::Core &core);
+} // namespace ES::Plugin::Physics::System
@@ -0,0 +1,114 @@
+#include "BodyRecycler.hpp"
+
+#include <functional>
+
+namespace ES::Plugin::Physics::Utils {
+std::size_t BodyRecycler::PoolKeyHash::operator()(const PoolKey &key) const
+{
+    std::size_t hash = std::hash<const JPH::Shape *>()(key.shape);
+    hash ^= (static_cast<std::size_t>(key.motionType) << 16) ^ static_cast<std::size_t>(key.layer);
+    return hash;
+}
+
+void BodyRecycler::Queue(JPH::Body *body, bool recyclable) { _queued.push_back({body, recyclable}); }
+
+void BodyRecycler::AddRemoved(JPH::Body *body, bool recyclable) { _removed.push_back({body, recyclable}); }
+
+void BodyRecycler::Flush(JPH::BodyInterface &bodyInterface)
+{
+    // Bodies removed by the last flush had a step to report their removed contacts, they can go now
+    _ids.clear();
+    for (const PendingBody &pending : _removed)
+    {
+        if (pending.recyclable && _poolSize < _poolCapacity)
+        {
+            PoolKey key{pending.body->GetShape(), pending.body->GetMotionType(), pending.body->GetObjectLayer()};
+            _pool[key].push_back(pending.body);
+            _poolSize++;
+            continue;
+        }
+        _ids.push_back(pending.body->GetID());
+    }
+    if (!_ids.empty())
+    {
+        bodyInterface.DestroyBodies(_ids.data(), static_cast<int>(_ids.size()));
+    }
+
+    _ids.clear();
+    for (const PendingBody &pending : _queued)
+    {
+        _ids.push_back(pending.body->GetID());
+    }
+    if (!_ids.empty())
+    {
+        bodyInterface.RemoveBodies(_ids.data(), static_cast<int>(_ids.size()));
+    }
+    _removed.swap(_queued);
+    _queued.clear();
+}
+
+JPH::Body *BodyRecycler::Acquire(const JPH::Shape *shape, JPH::EMotionType motionType, JPH::ObjectLayer layer)
+{
+    auto it = _pool.find(PoolKey{shape, motionType, layer});
+    if (it == _pool.end() || it->second.empty())
+    {
+        return nullptr;
+    }
+
+    JPH::Body *body = it->second.back();
+    it->second.pop_back();
+    _poolSize--;
+
+    if (!body->IsStatic())
+    {
+        body->SetLinearVelocity(JPH::Vec3::sZero());
+        body->SetAngularVelocity(JPH::Vec3::sZero());
+        body->ResetForce();
+        body->ResetTorque();
+    }
+    return body;
+}
+
+void BodyRecycler::ClearPool(JPH::BodyInterface &bodyInterface)
+{
+    _ids.clear();
+    for (auto &[key, bodies] : _pool)
+    {
+        for (JPH::Body *body : bodies)
+        {
+            _ids.push_back(body->GetID());
+        }
+    }
+    if (!_ids.empty())
+    {
+        bodyInterface.DestroyBodies(_ids.data(), static_cast<int>(_ids.size()));
+    }
+    _pool.clear();
+    _poolSize = 0;
+}
+
+void BodyRecycler::Clear(JPH::BodyInterface &bodyInterface)
+{
+    _ids.clear();
+    for (const PendingBody &pending : _queued)
+    {
+        _ids.push_back(pending.body->GetID());
+    }
+    if (!_ids.empty())
+    {
+        bodyInterface.RemoveBodies(_ids.data(), static_cast<int>(_ids.size()));
+    }
+    for (const PendingBody &pending : _removed)
+    {
+        _ids.push_back(pending.body->GetID());
+    }
+    if (!_ids.empty())
+    {
+        bodyInterface.DestroyBodies(_ids.data(), static_cast<int>(_ids.size()));
+    }
+    _queued.clear();
+    _removed.clear();
+
+    ClearPool(bodyInterface);
+}
+} // namespace ES::Plugin::Physics::Utils
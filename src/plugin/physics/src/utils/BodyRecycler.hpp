@@ -0,0 +1,115 @@
+#pragma once
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/Body/Body.h>
+#include <Jolt/Physics/Body/BodyInterface.h>
+#include <Jolt/Physics/Body/MotionType.h>
+#include <Jolt/Physics/Collision/ObjectLayer.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief Removes the bodies of destroyed components from the physics world in batches, then destroys them or keeps
+ * them in a pool to be reused by new rigid bodies of the same shape, motion type and layer.
+ *
+ * Bodies go through three stages:
+ * - queued: the component was destroyed, the body is still in the world until the next flush,
+ * - removed: the body was removed from the world by a flush, or by the caller of AddRemoved, it is kept one tick so
+ *   the contact removed events of that tick can still read its user data,
+ * - destroyed or pooled, by the flush after that.
+ *
+ * @note Pooled bodies keep their slot in the body manager, so they count towards PhysicsConfig::maxBodies.
+ * @note Only bodies sharing the same shape instance are reused, so entities must share their shape settings.
+ */
+class BodyRecycler {
+  public:
+    explicit BodyRecycler(std::size_t poolCapacity = 0) : _poolCapacity(poolCapacity) {}
+    ~BodyRecycler() = default;
+
+    BodyRecycler(BodyRecycler &&) = default;
+    BodyRecycler &operator=(BodyRecycler &&) = default;
+
+    /**
+     * @brief Queue a body to be removed from the world and destroyed.
+     *
+     * @param body The body, it must be in the world.
+     * @param recyclable Whether the body may be pooled. Only rigid bodies can be.
+     */
+    void Queue(JPH::Body *body, bool recyclable);
+
+    /**
+     * @brief Hand over a body the caller already removed from the world, to be destroyed or pooled by the next
+     * flush.
+     *
+     * @param body The body, it must not be in the world.
+     * @param recyclable Whether the body may be pooled. Only rigid bodies can be.
+     */
+    void AddRemoved(JPH::Body *body, bool recyclable);
+
+    /**
+     * @brief Remove the queued bodies from the world, and destroy or pool the ones removed by the last flush.
+     *
+     * @param bodyInterface The body interface of the physics system.
+     */
+    void Flush(JPH::BodyInterface &bodyInterface);
+
+    /**
+     * @brief Take a pooled body with a shape, motion type and layer.
+     * The body is not in the world, its velocities and forces are reset.
+     *
+     * @return The body, or nullptr if none is pooled.
+     */
+    JPH::Body *Acquire(const JPH::Shape *shape, JPH::EMotionType motionType, JPH::ObjectLayer layer);
+
+    /**
+     * @brief Destroy every pooled body.
+     */
+    void ClearPool(JPH::BodyInterface &bodyInterface);
+
+    /**
+     * @brief Destroy every body of the recycler right away: the queued ones are removed from the world first, and
+     * the pooled ones are destroyed too.
+     */
+    void Clear(JPH::BodyInterface &bodyInterface);
+
+    inline std::size_t GetPoolSize() const { return _poolSize; }
+    inline std::size_t GetPoolCapacity() const { return _poolCapacity; }
+    inline std::size_t GetQueuedCount() const { return _queued.size(); }
+    inline std::size_t GetRemovedCount() const { return _removed.size(); }
+
+  private:
+    struct PoolKey {
+        const JPH::Shape *shape;
+        JPH::EMotionType motionType;
+        JPH::ObjectLayer layer;
+
+        bool operator==(const PoolKey &other) const = default;
+    };
+
+    struct PoolKeyHash {
+        std::size_t operator()(const PoolKey &key) const;
+    };
+
+    struct PendingBody {
+        JPH::Body *body;
+        bool recyclable;
+    };
+
+    std::size_t _poolCapacity;
+    std::size_t _poolSize = 0;
+
+    std::vector<PendingBody> _queued;
+    std::vector<PendingBody> _removed;
+    std::unordered_map<PoolKey, std::vector<JPH::Body *>, PoolKeyHash> _pool;
+
+    /// @brief Scratch buffer for the ids of the bodies of a batch.
+    std::vector<JPH::BodyID> _ids;
+};
+} // namespace ES::Plugin::Physics::Utils
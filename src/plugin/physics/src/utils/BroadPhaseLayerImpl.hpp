@@ -1,9 +1,8 @@
 #pragma once
 
-#include "BroadPhaseLayers.hpp"
-#include "Layers.hpp"
+#include "CollisionLayers.hpp"
 
-#include <array>
+#include <memory>
 
 // clang-format off
 #include <Jolt/Jolt.h>
@@ -14,36 +13,25 @@
 
 namespace ES::Plugin::Physics::Utils {
 // BroadPhaseLayerInterface implementation
-// This defines a mapping between object and broadphase layers.
+// This defines a mapping between object and broadphase layers, as configured in the collision layers.
 class BPLayerInterfaceImpl final : public JPH::BroadPhaseLayerInterface {
   public:
-    BPLayerInterfaceImpl()
-    {
-        // Create a mapping table from object to broad phase layer
-        _objectToBroadPhase[Layers::NON_MOVING] = BroadPhaseLayers::NON_MOVING;
-        _objectToBroadPhase[Layers::MOVING] = BroadPhaseLayers::MOVING;
-    }
+    explicit BPLayerInterfaceImpl(std::shared_ptr<const CollisionLayers> layers) : _layers(std::move(layers)) {}
 
-    virtual JPH::uint GetNumBroadPhaseLayers() const override { return BroadPhaseLayers::NUM_LAYERS; }
+    virtual JPH::uint GetNumBroadPhaseLayers() const override { return _layers->GetNumBroadPhaseLayers(); }
 
     virtual JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer inLayer) const override
     {
-        JPH_ASSERT(inLayer < Layers::NUM_LAYERS);
-        return _objectToBroadPhase[inLayer];
+        JPH_ASSERT(inLayer < _layers->GetNumObjectLayers());
+        return _layers->GetBroadPhaseLayer(inLayer);
     }
 
     const char *GetBroadPhaseLayerName(JPH::BroadPhaseLayer inLayer) const override
     {
-        switch ((JPH::BroadPhaseLayer::Type) inLayer)
-        {
-        case (JPH::BroadPhaseLayer::Type) BroadPhaseLayers::NON_MOVING: return "NON_MOVING";
-        case (JPH::BroadPhaseLayer::Type) BroadPhaseLayers::MOVING: return "MOVING";
-        default: JPH_ASSERT(false); return "INVALID";
-        }
+        return _layers->GetBroadPhaseLayerName(inLayer);
     }
 
   private:
-    std::array<JPH::BroadPhaseLayer, Layers::NUM_LAYERS> _objectToBroadPhase;
+    std::shared_ptr<const CollisionLayers> _layers;
 };
-;
 } // namespace ES::Plugin::Physics::Utils
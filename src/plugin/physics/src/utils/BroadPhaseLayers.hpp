@@ -10,6 +10,7 @@
 #include <Jolt/Physics/Collision/ObjectLayer.h>
 
 namespace ES::Plugin::Physics::Utils {
+/// @brief The broadphase layers of CollisionLayers::Default(). Configured layers are added after these.
 namespace BroadPhaseLayers {
 static constexpr JPH::BroadPhaseLayer NON_MOVING(0);
 static constexpr JPH::BroadPhaseLayer MOVING(1);
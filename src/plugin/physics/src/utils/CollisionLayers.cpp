@@ -0,0 +1,114 @@
+#include "CollisionLayers.hpp"
+
+#include "BroadPhaseLayers.hpp"
+#include "Layers.hpp"
+#include "Logger.hpp"
+
+#include <fmt/format.h>
+
+namespace ES::Plugin::Physics::Utils {
+CollisionLayers CollisionLayers::Default()
+{
+    CollisionLayers layers;
+    JPH::BroadPhaseLayer nonMovingBP = layers.AddBroadPhaseLayer("NON_MOVING");
+    JPH::BroadPhaseLayer movingBP = layers.AddBroadPhaseLayer("MOVING");
+    JPH::ObjectLayer nonMoving = layers.AddObjectLayer("NON_MOVING", nonMovingBP);
+    JPH::ObjectLayer moving = layers.AddObjectLayer("MOVING", movingBP);
+
+    JPH_ASSERT(nonMovingBP == BroadPhaseLayers::NON_MOVING && movingBP == BroadPhaseLayers::MOVING);
+    JPH_ASSERT(nonMoving == Layers::NON_MOVING && moving == Layers::MOVING);
+
+    layers.SetCollision(moving, moving, true);
+    layers.SetCollision(moving, nonMoving, true);
+    return layers;
+}
+
+JPH::BroadPhaseLayer CollisionLayers::AddBroadPhaseLayer(const std::string &name)
+{
+    if (_broadPhaseLayerNames.size() >= MAX_LAYERS)
+    {
+        ES::Utils::Log::Error(fmt::format("CollisionLayers: can't add broadphase layer {}, the limit of {} layers is "
+                                          "reached.",
+                                          name, MAX_LAYERS));
+        return JPH::cBroadPhaseLayerInvalid;
+    }
+
+    JPH::BroadPhaseLayer layer(static_cast<JPH::BroadPhaseLayer::Type>(_broadPhaseLayerNames.size()));
+    _broadPhaseLayerNames.push_back(name);
+    return layer;
+}
+
+JPH::ObjectLayer CollisionLayers::AddObjectLayer(const std::string &name, JPH::BroadPhaseLayer broadPhaseLayer)
+{
+    if (_objectLayerNames.size() >= MAX_LAYERS)
+    {
+        ES::Utils::Log::Error(fmt::format("CollisionLayers: can't add object layer {}, the limit of {} layers is "
+                                          "reached.",
+                                          name, MAX_LAYERS));
+        return JPH::cObjectLayerInvalid;
+    }
+    if (static_cast<JPH::BroadPhaseLayer::Type>(broadPhaseLayer) >= _broadPhaseLayerNames.size())
+    {
+        ES::Utils::Log::Error(
+            fmt::format("CollisionLayers: can't add object layer {}, its broadphase layer does not exist.", name));
+        return JPH::cObjectLayerInvalid;
+    }
+
+    auto layer = static_cast<JPH::ObjectLayer>(_objectLayerNames.size());
+    _objectLayerNames.push_back(name);
+    _objectToBroadPhase.push_back(broadPhaseLayer);
+    _collisionMasks.push_back(0);
+    _broadPhaseMasks.push_back(0);
+    return layer;
+}
+
+void CollisionLayers::SetCollision(JPH::ObjectLayer layer1, JPH::ObjectLayer layer2, bool collide)
+{
+    if (layer1 >= _collisionMasks.size() || layer2 >= _collisionMasks.size())
+    {
+        ES::Utils::Log::Error(fmt::format("CollisionLayers: can't set collision between layers {} and {}, at least "
+                                          "one of them does not exist.",
+                                          layer1, layer2));
+        return;
+    }
+
+    if (collide)
+    {
+        _collisionMasks[layer1] |= uint64_t(1) << layer2;
+        _collisionMasks[layer2] |= uint64_t(1) << layer1;
+    }
+    else
+    {
+        _collisionMasks[layer1] &= ~(uint64_t(1) << layer2);
+        _collisionMasks[layer2] &= ~(uint64_t(1) << layer1);
+    }
+    UpdateBroadPhaseMasks();
+}
+
+const char *CollisionLayers::GetObjectLayerName(JPH::ObjectLayer layer) const
+{
+    return layer < _objectLayerNames.size() ? _objectLayerNames[layer].c_str() : "INVALID";
+}
+
+const char *CollisionLayers::GetBroadPhaseLayerName(JPH::BroadPhaseLayer layer) const
+{
+    auto index = static_cast<JPH::BroadPhaseLayer::Type>(layer);
+    return index < _broadPhaseLayerNames.size() ? _broadPhaseLayerNames[index].c_str() : "INVALID";
+}
+
+void CollisionLayers::UpdateBroadPhaseMasks()
+{
+    for (std::size_t layer = 0; layer < _collisionMasks.size(); layer++)
+    {
+        uint64_t mask = 0;
+        for (std::size_t other = 0; other < _collisionMasks.size(); other++)
+        {
+            if ((_collisionMasks[layer] >> other) & 1u)
+            {
+                mask |= uint64_t(1) << static_cast<JPH::BroadPhaseLayer::Type>(_objectToBroadPhase[other]);
+            }
+        }
+        _broadPhaseMasks[layer] = mask;
+    }
+}
+} // namespace ES::Plugin::Physics::Utils
@@ -0,0 +1,123 @@
+#pragma once
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
+#include <Jolt/Physics/Collision/ObjectLayer.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief Data-driven description of the collision layers of the physics world.
+ *
+ * Every object layer is mapped to a broadphase layer, and a symmetric NxN matrix tells which object layers
+ * collide with each other. The object layer vs broadphase layer table is derived from it: a broadphase layer is
+ * only visited for an object layer if at least one object layer it holds collides with it. Pairs that can never
+ * collide are therefore rejected by the broadphase and never reach the narrowphase.
+ *
+ * @note The layers are read once, when the PhysicsManager is created. Edit them through the PhysicsConfig resource.
+ * @see PhysicsConfig
+ *
+ * @example "Adding a debris layer"
+ * @code
+ * auto &layers = core.GetResource<ES::Plugin::Physics::Resource::PhysicsConfig>().collisionLayers;
+ * auto debris = layers.AddObjectLayer("DEBRIS", layers.AddBroadPhaseLayer("DEBRIS"));
+ * layers.SetCollision(debris, ES::Plugin::Physics::Utils::Layers::NON_MOVING, true);
+ * @endcode
+ */
+class CollisionLayers {
+  public:
+    /// @brief Maximum number of object layers, and of broadphase layers.
+    inline static constexpr uint32_t MAX_LAYERS = 64;
+
+    CollisionLayers() = default;
+    ~CollisionLayers() = default;
+
+    /**
+     * @brief Get the layers used when none are configured: NON_MOVING and MOVING, each in its own broadphase layer.
+     * Moving bodies collide with everything, non moving bodies only collide with moving ones.
+     *
+     * @return CollisionLayers
+     * @see Layers, BroadPhaseLayers
+     */
+    static CollisionLayers Default();
+
+    /**
+     * @brief Add a broadphase layer.
+     *
+     * @param name Name of the layer, used for debugging.
+     * @return The new broadphase layer, or JPH::cBroadPhaseLayerInvalid if there are already MAX_LAYERS of them.
+     */
+    JPH::BroadPhaseLayer AddBroadPhaseLayer(const std::string &name);
+
+    /**
+     * @brief Add an object layer. It does not collide with any layer until SetCollision is called.
+     *
+     * @param name Name of the layer, used for debugging.
+     * @param broadPhaseLayer The broadphase layer holding the bodies of this layer.
+     * @return The new object layer, or JPH::cObjectLayerInvalid if there are already MAX_LAYERS of them or if the
+     * broadphase layer does not exist.
+     */
+    JPH::ObjectLayer AddObjectLayer(const std::string &name, JPH::BroadPhaseLayer broadPhaseLayer);
+
+    /**
+     * @brief Set whether two object layers collide. The matrix is symmetric, so the order does not matter.
+     *
+     * @param layer1 The first object layer.
+     * @param layer2 The second object layer, may be the same as the first one.
+     * @param collide Whether the layers collide.
+     */
+    void SetCollision(JPH::ObjectLayer layer1, JPH::ObjectLayer layer2, bool collide);
+
+    /**
+     * @brief Check if two object layers collide.
+     */
+    inline bool ShouldCollide(JPH::ObjectLayer layer1, JPH::ObjectLayer layer2) const
+    {
+        JPH_ASSERT(layer1 < _collisionMasks.size() && layer2 < _collisionMasks.size());
+        return (_collisionMasks[layer1] >> layer2) & 1u;
+    }
+
+    /**
+     * @brief Check if an object layer can collide with any object layer of a broadphase layer.
+     */
+    inline bool ShouldCollide(JPH::ObjectLayer layer, JPH::BroadPhaseLayer broadPhaseLayer) const
+    {
+        JPH_ASSERT(layer < _broadPhaseMasks.size());
+        return (_broadPhaseMasks[layer] >> static_cast<JPH::BroadPhaseLayer::Type>(broadPhaseLayer)) & 1u;
+    }
+
+    /**
+     * @brief Get the broadphase layer of an object layer.
+     */
+    inline JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer layer) const
+    {
+        JPH_ASSERT(layer < _objectToBroadPhase.size());
+        return _objectToBroadPhase[layer];
+    }
+
+    inline uint32_t GetNumObjectLayers() const { return static_cast<uint32_t>(_objectLayerNames.size()); }
+    inline uint32_t GetNumBroadPhaseLayers() const { return static_cast<uint32_t>(_broadPhaseLayerNames.size()); }
+
+    const char *GetObjectLayerName(JPH::ObjectLayer layer) const;
+    const char *GetBroadPhaseLayerName(JPH::BroadPhaseLayer layer) const;
+
+  private:
+    /**
+     * @brief Rebuild the object layer vs broadphase layer table from the collision matrix.
+     */
+    void UpdateBroadPhaseMasks();
+
+    /// @brief For every object layer, a bit per object layer it collides with.
+    std::vector<uint64_t> _collisionMasks;
+    /// @brief For every object layer, a bit per broadphase layer holding an object layer it collides with.
+    std::vector<uint64_t> _broadPhaseMasks;
+    std::vector<JPH::BroadPhaseLayer> _objectToBroadPhase;
+    std::vector<std::string> _objectLayerNames;
+    std::vector<std::string> _broadPhaseLayerNames;
+};
+} // namespace ES::Plugin::Physics::Utils
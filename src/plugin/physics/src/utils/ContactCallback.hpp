@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ContactEvent.hpp"
 #include "Core.hpp"
 #include "Entity.hpp"
 #include "FunctionContainer.hpp"
@@ -13,6 +14,8 @@ namespace ES::Plugin::Physics::Utils {
  * @tparam Components The components to check for in the entities involved in the contact.
  *
  * @note Callbacks will be called with the Core, as well as the two entities that collided.
+ * Callbacks can also take the contact event as a fourth parameter, to get contact points and impulse.
+ * @note Callbacks are called on the main thread, after the physics step.
  * @note The callback will be called once for each contact added.
  * @note The callback will be called only if the entities have the specified components.
  * @note If no components are specified, the callback will be called for all contacts.
@@ -20,36 +23,48 @@ namespace ES::Plugin::Physics::Utils {
  * @note If two components are specified, the callback will be called only if one entity has the first component
  * and the other entity has the second component.
  */
-using BaseCallback =
-    ES::Utils::FunctionContainer::BaseFunction<void, ES::Engine::Core &, ES::Engine::Entity &, ES::Engine::Entity &>;
+using BaseCallback = ES::Utils::FunctionContainer::BaseFunction<void, ES::Engine::Core &, ES::Engine::Entity &,
+                                                                ES::Engine::Entity &, const ContactEvent &>;
 template <typename... Components> class ContactCallback : public BaseCallback {
   public:
     using CallbackFunc = std::function<void(ES::Engine::Core &, ES::Engine::Entity &, ES::Engine::Entity &)>;
+    using CallbackWithEventFunc = std::function<void(ES::Engine::Core &, ES::Engine::Entity &, ES::Engine::Entity &,
+                                                     const ContactEvent &)>;
 
-    explicit ContactCallback(CallbackFunc cb) : _callback(std::move(cb)) {}
+    explicit ContactCallback(CallbackFunc cb) : _id(cb.target_type().hash_code())
+    {
+        _callback = [fn = std::move(cb)](ES::Engine::Core &core, ES::Engine::Entity &a, ES::Engine::Entity &b,
+                                         const ContactEvent &) { fn(core, a, b); };
+    }
+
+    explicit ContactCallback(CallbackWithEventFunc cb)
+        : _callback(std::move(cb)), _id(_callback.target_type().hash_code())
+    {
+    }
 
-    void operator()(ES::Engine::Core &core, ES::Engine::Entity &a, ES::Engine::Entity &b) const final
+    void operator()(ES::Engine::Core &core, ES::Engine::Entity &a, ES::Engine::Entity &b,
+                    const ContactEvent &event) const final
     {
         static_assert(sizeof...(Components) <= 2, "ContactCallback can only have up to 2 components.");
 
         if constexpr (sizeof...(Components) == 0)
         {
-            _callback(core, a, b);
+            _callback(core, a, b, event);
         }
         else if constexpr (sizeof...(Components) == 1)
         {
             if (hasAllComponents<Components...>(core, a) && hasAllComponents<Components...>(core, b))
             {
-                _callback(core, a, b);
+                _callback(core, a, b, event);
             }
         }
         else if constexpr (sizeof...(Components) == 2)
         {
-            callIfComponentMatch<Components...>(core, a, b);
+            callIfComponentMatch<Components...>(core, a, b, event);
         }
     }
 
-    ES::Utils::FunctionContainer::FunctionID GetID() const final { return _callback.target_type().hash_code(); }
+    ES::Utils::FunctionContainer::FunctionID GetID() const final { return _id; }
 
   private:
     template <typename... Cs>
@@ -59,18 +74,20 @@ template <typename... Components> class ContactCallback : public BaseCallback {
     }
 
     template <typename C1, typename C2>
-    void callIfComponentMatch(ES::Engine::Core &core, ES::Engine::Entity &a, ES::Engine::Entity &b) const
+    void callIfComponentMatch(ES::Engine::Core &core, ES::Engine::Entity &a, ES::Engine::Entity &b,
+                              const ContactEvent &event) const
     {
         if ((a.HasComponents<C1>(core) && b.HasComponents<C2>(core)))
         {
-            _callback(core, a, b);
+            _callback(core, a, b, event);
         }
         else if ((a.HasComponents<C2>(core) && b.HasComponents<C1>(core)))
         {
-            _callback(core, b, a);
+            _callback(core, b, a, event.Swapped());
         }
     }
 
-    CallbackFunc _callback; ///< The callback function to call.
+    CallbackWithEventFunc _callback;              ///< The callback function to call.
+    ES::Utils::FunctionContainer::FunctionID _id; ///< The ID of the user callback.
 };
 } // namespace ES::Plugin::Physics::Utils
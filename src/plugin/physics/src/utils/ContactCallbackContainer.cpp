@@ -0,0 +1,73 @@
+#include "ContactCallbackContainer.hpp"
+
+#include <algorithm>
+
+namespace ES::Plugin::Physics::Utils {
+ES::Utils::FunctionContainer::FunctionID ContactCallbackContainer::AddCallback(std::unique_ptr<BaseCallback> &&callback,
+                                                                               ContactFilter filter)
+{
+    bool exists = _callbacks.Contains(callback->GetID());
+    auto id = _callbacks.AddFunction(std::move(callback));
+
+    if (!exists)
+    {
+        _filters[id] = filter;
+        RebuildBuckets();
+    }
+    return id;
+}
+
+bool ContactCallbackContainer::RemoveCallback(ES::Utils::FunctionContainer::FunctionID id)
+{
+    if (_callbacks.DeleteFunction(id) == nullptr)
+    {
+        return false;
+    }
+    _filters.erase(id);
+    RebuildBuckets();
+    return true;
+}
+
+bool ContactCallbackContainer::CanMatch(uint32_t mask1, uint32_t mask2) const
+{
+    return std::ranges::any_of(_buckets, [mask1, mask2](const Bucket &bucket) {
+        return bucket.filter.Matches(mask1, mask2);
+    });
+}
+
+void ContactCallbackContainer::Call(ES::Engine::Core &core, const ContactEvent &event) const
+{
+    for (const auto &bucket : _buckets)
+    {
+        if (!bucket.filter.Matches(event.componentMask1, event.componentMask2))
+        {
+            continue;
+        }
+
+        for (const auto *callback : bucket.callbacks)
+        {
+            ES::Engine::Entity entity1 = event.entity1;
+            ES::Engine::Entity entity2 = event.entity2;
+            callback->Call(core, entity1, entity2, event);
+        }
+    }
+}
+
+void ContactCallbackContainer::RebuildBuckets()
+{
+    _buckets.clear();
+
+    for (const auto &callback : _callbacks.GetFunctions())
+    {
+        const ContactFilter &filter = _filters.at(callback->GetID());
+        auto bucket = std::ranges::find_if(_buckets, [&filter](const Bucket &b) { return b.filter == filter; });
+
+        if (bucket == _buckets.end())
+        {
+            _buckets.push_back(Bucket{filter, {}});
+            bucket = std::prev(_buckets.end());
+        }
+        bucket->callbacks.push_back(callback.get());
+    }
+}
+} // namespace ES::Plugin::Physics::Utils
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "ContactCallback.hpp"
+#include "ContactEvent.hpp"
+#include "ContactRouter.hpp"
+#include "Core.hpp"
+#include "FunctionContainer.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief Container of contact callbacks, bucketed by their component filter.
+ *
+ * Callbacks sharing the same filter are grouped in a single bucket, so a contact event only checks each filter
+ * once, against the component masks of its bodies, and only reaches the callbacks that can match it.
+ */
+class ContactCallbackContainer {
+  public:
+    ContactCallbackContainer() = default;
+    ~ContactCallbackContainer() = default;
+
+    /**
+     * @brief Add a callback to the container.
+     *
+     * @param callback The callback to add.
+     * @param filter The component filter of the callback.
+     * @return The ID of the callback.
+     */
+    ES::Utils::FunctionContainer::FunctionID AddCallback(std::unique_ptr<BaseCallback> &&callback,
+                                                         ContactFilter filter);
+
+    /**
+     * @brief Remove a callback from the container.
+     *
+     * @param id The ID of the callback to remove.
+     * @return true if the callback was removed, false otherwise.
+     */
+    bool RemoveCallback(ES::Utils::FunctionContainer::FunctionID id);
+
+    /**
+     * @brief Returns true if the container is empty.
+     */
+    inline bool IsEmpty() const { return _callbacks.IsEmpty(); }
+
+    /**
+     * @brief Check if at least one callback can match a body pair.
+     *
+     * @param mask1 Component mask of the first body.
+     * @param mask2 Component mask of the second body.
+     * @return true if a callback can match the pair
+     * @note Safe to call from Jolt's worker threads, as long as no callback is added or removed meanwhile.
+     */
+    bool CanMatch(uint32_t mask1, uint32_t mask2) const;
+
+    /**
+     * @brief Call every callback that can match the bodies of a contact event.
+     *
+     * @param core The core, given to the callbacks.
+     * @param event The contact event.
+     */
+    void Call(ES::Engine::Core &core, const ContactEvent &event) const;
+
+  private:
+    using CallbackContainer =
+        ES::Utils::FunctionContainer::FunctionContainer<void, ES::Engine::Core &, ES::Engine::Entity &,
+                                                        ES::Engine::Entity &, const ContactEvent &>;
+
+    /// @brief Callbacks sharing the same filter, in registration order.
+    struct Bucket {
+        ContactFilter filter;
+        std::vector<const BaseCallback *> callbacks;
+    };
+
+    void RebuildBuckets();
+
+    CallbackContainer _callbacks; ///< Owns the callbacks, in registration order.
+    std::unordered_map<ES::Utils::FunctionContainer::FunctionID, ContactFilter> _filters;
+    std::vector<Bucket> _buckets;
+};
+} // namespace ES::Plugin::Physics::Utils
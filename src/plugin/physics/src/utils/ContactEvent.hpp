@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Entity.hpp"
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/Body/BodyID.h>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief A contact event recorded during a physics step.
+ *
+ * Contact events are recorded by the contact listener while Jolt is stepping the world (possibly from
+ * worker threads) and dispatched later, on the main thread, once the step is over.
+ *
+ * @note Contact data (points, normal, depth, impulse) is only filled for Added and Persisted events:
+ * Jolt does not provide a manifold when a contact is removed.
+ */
+struct ContactEvent {
+    /// @brief The kind of contact event.
+    enum class Type : uint8_t {
+        Added,
+        Persisted,
+        Removed
+    };
+
+    /// @brief The kind of contact event.
+    Type type = Type::Added;
+
+    /// @brief Id of the first body involved in the contact.
+    JPH::BodyID body1;
+
+    /// @brief Id of the second body involved in the contact.
+    JPH::BodyID body2;
+
+    /// @brief Entity owning the first body.
+    /// @note For Removed events, this is resolved on the main thread when the event is dispatched.
+    ES::Engine::Entity entity1;
+
+    /// @brief Entity owning the second body.
+    /// @note For Removed events, this is resolved on the main thread when the event is dispatched.
+    ES::Engine::Entity entity2;
+
+    /// @brief Component mask of the first body, used to route the event to the callbacks that can match it.
+    /// @see ContactRouter
+    uint32_t componentMask1 = 0;
+
+    /// @brief Component mask of the second body, used to route the event to the callbacks that can match it.
+    /// @see ContactRouter
+    uint32_t componentMask2 = 0;
+
+    /// @brief Average world space contact point on the first body.
+    glm::vec3 contactPointOn1 = glm::vec3(0.0f);
+
+    /// @brief Average world space contact point on the second body.
+    glm::vec3 contactPointOn2 = glm::vec3(0.0f);
+
+    /// @brief World space contact normal, pointing from the first body to the second body.
+    glm::vec3 normal = glm::vec3(0.0f);
+
+    /// @brief Penetration depth of the contact.
+    float penetrationDepth = 0.0f;
+
+    /// @brief Estimated impulse of the contact along the normal.
+    /// @note Jolt does not expose solver impulses to contact listeners, so this is estimated from the approach
+    /// velocity of the bodies along the normal and their reduced mass. It is 0 if the bodies are separating.
+    float impulse = 0.0f;
+
+    /// @brief Number of sub shape contacts that were merged into this event.
+    /// @note Only greater than 1 when persisted contacts are coalesced.
+    uint32_t contactCount = 1;
+
+    /**
+     * @brief Get the same event seen from the second body.
+     *
+     * @return ContactEvent with bodies, entities, masks and contact points swapped, and the normal reversed.
+     */
+    inline ContactEvent Swapped() const
+    {
+        ContactEvent swapped = *this;
+        swapped.body1 = body2;
+        swapped.body2 = body1;
+        swapped.entity1 = entity2;
+        swapped.entity2 = entity1;
+        swapped.componentMask1 = componentMask2;
+        swapped.componentMask2 = componentMask1;
+        swapped.contactPointOn1 = contactPointOn2;
+        swapped.contactPointOn2 = contactPointOn1;
+        swapped.normal = -normal;
+        return swapped;
+    }
+};
+} // namespace ES::Plugin::Physics::Utils
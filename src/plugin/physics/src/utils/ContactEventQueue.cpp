@@ -0,0 +1,135 @@
+#include "ContactEventQueue.hpp"
+
+#include <algorithm>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+
+namespace ES::Plugin::Physics::Utils {
+/// @brief Source of unique queue ids, so a thread never mistakes a new queue for a destroyed one.
+static std::atomic<uint64_t> nextQueueId = 1;
+
+/// @brief Ids of the queues that are not destroyed yet.
+static std::mutex liveQueuesMutex;
+static std::unordered_set<uint64_t> liveQueues;
+
+/// @brief Buffers claimed by the calling thread, as (queue id, buffer index) pairs.
+/// @note A thread usually pushes into a single queue, so a linear search is enough.
+static thread_local std::vector<std::pair<uint64_t, std::size_t>> claimedBuffers;
+
+static inline auto SortKey(const ContactEvent &event)
+{
+    return std::make_tuple(event.type, event.body1.GetIndexAndSequenceNumber(),
+                           event.body2.GetIndexAndSequenceNumber());
+}
+
+ContactEventQueue::ContactEventQueue() : _id(nextQueueId.fetch_add(1, std::memory_order_relaxed))
+{
+    std::scoped_lock lock(liveQueuesMutex);
+    liveQueues.insert(_id);
+}
+
+ContactEventQueue::~ContactEventQueue()
+{
+    std::scoped_lock lock(liveQueuesMutex);
+    liveQueues.erase(_id);
+}
+
+ContactEventQueue::ThreadBuffer *ContactEventQueue::GetThreadBuffer()
+{
+    for (const auto &[queueId, index] : claimedBuffers)
+    {
+        if (queueId == _id)
+        {
+            return &_buffers[index];
+        }
+    }
+
+    std::size_t index = _claimedBuffers.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MAX_THREAD_BUFFERS)
+    {
+        return nullptr;
+    }
+    // Claims only happen once per thread and queue: forget the buffers of destroyed queues there, so the cache of
+    // a thread never holds more than the live queues
+    {
+        std::scoped_lock lock(liveQueuesMutex);
+        std::erase_if(claimedBuffers, [](const auto &claimed) { return !liveQueues.contains(claimed.first); });
+    }
+    claimedBuffers.emplace_back(_id, index);
+    return &_buffers[index];
+}
+
+void ContactEventQueue::Push(const ContactEvent &event)
+{
+    if (ThreadBuffer *buffer = GetThreadBuffer(); buffer != nullptr)
+    {
+        buffer->events.push_back(event);
+        return;
+    }
+
+    std::scoped_lock lock(_overflowMutex);
+    _overflow.push_back(event);
+}
+
+bool ContactEventQueue::IsEmpty() const
+{
+    std::size_t claimed = std::min(_claimedBuffers.load(std::memory_order_acquire), MAX_THREAD_BUFFERS);
+    for (std::size_t i = 0; i < claimed; i++)
+    {
+        if (!_buffers[i].events.empty())
+        {
+            return false;
+        }
+    }
+    return _overflow.empty();
+}
+
+void ContactEventQueue::Flush(std::vector<ContactEvent> &out, bool coalescePersisted)
+{
+    out.clear();
+
+    std::size_t claimed = std::min(_claimedBuffers.load(std::memory_order_acquire), MAX_THREAD_BUFFERS);
+    for (std::size_t i = 0; i < claimed; i++)
+    {
+        auto &events = _buffers[i].events;
+        out.insert(out.end(), events.begin(), events.end());
+        events.clear();
+    }
+    out.insert(out.end(), _overflow.begin(), _overflow.end());
+    _overflow.clear();
+
+    std::sort(out.begin(), out.end(),
+              [](const ContactEvent &a, const ContactEvent &b) { return SortKey(a) < SortKey(b); });
+
+    if (!coalescePersisted || out.empty())
+    {
+        return;
+    }
+
+    // Events are sorted, so persisted events of the same body pair are next to each other
+    std::size_t last = 0;
+    for (std::size_t i = 1; i < out.size(); i++)
+    {
+        ContactEvent &merged = out[last];
+        const ContactEvent &current = out[i];
+
+        if (current.type == ContactEvent::Type::Persisted && merged.type == ContactEvent::Type::Persisted &&
+            current.body1 == merged.body1 && current.body2 == merged.body2)
+        {
+            merged.impulse += current.impulse;
+            merged.contactCount += current.contactCount;
+            if (current.penetrationDepth > merged.penetrationDepth)
+            {
+                merged.contactPointOn1 = current.contactPointOn1;
+                merged.contactPointOn2 = current.contactPointOn2;
+                merged.normal = current.normal;
+                merged.penetrationDepth = current.penetrationDepth;
+            }
+            continue;
+        }
+        out[++last] = current;
+    }
+    out.resize(last + 1);
+}
+} // namespace ES::Plugin::Physics::Utils
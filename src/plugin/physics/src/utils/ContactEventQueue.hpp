@@ -0,0 +1,85 @@
+#pragma once
+
+#include "ContactEvent.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief A multi producer, single consumer queue of contact events.
+ *
+ * Every thread pushing events gets its own buffer the first time it pushes, so pushing from Jolt's worker
+ * threads never takes a lock nor contends with other threads. Buffers are merged back on the main thread
+ * with Flush, once the physics step is over.
+ *
+ * @note Buffers keep their capacity between flushes, so no allocation happens once the queue is warmed up.
+ * @note If more than MAX_THREAD_BUFFERS threads push events, the extra threads share a mutex-protected buffer.
+ */
+class ContactEventQueue {
+  public:
+    /// @brief Maximum number of threads that get their own lock-free buffer.
+    inline static constexpr std::size_t MAX_THREAD_BUFFERS = 64;
+
+    ContactEventQueue();
+    ~ContactEventQueue();
+
+    ContactEventQueue(const ContactEventQueue &) = delete;
+    ContactEventQueue &operator=(const ContactEventQueue &) = delete;
+
+    /**
+     * @brief Push an event into the buffer of the calling thread.
+     *
+     * @param event The event to push.
+     * @note Thread-safe. Must not be called concurrently with Flush.
+     */
+    void Push(const ContactEvent &event);
+
+    /**
+     * @brief Move every pushed event into the output vector and clear the buffers.
+     *
+     * Events are sorted by type (added, persisted, removed) and then by body pair, so the dispatch order
+     * doesn't depend on which worker thread recorded which event.
+     *
+     * @param out The vector to fill. It is cleared first.
+     * @param coalescePersisted Whether to merge persisted events of the same body pair into a single event.
+     * Jolt reports one persisted contact per sub shape pair, so compound shapes produce duplicates.
+     * @note Must be called from a single thread, while no other thread is pushing.
+     */
+    void Flush(std::vector<ContactEvent> &out, bool coalescePersisted = true);
+
+    /**
+     * @brief Check if no event was pushed since the last flush.
+     *
+     * @return true if the queue is empty
+     * @note Must not be called concurrently with Push.
+     */
+    bool IsEmpty() const;
+
+  private:
+    /// @brief A buffer owned by a single thread, aligned to avoid false sharing between threads.
+    struct alignas(64) ThreadBuffer {
+        std::vector<ContactEvent> events;
+    };
+
+    /**
+     * @brief Get the buffer of the calling thread, claiming one if this thread never pushed in this queue.
+     *
+     * @return The buffer of the calling thread, or nullptr if every buffer is already claimed.
+     */
+    ThreadBuffer *GetThreadBuffer();
+
+    /// @brief Unique id of this queue, used to tell apart queues in the thread-local buffer cache.
+    uint64_t _id;
+
+    std::array<ThreadBuffer, MAX_THREAD_BUFFERS> _buffers;
+    std::atomic<std::size_t> _claimedBuffers = 0;
+
+    std::mutex _overflowMutex;
+    std::vector<ContactEvent> _overflow;
+};
+} // namespace ES::Plugin::Physics::Utils
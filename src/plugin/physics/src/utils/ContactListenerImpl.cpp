@@ -2,6 +2,7 @@
 
 #include "PhysicsManager.hpp"
 
+#include <Jolt/Physics/Body/BodyLock.h>
 #include <bit>
 #include <entt/entity/entity.hpp>
 
@@ -24,43 +25,103 @@ static constexpr inline const uint32_t ENTITY_ID_MASK =
             std::popcount(entt::entt_traits<ES::Engine::Entity::entity_id_type>::entity_mask)) |
     entt::entt_traits<ES::Engine::Entity::entity_id_type>::version_mask;
 
-void ES::Plugin::Physics::Utils::ContactListenerImpl::OnContactAdded(const JPH::Body &inBody1, const JPH::Body &inBody2,
-                                                                     const JPH::ContactManifold &,
-                                                                     JPH::ContactSettings &)
+template <typename TVec> static inline glm::vec3 ToGlmVec3(const TVec &v)
+{
+    return glm::vec3(static_cast<float>(v.GetX()), static_cast<float>(v.GetY()), static_cast<float>(v.GetZ()));
+}
+
+static inline float GetRigidBodyInverseMass(const JPH::Body &body)
 {
-    if (_onContactAddedCallbacks.IsEmpty())
+    if (!body.IsRigidBody() || !body.IsDynamic())
     {
-        return;
+        return 0.0f;
     }
+    return body.GetMotionProperties()->GetInverseMass();
+}
+
+ES::Plugin::Physics::Utils::ContactEvent
+ES::Plugin::Physics::Utils::ContactListenerImpl::MakeContactEvent(ContactEvent::Type type, const JPH::Body &inBody1,
+                                                                  const JPH::Body &inBody2,
+                                                                  const JPH::ContactManifold &inManifold)
+{
+    ContactEvent event;
+    event.type = type;
+    event.body1 = inBody1.GetID();
+    event.body2 = inBody2.GetID();
 
     // Right now we use 32 bits for entities IDs with EnTT but Jolt stores user data as 64 bits
     // so we have to mask the upper 32 bits
-    auto entity1 = static_cast<ES::Engine::Entity>(inBody1.GetUserData() & ENTITY_ID_MASK);
-    auto entity2 = static_cast<ES::Engine::Entity>(inBody2.GetUserData() & ENTITY_ID_MASK);
+    event.entity1 = static_cast<ES::Engine::Entity>(inBody1.GetUserData() & ENTITY_ID_MASK);
+    event.entity2 = static_cast<ES::Engine::Entity>(inBody2.GetUserData() & ENTITY_ID_MASK);
+    event.componentMask1 = ContactRouter::GetMask(inBody1.GetUserData());
+    event.componentMask2 = ContactRouter::GetMask(inBody2.GetUserData());
+
+    event.normal = ToGlmVec3(inManifold.mWorldSpaceNormal);
+    event.penetrationDepth = inManifold.mPenetrationDepth;
+
+    JPH::uint numPoints = static_cast<JPH::uint>(inManifold.mRelativeContactPointsOn1.size());
+    if (numPoints == 0)
+    {
+        return event;
+    }
+
+    JPH::RVec3 pointOn1 = JPH::RVec3::sZero();
+    JPH::RVec3 pointOn2 = JPH::RVec3::sZero();
+    for (JPH::uint i = 0; i < numPoints; i++)
+    {
+        pointOn1 += inManifold.GetWorldSpaceContactPointOn1(i);
+        pointOn2 += inManifold.GetWorldSpaceContactPointOn2(i);
+    }
+    pointOn1 /= static_cast<JPH::Real>(numPoints);
+    pointOn2 /= static_cast<JPH::Real>(numPoints);
+
+    event.contactPointOn1 = ToGlmVec3(pointOn1);
+    event.contactPointOn2 = ToGlmVec3(pointOn2);
+
+    // The normal points from body 1 to body 2, so a negative relative velocity along it means they are approaching
+    JPH::Vec3 relativeVelocity = inBody2.GetPointVelocity(pointOn2) - inBody1.GetPointVelocity(pointOn1);
+    float approachSpeed = -relativeVelocity.Dot(inManifold.mWorldSpaceNormal);
+    float inverseMassSum = GetRigidBodyInverseMass(inBody1) + GetRigidBodyInverseMass(inBody2);
 
-    for (auto &callback : _onContactAddedCallbacks.GetFunctions())
+    if (approachSpeed > 0.0f && inverseMassSum > 0.0f)
     {
-        callback->Call(_core, entity1, entity2);
+        event.impulse = approachSpeed / inverseMassSum;
     }
+
+    return event;
 }
 
-void ES::Plugin::Physics::Utils::ContactListenerImpl::OnContactPersisted(const JPH::Body &inBody1,
-                                                                         const JPH::Body &inBody2,
-                                                                         const JPH::ContactManifold &,
-                                                                         JPH::ContactSettings &)
+void ES::Plugin::Physics::Utils::ContactListenerImpl::OnContactAdded(const JPH::Body &inBody1, const JPH::Body &inBody2,
+                                                                     const JPH::ContactManifold &inManifold,
+                                                                     JPH::ContactSettings &)
 {
-    if (_onContactPersistedCallbacks.IsEmpty())
+    _contactCount.Add();
+
+    // Only record contacts that at least one callback can match
+    if (!_onContactAddedCallbacks.CanMatch(ContactRouter::GetMask(inBody1.GetUserData()),
+                                           ContactRouter::GetMask(inBody2.GetUserData())))
     {
         return;
     }
 
-    auto entity1 = static_cast<ES::Engine::Entity>(inBody1.GetUserData() & ENTITY_ID_MASK);
-    auto entity2 = static_cast<ES::Engine::Entity>(inBody2.GetUserData() & ENTITY_ID_MASK);
+    _eventQueue.Push(MakeContactEvent(ContactEvent::Type::Added, inBody1, inBody2, inManifold));
+}
+
+void ES::Plugin::Physics::Utils::ContactListenerImpl::OnContactPersisted(const JPH::Body &inBody1,
+                                                                         const JPH::Body &inBody2,
+                                                                         const JPH::ContactManifold &inManifold,
+                                                                         JPH::ContactSettings &)
+{
+    _contactCount.Add();
 
-    for (auto &callback : _onContactPersistedCallbacks.GetFunctions())
+    // Only record contacts that at least one callback can match
+    if (!_onContactPersistedCallbacks.CanMatch(ContactRouter::GetMask(inBody1.GetUserData()),
+                                               ContactRouter::GetMask(inBody2.GetUserData())))
     {
-        callback->Call(_core, entity1, entity2);
+        return;
     }
+
+    _eventQueue.Push(MakeContactEvent(ContactEvent::Type::Persisted, inBody1, inBody2, inManifold));
 }
 
 void ES::Plugin::Physics::Utils::ContactListenerImpl::OnContactRemoved(const JPH::SubShapeIDPair &inSubShapePair)
@@ -70,22 +131,66 @@ void ES::Plugin::Physics::Utils::ContactListenerImpl::OnContactRemoved(const JPH
         return;
     }
 
+    // Bodies can't be accessed here, entities will be resolved from the body IDs when the event is dispatched
+    ContactEvent event;
+    event.type = ContactEvent::Type::Removed;
+    event.body1 = inSubShapePair.GetBody1ID();
+    event.body2 = inSubShapePair.GetBody2ID();
+    _eventQueue.Push(event);
+}
+
+/**
+ * Get the user data of a body, locking it only for the time of the read.
+ * Both bodies of a contact may share the same lock, so they must not be locked at the same time.
+ */
+static bool TryGetBodyUserData(const JPH::BodyLockInterface &lockInterface, const JPH::BodyID &bodyID,
+                               uint64_t &userData)
+{
+    JPH::BodyLockRead lock(lockInterface, bodyID);
+    if (!lock.Succeeded())
+    {
+        return false;
+    }
+    userData = lock.GetBody().GetUserData();
+    return true;
+}
+
+bool ES::Plugin::Physics::Utils::ContactListenerImpl::ResolveRemovedContactEntities(ContactEvent &event)
+{
     auto &physicsManager = _core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>();
-    auto &bodyInterface = physicsManager.GetPhysicsSystem().GetBodyLockInterface();
+    const auto &lockInterface = physicsManager.GetPhysicsSystem().GetBodyLockInterface();
 
-    JPH::Body *body1 = bodyInterface.TryGetBody(inSubShapePair.GetBody1ID());
-    JPH::Body *body2 = bodyInterface.TryGetBody(inSubShapePair.GetBody2ID());
-    if (body1 == nullptr || body2 == nullptr)
+    uint64_t userData1 = 0;
+    uint64_t userData2 = 0;
+    if (!TryGetBodyUserData(lockInterface, event.body1, userData1) ||
+        !TryGetBodyUserData(lockInterface, event.body2, userData2))
     {
         ES::Utils::Log::Error("ContactListenerImpl: OnContactRemoved: body1 or body2 is nullptr, skipping callbacks.");
-        return;
+        return false;
     }
 
-    auto entity1 = static_cast<ES::Engine::Entity>(body1->GetUserData() & ENTITY_ID_MASK);
-    auto entity2 = static_cast<ES::Engine::Entity>(body2->GetUserData() & ENTITY_ID_MASK);
+    event.entity1 = static_cast<ES::Engine::Entity>(userData1 & ENTITY_ID_MASK);
+    event.entity2 = static_cast<ES::Engine::Entity>(userData2 & ENTITY_ID_MASK);
+    event.componentMask1 = ContactRouter::GetMask(userData1);
+    event.componentMask2 = ContactRouter::GetMask(userData2);
+    return true;
+}
+
+void ES::Plugin::Physics::Utils::ContactListenerImpl::DispatchContactEvents()
+{
+    _eventQueue.Flush(_dispatchedEvents, _coalescePersistedContacts);
+
+    std::erase_if(_dispatchedEvents, [this](ContactEvent &event) {
+        return event.type == ContactEvent::Type::Removed && !ResolveRemovedContactEntities(event);
+    });
 
-    for (auto &callback : _onContactRemovedCallbacks.GetFunctions())
+    for (const auto &event : _dispatchedEvents)
     {
-        callback->Call(_core, entity1, entity2);
+        switch (event.type)
+        {
+        case ContactEvent::Type::Added: _onContactAddedCallbacks.Call(_core, event); break;
+        case ContactEvent::Type::Persisted: _onContactPersistedCallbacks.Call(_core, event); break;
+        case ContactEvent::Type::Removed: _onContactRemovedCallbacks.Call(_core, event); break;
+        }
     }
 }
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "ContactCallback.hpp"
+#include "ContactCallbackContainer.hpp"
+#include "ContactEvent.hpp"
+#include "ContactEventQueue.hpp"
+#include "ContactRouter.hpp"
 #include "Core.hpp"
 #include "Entity.hpp"
 #include "FunctionContainer.hpp"
+#include "ShardedCounter.hpp"
 
 // clang-format off
 #include <Jolt/Jolt.h>
@@ -11,6 +16,7 @@
 
 #include <Jolt/Physics/Body/Body.h>
 #include <Jolt/Physics/Collision/ContactListener.h>
+#include <vector>
 
 namespace ES::Plugin::Physics::Resource {
 class PhysicsManager;
@@ -20,11 +26,13 @@ namespace ES::Plugin::Physics::Utils {
 // ContactListener implementation
 // This is used to define callbacks for contact events between bodies.
 // Callbacks will be called with the Core, as well as the two entities that collided.
+// Jolt calls the listener from its worker threads during the physics step, so contact events are only recorded
+// there. Callbacks are called later, on the main thread, when DispatchContactEvents is called.
 class ContactListenerImpl final : public JPH::ContactListener {
   public:
     ContactListenerImpl() = delete;
 
-    explicit ContactListenerImpl(ES::Engine::Core &core) : _core(core) {}
+    explicit ContactListenerImpl(ES::Engine::Core &core) : _core(core), _router(core) {}
     ~ContactListenerImpl() override = default;
 
     JPH::ValidateResult OnContactValidate([[maybe_unused]] const JPH::Body &inBody1,
@@ -43,21 +51,66 @@ class ContactListenerImpl final : public JPH::ContactListener {
 
     void OnContactRemoved(const JPH::SubShapeIDPair &inSubShapePair) override;
 
+    /**
+     * @brief Call the callbacks of every contact event recorded during the last physics step.
+     * @note Must be called on the main thread, after the physics step.
+     */
+    void DispatchContactEvents();
+
+    /**
+     * @brief Get the contact events dispatched by the last call to DispatchContactEvents.
+     * @return The dispatched contact events, sorted by type then by body pair.
+     * @note Events of every type are recorded only if at least one callback of that type is registered.
+     */
+    inline const std::vector<ContactEvent> &GetContactEvents() const { return _dispatchedEvents; }
+
+    /**
+     * @brief Get the number of contacts added or persisted since the last call, whether callbacks listen to them
+     * or not.
+     * @return The number of contact manifolds reported by Jolt.
+     */
+    inline uint64_t ExchangeContactCount() { return _contactCount.Exchange(); }
+
+    /**
+     * @brief Set whether persisted contacts of the same body pair should be merged into a single event.
+     * @param coalesce Whether to merge persisted contacts.
+     * @note Jolt reports one persisted contact per sub shape pair, enabled by default.
+     */
+    inline void SetCoalescePersistedContacts(bool coalesce) { _coalescePersistedContacts = coalesce; }
+
+    /**
+     * @brief Get whether persisted contacts of the same body pair are merged into a single event.
+     * @return true if persisted contacts are merged
+     */
+    inline bool GetCoalescePersistedContacts() const { return _coalescePersistedContacts; }
+
+    /**
+     * @brief Build the Jolt user data of a body, holding its entity and its component mask.
+     * @param entity The entity owning the body.
+     * @return The user data to give to the body.
+     * @see ContactRouter
+     */
+    inline uint64_t MakeBodyUserData(entt::entity entity) const { return _router.MakeUserData(entity); }
+
     /**
      * @brief Add a callback for when a contact between two entities is added.
      * @param callback The callback to add.
+     * @tparam Components The components the callback filters on, contacts between bodies that can't match them
+     * won't reach the callback.
      * @note The callback will be called with the Core, as well as the two entities that collided.
      * @note The callback will be called once for each contact added.
      */
     template <typename... Components>
     inline ES::Utils::FunctionContainer::FunctionID AddOnContactAddedCallback(std::unique_ptr<BaseCallback> &&callback)
     {
-        return _onContactAddedCallbacks.AddFunction(std::move(callback));
+        return _onContactAddedCallbacks.AddCallback(std::move(callback), _router.MakeFilter<Components...>());
     }
 
     /**
      * @brief Add a callback for when a contact between two entities persist.
      * @param callback The callback to add.
+     * @tparam Components The components the callback filters on, contacts between bodies that can't match them
+     * won't reach the callback.
      * @note The callback will be called with the Core, as well as the two entities that collided.
      * @note The callback won't be called for the first collision.
      * @note The callback will be called every frame until the contact is removed.
@@ -66,12 +119,14 @@ class ContactListenerImpl final : public JPH::ContactListener {
     inline ES::Utils::FunctionContainer::FunctionID
     AddOnContactPersistedCallback(std::unique_ptr<BaseCallback> &&callback)
     {
-        return _onContactPersistedCallbacks.AddFunction(std::move(callback));
+        return _onContactPersistedCallbacks.AddCallback(std::move(callback), _router.MakeFilter<Components...>());
     }
 
     /**
      * @brief Add a callback for when a contact between two entities is removed.
      * @param callback The callback to add.
+     * @tparam Components The components the callback filters on, contacts between bodies that can't match them
+     * won't reach the callback.
      * @note The callback will be called with the Core, as well as the two entities that collided.
      * @note The callback will be called once for each contact removed.
      */
@@ -79,7 +134,7 @@ class ContactListenerImpl final : public JPH::ContactListener {
     inline ES::Utils::FunctionContainer::FunctionID
     AddOnContactRemovedCallback(std::unique_ptr<BaseCallback> &&callback)
     {
-        return _onContactRemovedCallbacks.AddFunction(std::move(callback));
+        return _onContactRemovedCallbacks.AddCallback(std::move(callback), _router.MakeFilter<Components...>());
     }
 
     /**
@@ -89,7 +144,7 @@ class ContactListenerImpl final : public JPH::ContactListener {
      */
     inline bool RemoveOnContactAddedCallback(ES::Utils::FunctionContainer::FunctionID id)
     {
-        return _onContactAddedCallbacks.DeleteFunction(id) != nullptr;
+        return _onContactAddedCallbacks.RemoveCallback(id);
     }
 
     /**
@@ -99,7 +154,7 @@ class ContactListenerImpl final : public JPH::ContactListener {
      */
     inline bool RemoveOnContactPersistedCallback(ES::Utils::FunctionContainer::FunctionID id)
     {
-        return _onContactPersistedCallbacks.DeleteFunction(id) != nullptr;
+        return _onContactPersistedCallbacks.RemoveCallback(id);
     }
 
     /**
@@ -109,17 +164,33 @@ class ContactListenerImpl final : public JPH::ContactListener {
      */
     inline bool RemoveOnContactRemovedCallback(ES::Utils::FunctionContainer::FunctionID id)
     {
-        return _onContactRemovedCallbacks.DeleteFunction(id) != nullptr;
+        return _onContactRemovedCallbacks.RemoveCallback(id);
     }
 
   private:
-    using CallbackContainer =
-        ES::Utils::FunctionContainer::FunctionContainer<void, ES::Engine::Core &, ES::Engine::Entity &,
-                                                        ES::Engine::Entity &>;
+    /**
+     * @brief Build a contact event from the data Jolt gives when a contact is added or persisted.
+     * @note Called from Jolt's worker threads, so it must only read the bodies and the manifold.
+     */
+    static ContactEvent MakeContactEvent(ContactEvent::Type type, const JPH::Body &inBody1, const JPH::Body &inBody2,
+                                         const JPH::ContactManifold &inManifold);
+
+    /**
+     * @brief Find the entities and component masks of the bodies of a removed contact.
+     * @return false if one of the bodies doesn't exist anymore.
+     */
+    bool ResolveRemovedContactEntities(ContactEvent &event);
+
     ES::Engine::Core &_core;
+    ContactRouter _router; ///< Keeps the component masks of the bodies up to date.
+
+    ContactEventQueue _eventQueue;               ///< Events recorded during the physics step.
+    std::vector<ContactEvent> _dispatchedEvents; ///< Events dispatched after the last physics step.
+    bool _coalescePersistedContacts = true;      ///< Whether to merge persisted contacts of a same body pair.
+    ShardedCounter _contactCount;                ///< Contacts added or persisted since the last exchange.
 
-    CallbackContainer _onContactAddedCallbacks;     ///< Callbacks for when a contact is added.
-    CallbackContainer _onContactPersistedCallbacks; ///< Callbacks for when a contact is persisted.
-    CallbackContainer _onContactRemovedCallbacks;   ///< Callbacks for when a contact is removed.
+    ContactCallbackContainer _onContactAddedCallbacks;     ///< Callbacks for when a contact is added.
+    ContactCallbackContainer _onContactPersistedCallbacks; ///< Callbacks for when a contact is persisted.
+    ContactCallbackContainer _onContactRemovedCallbacks;   ///< Callbacks for when a contact is removed.
 };
 } // namespace ES::Plugin::Physics::Utils
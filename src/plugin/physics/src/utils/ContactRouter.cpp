@@ -0,0 +1,47 @@
+#include "ContactRouter.hpp"
+
+#include "PhysicsManager.hpp"
+#include "RigidBody3D.hpp"
+#include "SoftBody3D.hpp"
+
+uint32_t ES::Plugin::Physics::Utils::ContactRouter::ComputeMask(entt::entity entity) const
+{
+    const auto &registry = _core.GetRegistry();
+    uint32_t mask = 0;
+
+    for (std::size_t i = 0; i < _hasComponent.size(); i++)
+    {
+        if (_hasComponent[i](registry, entity))
+        {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+void ES::Plugin::Physics::Utils::ContactRouter::UpdateBodyMask(entt::entity entity, uint32_t clearedBits)
+{
+    auto &registry = _core.GetRegistry();
+    auto *rigidBody = registry.try_get<ES::Plugin::Physics::Component::RigidBody3D>(entity);
+    auto *softBody = registry.try_get<ES::Plugin::Physics::Component::SoftBody3D>(entity);
+
+    bool hasRigidBody = rigidBody != nullptr && rigidBody->body != nullptr;
+    bool hasSoftBody = softBody != nullptr && softBody->body != nullptr;
+    if (!hasRigidBody && !hasSoftBody)
+    {
+        return;
+    }
+
+    auto &bodyInterface =
+        _core.GetResource<ES::Plugin::Physics::Resource::PhysicsManager>().GetPhysicsSystem().GetBodyInterface();
+    uint64_t userData = PackUserData(entity, ComputeMask(entity) & ~clearedBits);
+
+    if (hasRigidBody)
+    {
+        bodyInterface.SetUserData(rigidBody->body->GetID(), userData);
+    }
+    if (hasSoftBody)
+    {
+        bodyInterface.SetUserData(softBody->body->GetID(), userData);
+    }
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Logger.hpp"
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/Body/Body.h>
+#include <array>
+#include <cstdint>
+#include <entt/entt.hpp>
+#include <fmt/format.h>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief Component requirements of a contact callback, as component bits of a ContactRouter.
+ *
+ * @note A filter matches a body pair if one body has every bit of "first" and the other every bit of "second".
+ * @note An empty filter matches every body pair.
+ */
+struct ContactFilter {
+    uint32_t first = 0;
+    uint32_t second = 0;
+
+    /**
+     * @brief Check if a body pair can match this filter.
+     *
+     * @param mask1 Component mask of the first body.
+     * @param mask2 Component mask of the second body.
+     * @return true if the pair matches, in any order
+     */
+    inline bool Matches(uint32_t mask1, uint32_t mask2) const
+    {
+        return ((mask1 & first) == first && (mask2 & second) == second) ||
+               ((mask1 & second) == second && (mask2 & first) == first);
+    }
+
+    bool operator==(const ContactFilter &rhs) const = default;
+};
+
+/**
+ * @brief Keeps, for every body, a mask of the components contact callbacks filter on.
+ *
+ * Every component type used by a contact callback gets a bit. The mask of a body is stored in the upper 32 bits
+ * of its Jolt user data (the lower 32 bits hold the entity), so it can be read from Jolt's worker threads during
+ * the physics step without touching the registry. Masks are kept up to date when those components are added to or
+ * removed from an entity.
+ *
+ * @note Only MAX_COMPONENTS component types can be tracked. Callbacks using more component types are not
+ * pre-filtered, they still check the components of the entities themselves.
+ */
+class ContactRouter {
+  public:
+    /// @brief Maximum number of component types that can be tracked.
+    inline static constexpr uint32_t MAX_COMPONENTS = 32;
+
+    explicit ContactRouter(ES::Engine::Core &core) : _core(core) {}
+    /// @brief Disconnect from the registry signals.
+    ~ContactRouter() = default;
+
+    ContactRouter(const ContactRouter &) = delete;
+    ContactRouter &operator=(const ContactRouter &) = delete;
+
+    /**
+     * @brief Build the filter of a contact callback, tracking its component types if they are not already.
+     *
+     * @tparam Components The components the callback filters on, as in ContactCallback.
+     * @return The filter of the callback.
+     */
+    template <typename... Components> ContactFilter MakeFilter()
+    {
+        static_assert(sizeof...(Components) <= 2, "ContactCallback can only have up to 2 components.");
+
+        std::array<uint32_t, sizeof...(Components)> bits{TrackComponent<Components>()...};
+
+        if constexpr (sizeof...(Components) == 0)
+        {
+            return ContactFilter{};
+        }
+        else
+        {
+            for (uint32_t bit : bits)
+            {
+                if (bit == 0)
+                {
+                    return ContactFilter{};
+                }
+            }
+            return ContactFilter{bits.front(), bits.back()};
+        }
+    }
+
+    /**
+     * @brief Compute the component mask of an entity, from the components it currently has.
+     *
+     * @param entity The entity.
+     * @return The component mask.
+     */
+    uint32_t ComputeMask(entt::entity entity) const;
+
+    /**
+     * @brief Build the Jolt user data of a body.
+     *
+     * @param entity The entity owning the body.
+     * @return The user data, holding the entity and its component mask.
+     */
+    inline uint64_t MakeUserData(entt::entity entity) const { return PackUserData(entity, ComputeMask(entity)); }
+
+    /**
+     * @brief Pack an entity and its component mask into a Jolt user data.
+     */
+    inline static uint64_t PackUserData(entt::entity entity, uint32_t mask)
+    {
+        return (static_cast<uint64_t>(mask) << 32) | static_cast<uint64_t>(entt::to_integral(entity));
+    }
+
+    /**
+     * @brief Get the component mask stored in the user data of a body.
+     */
+    inline static uint32_t GetMask(uint64_t userData) { return static_cast<uint32_t>(userData >> 32); }
+
+    /**
+     * @brief Get the entity stored in the user data of a body.
+     */
+    inline static entt::entity GetEntity(uint64_t userData)
+    {
+        return static_cast<entt::entity>(static_cast<uint32_t>(userData));
+    }
+
+  private:
+    /**
+     * @brief Get the bit of a component type, tracking it if it is not already.
+     *
+     * @return The bit of the component, or 0 if every bit is already used.
+     */
+    template <typename TComponent> uint32_t TrackComponent()
+    {
+        auto type = std::type_index(typeid(TComponent));
+        if (auto it = _bits.find(type); it != _bits.end())
+        {
+            return it->second;
+        }
+
+        if (_hasComponent.size() >= MAX_COMPONENTS)
+        {
+            ES::Utils::Log::Warn(fmt::format("ContactRouter: can't track component {}, contact callbacks using it "
+                                             "won't be pre-filtered.",
+                                             typeid(TComponent).name()));
+            _bits[type] = 0;
+            return 0;
+        }
+
+        uint32_t bit = 1u << _hasComponent.size();
+        _bits[type] = bit;
+        _hasComponent.push_back(+[](const entt::registry &registry, entt::entity entity) {
+            return registry.all_of<TComponent>(entity);
+        });
+
+        auto &registry = _core.GetRegistry();
+        _connections.emplace_back(
+            registry.on_construct<TComponent>().template connect<&ContactRouter::OnComponentConstruct>(*this));
+        _connections.emplace_back(
+            registry.on_destroy<TComponent>().template connect<&ContactRouter::OnComponentDestroy<TComponent>>(*this));
+
+        // Entities may already have the component, so their bodies have to be updated
+        for (auto entity : registry.view<TComponent>())
+        {
+            UpdateBodyMask(entity, 0);
+        }
+        return bit;
+    }
+
+    void OnComponentConstruct(entt::registry &, entt::entity entity) { UpdateBodyMask(entity, 0); }
+
+    template <typename TComponent> void OnComponentDestroy(entt::registry &, entt::entity entity)
+    {
+        // The component is still attached when on_destroy is emitted, so its bit has to be cleared explicitly
+        UpdateBodyMask(entity, _bits.at(std::type_index(typeid(TComponent))));
+    }
+
+    /**
+     * @brief Update the user data of the bodies of an entity, if it has any.
+     *
+     * @param entity The entity.
+     * @param clearedBits Bits to clear from the computed mask.
+     */
+    void UpdateBodyMask(entt::entity entity, uint32_t clearedBits);
+
+    ES::Engine::Core &_core;
+    std::unordered_map<std::type_index, uint32_t> _bits;
+    std::vector<bool (*)(const entt::registry &, entt::entity)> _hasComponent;
+    /// @brief Connections to the registry signals, released with the router so they never call a destroyed one.
+    std::vector<entt::scoped_connection> _connections;
+};
+} // namespace ES::Plugin::Physics::Utils
@@ -0,0 +1,21 @@
+#pragma once
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief Shape settings wrapping an already built shape, so it can be given to a RigidBody3D.
+ * Creating the shape does no work, which is what a cooked shape is for.
+ * @see CookedShapeCache
+ */
+class CookedShapeSettings final : public JPH::ShapeSettings {
+  public:
+    explicit CookedShapeSettings(const JPH::ShapeRefC &shape) { mCachedResult.Set(shape); }
+
+    JPH::ShapeSettings::ShapeResult Create() const override { return mCachedResult; }
+};
+} // namespace ES::Plugin::Physics::Utils
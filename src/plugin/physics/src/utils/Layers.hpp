@@ -7,6 +7,7 @@
 #include <Jolt/Physics/Collision/ObjectLayer.h>
 
 namespace ES::Plugin::Physics::Utils {
+/// @brief The object layers of CollisionLayers::Default(). Configured layers are added after these.
 namespace Layers {
 static constexpr JPH::ObjectLayer NON_MOVING = 0;
 static constexpr JPH::ObjectLayer MOVING = 1;
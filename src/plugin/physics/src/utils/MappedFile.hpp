@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief A file mapped read only into memory, unmapped when the object is destroyed.
+ */
+class MappedFile {
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /**
+     * @brief Map a file, unmapping the previous one if any.
+     *
+     * @param path Path of the file.
+     * @return false if the file could not be opened or mapped, or is empty.
+     */
+    bool Open(const std::string &path);
+
+    /**
+     * @brief Unmap the file.
+     */
+    void Close();
+
+    inline bool IsOpen() const { return _data != nullptr; }
+
+    inline std::span<const std::byte> GetData() const { return {_data, _size}; }
+
+  private:
+    const std::byte *_data = nullptr;
+    std::size_t _size = 0;
+#ifdef _WIN32
+    void *_file = nullptr;
+    void *_mapping = nullptr;
+#endif
+};
+} // namespace ES::Plugin::Physics::Utils
@@ -0,0 +1,19 @@
+#include "MeshHash.hpp"
+
+namespace ES::Plugin::Physics::Utils {
+uint64_t HashMesh(const ES::Plugin::Object::Component::Mesh &mesh)
+{
+    uint64_t hash = 0;
+    HashCombine(hash, static_cast<uint64_t>(mesh.vertices.size()));
+    for (const glm::vec3 &vertex : mesh.vertices)
+    {
+        HashCombine(hash, vertex);
+    }
+    HashCombine(hash, static_cast<uint64_t>(mesh.indices.size()));
+    for (uint32_t index : mesh.indices)
+    {
+        HashCombine(hash, static_cast<uint64_t>(index));
+    }
+    return hash;
+}
+} // namespace ES::Plugin::Physics::Utils
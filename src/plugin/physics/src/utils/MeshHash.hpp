@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Mesh.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief Mix a value into a hash.
+ */
+inline void HashCombine(uint64_t &seed, uint64_t value)
+{
+    // splitmix64 finalizer, so that close values spread over the whole hash
+    value += 0x9e3779b97f4a7c15ull;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    seed ^= value ^ (value >> 31);
+    seed = std::rotl(seed, 27) * 5 + 0x52dce729;
+}
+
+inline void HashCombine(uint64_t &seed, float value)
+{
+    HashCombine(seed, static_cast<uint64_t>(std::bit_cast<uint32_t>(value)));
+}
+
+inline void HashCombine(uint64_t &seed, const glm::vec3 &value)
+{
+    HashCombine(seed, value.x);
+    HashCombine(seed, value.y);
+    HashCombine(seed, value.z);
+}
+
+/**
+ * @brief Hash the geometry of a mesh, its vertex positions and indices.
+ * Normals and texture coordinates are ignored, as they don't change the physics of the mesh.
+ *
+ * @param mesh The mesh.
+ * @return A 64 bits hash, equal for meshes with the same geometry.
+ */
+uint64_t HashMesh(const ES::Plugin::Object::Component::Mesh &mesh);
+} // namespace ES::Plugin::Physics::Utils
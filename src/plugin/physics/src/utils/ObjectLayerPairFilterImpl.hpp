@@ -1,6 +1,9 @@
 #pragma once
 
-#include "Layers.hpp"
+#include "CollisionLayers.hpp"
+#include "ShardedCounter.hpp"
+
+#include <memory>
 
 // clang-format off
 #include <Jolt/Jolt.h>
@@ -11,14 +14,33 @@
 namespace ES::Plugin::Physics::Utils {
 class ObjectLayerPairFilterImpl : public JPH::ObjectLayerPairFilter {
   public:
+    explicit ObjectLayerPairFilterImpl(std::shared_ptr<const CollisionLayers> layers) : _layers(std::move(layers)) {}
+
     bool ShouldCollide(JPH::ObjectLayer inObject1, JPH::ObjectLayer inObject2) const override
     {
-        switch (inObject1)
+        bool collide = _layers->ShouldCollide(inObject1, inObject2);
+        if (collide && _countPairs)
         {
-        case Layers::NON_MOVING: return inObject2 == Layers::MOVING;
-        case Layers::MOVING: return true;
-        default: JPH_ASSERT(false); return false;
+            _pairCount.Add();
         }
+        return collide;
     }
+
+    /**
+     * @brief Start or stop counting the accepted object pairs.
+     * @note Must not be called while a physics step or a query is running: it is meant to be enabled right before
+     * a step and disabled right after it, so that only the candidate pairs of the broadphase are counted.
+     */
+    inline void SetCountingPairs(bool countPairs) { _countPairs = countPairs; }
+
+    /**
+     * @brief Get the number of accepted object pairs counted since the last call.
+     */
+    inline uint64_t ExchangePairCount() { return _pairCount.Exchange(); }
+
+  private:
+    std::shared_ptr<const CollisionLayers> _layers;
+    bool _countPairs = false;
+    mutable ShardedCounter _pairCount;
 };
 } // namespace ES::Plugin::Physics::Utils
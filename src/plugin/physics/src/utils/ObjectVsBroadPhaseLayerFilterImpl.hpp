@@ -1,19 +1,23 @@
 #pragma once
 
-#include "BroadPhaseLayers.hpp"
-#include "Layers.hpp"
+#include "CollisionLayers.hpp"
+
+#include <memory>
 
 namespace ES::Plugin::Physics::Utils {
 class ObjectVsBroadPhaseLayerFilterImpl : public JPH::ObjectVsBroadPhaseLayerFilter {
   public:
+    explicit ObjectVsBroadPhaseLayerFilterImpl(std::shared_ptr<const CollisionLayers> layers)
+        : _layers(std::move(layers))
+    {
+    }
+
     bool ShouldCollide(JPH::ObjectLayer inLayer1, JPH::BroadPhaseLayer inLayer2) const override
     {
-        switch (inLayer1)
-        {
-        case Layers::NON_MOVING: return inLayer2 == BroadPhaseLayers::MOVING;
-        case Layers::MOVING: return true;
-        default: JPH_ASSERT(false); return false;
-        }
+        return _layers->ShouldCollide(inLayer1, inLayer2);
     }
+
+  private:
+    std::shared_ptr<const CollisionLayers> _layers;
 };
 } // namespace ES::Plugin::Physics::Utils
@@ -0,0 +1,37 @@
+#include "PhysicsSnapshot.hpp"
+
+#include <cstring>
+
+namespace ES::Plugin::Physics::Utils {
+void PhysicsSnapshot::WriteBytes(const void *inData, size_t inNumBytes)
+{
+    const auto *bytes = static_cast<const std::byte *>(inData);
+    _data.insert(_data.end(), bytes, bytes + inNumBytes);
+}
+
+void PhysicsSnapshot::ReadBytes(void *outData, size_t inNumBytes)
+{
+    if (_readPosition + inNumBytes > _data.size())
+    {
+        _failed = true;
+        std::memset(outData, 0, inNumBytes);
+        return;
+    }
+    std::memcpy(outData, _data.data() + _readPosition, inNumBytes);
+    _readPosition += inNumBytes;
+}
+
+void PhysicsSnapshot::Clear()
+{
+    _data.clear();
+    transforms.clear();
+    _readPosition = 0;
+    _failed = false;
+}
+
+void PhysicsSnapshot::Rewind()
+{
+    _readPosition = 0;
+    _failed = false;
+}
+} // namespace ES::Plugin::Physics::Utils
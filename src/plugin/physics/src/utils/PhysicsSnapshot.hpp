@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Transform.hpp"
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Physics/StateRecorder.h>
+#include <cstddef>
+#include <entt/entt.hpp>
+#include <utility>
+#include <vector>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief A snapshot of the physics world: the state of every body saved by Jolt, and the Transform of every entity.
+ *
+ * The snapshot is a JPH::StateRecorder writing into a plain memory buffer. Clearing it keeps the buffer, so a
+ * snapshot saved every tick does not allocate once it reached its final size.
+ *
+ * @note A snapshot can only be restored in a world holding the same bodies as when it was saved: restoring does
+ * not create nor destroy bodies.
+ * @see PhysicsManager::SaveSnapshot, PhysicsManager::RestoreSnapshot
+ */
+class PhysicsSnapshot final : public JPH::StateRecorder {
+  public:
+    PhysicsSnapshot() = default;
+    ~PhysicsSnapshot() override = default;
+
+    PhysicsSnapshot(const PhysicsSnapshot &) = delete;
+    PhysicsSnapshot &operator=(const PhysicsSnapshot &) = delete;
+
+    void WriteBytes(const void *inData, size_t inNumBytes) override;
+    void ReadBytes(void *outData, size_t inNumBytes) override;
+    bool IsEOF() const override { return _readPosition >= _data.size(); }
+    bool IsFailed() const override { return _failed; }
+
+    /**
+     * @brief Empty the snapshot, keeping its memory to be reused.
+     */
+    void Clear();
+
+    /**
+     * @brief Go back to the start of the snapshot, to read it again.
+     */
+    void Rewind();
+
+    /**
+     * @brief Check if the snapshot holds a saved state.
+     */
+    inline bool IsEmpty() const { return _data.empty(); }
+
+    /**
+     * @brief Get the size in bytes of the saved physics state.
+     */
+    inline std::size_t GetSize() const { return _data.size(); }
+
+    /// @brief Transforms of the entities when the snapshot was saved.
+    std::vector<std::pair<entt::entity, ES::Plugin::Object::Component::Transform>> transforms;
+
+  private:
+    std::vector<std::byte> _data;
+    std::size_t _readPosition = 0;
+    bool _failed = false;
+};
+} // namespace ES::Plugin::Physics::Utils
@@ -0,0 +1,20 @@
+#include "ShardedCounter.hpp"
+
+namespace ES::Plugin::Physics::Utils {
+std::size_t ShardedCounter::GetThreadShard()
+{
+    static std::atomic<std::size_t> nextShard = 0;
+    static thread_local const std::size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+    return shard;
+}
+
+uint64_t ShardedCounter::Exchange()
+{
+    uint64_t total = 0;
+    for (auto &shard : _shards)
+    {
+        total += shard.value.exchange(0, std::memory_order_relaxed);
+    }
+    return total;
+}
+} // namespace ES::Plugin::Physics::Utils
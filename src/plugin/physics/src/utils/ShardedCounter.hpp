@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief A counter incremented from many threads at once, such as Jolt's worker threads during a physics step.
+ *
+ * Threads are spread over several cache line sized shards, so incrementing the counter from the hot path of a
+ * step does not make every worker thread contend on the same cache line.
+ */
+class ShardedCounter {
+  public:
+    /// @brief Number of shards threads are spread over.
+    inline static constexpr std::size_t NUM_SHARDS = 16;
+
+    ShardedCounter() = default;
+    ~ShardedCounter() = default;
+
+    ShardedCounter(const ShardedCounter &) = delete;
+    ShardedCounter &operator=(const ShardedCounter &) = delete;
+
+    /**
+     * @brief Add to the counter.
+     *
+     * @param value The value to add.
+     * @note Thread-safe.
+     */
+    inline void Add(uint64_t value = 1)
+    {
+        _shards[GetThreadShard()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the value of the counter and reset it to 0.
+     *
+     * @return The value of the counter.
+     * @note Values added concurrently may be counted either now or at the next exchange, but never lost.
+     */
+    uint64_t Exchange();
+
+  private:
+    /// @brief A shard of the counter, aligned to avoid false sharing between threads.
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value = 0;
+    };
+
+    /**
+     * @brief Get the shard of the calling thread, assigned the first time it adds to any counter.
+     */
+    static std::size_t GetThreadShard();
+
+    std::array<Shard, NUM_SHARDS> _shards;
+};
+} // namespace ES::Plugin::Physics::Utils
@@ -0,0 +1,54 @@
+#include "SnapshotRing.hpp"
+
+#include <algorithm>
+
+namespace ES::Plugin::Physics::Utils {
+void SnapshotRing::Resize(std::size_t capacity)
+{
+    _snapshots.resize(capacity);
+    for (auto &snapshot : _snapshots)
+    {
+        if (snapshot == nullptr)
+        {
+            snapshot = std::make_unique<PhysicsSnapshot>();
+        }
+    }
+    Clear();
+}
+
+PhysicsSnapshot &SnapshotRing::Push()
+{
+    _newest = (_size == 0) ? 0 : (_newest + 1) % _snapshots.size();
+    _size = std::min(_size + 1, _snapshots.size());
+
+    PhysicsSnapshot &snapshot = *_snapshots[_newest];
+    snapshot.Clear();
+    return snapshot;
+}
+
+PhysicsSnapshot *SnapshotRing::Get(std::size_t age)
+{
+    if (age >= _size)
+    {
+        return nullptr;
+    }
+    return _snapshots[(_newest + _snapshots.size() - age) % _snapshots.size()].get();
+}
+
+void SnapshotRing::DropNewest(std::size_t age)
+{
+    if (age >= _size)
+    {
+        Clear();
+        return;
+    }
+    _newest = (_newest + _snapshots.size() - age) % _snapshots.size();
+    _size -= age;
+}
+
+void SnapshotRing::Clear()
+{
+    _newest = 0;
+    _size = 0;
+}
+} // namespace ES::Plugin::Physics::Utils
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "PhysicsSnapshot.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief A fixed size ring of physics snapshots, the oldest one being overwritten by the next one to save.
+ *
+ * Snapshots are allocated once, when the ring is resized, and their buffers are reused as the ring goes around.
+ */
+class SnapshotRing {
+  public:
+    explicit SnapshotRing(std::size_t capacity = 0) { Resize(capacity); }
+    ~SnapshotRing() = default;
+
+    SnapshotRing(SnapshotRing &&) = default;
+    SnapshotRing &operator=(SnapshotRing &&) = default;
+
+    /**
+     * @brief Change the number of snapshots kept. Every saved snapshot is dropped.
+     *
+     * @param capacity The number of snapshots.
+     */
+    void Resize(std::size_t capacity);
+
+    /**
+     * @brief Get the next snapshot to save into, which becomes the newest one.
+     *
+     * @return The snapshot, cleared. Its memory is the one of the oldest snapshot when the ring is full.
+     * @note The ring must not be empty.
+     */
+    PhysicsSnapshot &Push();
+
+    /**
+     * @brief Get a saved snapshot.
+     *
+     * @param age 0 for the newest snapshot, 1 for the one before, and so on.
+     * @return The snapshot, or nullptr if fewer than age + 1 snapshots are saved.
+     */
+    PhysicsSnapshot *Get(std::size_t age);
+
+    /**
+     * @brief Drop the newest snapshots, so that the snapshot of the given age becomes the newest one.
+     *
+     * @param age Age of the snapshot to keep as the newest one.
+     */
+    void DropNewest(std::size_t age);
+
+    /**
+     * @brief Drop every saved snapshot, keeping their memory.
+     */
+    void Clear();
+
+    inline std::size_t GetCapacity() const { return _snapshots.size(); }
+    inline std::size_t GetSize() const { return _size; }
+
+  private:
+    /// @brief Snapshots are stored behind pointers, as a StateRecorder can't be moved.
+    std::vector<std::unique_ptr<PhysicsSnapshot>> _snapshots;
+    /// @brief Index of the newest snapshot.
+    std::size_t _newest = 0;
+    std::size_t _size = 0;
+};
+} // namespace ES::Plugin::Physics::Utils
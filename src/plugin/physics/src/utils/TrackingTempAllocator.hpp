@@ -0,0 +1,62 @@
+#pragma once
+
+// clang-format off
+#include <Jolt/Jolt.h>
+// clang-format on
+
+#include <Jolt/Core/TempAllocator.h>
+#include <algorithm>
+#include <cstddef>
+
+namespace ES::Plugin::Physics::Utils {
+/**
+ * @brief A preallocated temp allocator that keeps track of its high-water mark, to size it from real scenes.
+ *
+ * Allocations are served by a JPH::TempAllocatorImplWithMallocFallback: from a fixed size arena, and from malloc
+ * once the arena is full.
+ *
+ * @note As every Jolt temp allocator, it is only used by one thread at a time, so the tracking is not atomic.
+ */
+class TrackingTempAllocator final : public JPH::TempAllocator {
+  public:
+    /**
+     * @param size Size in bytes of the preallocated arena.
+     */
+    explicit TrackingTempAllocator(std::size_t size) : _allocator(static_cast<JPH::uint>(size)), _size(size) {}
+
+    void *Allocate(JPH::uint inSize) override
+    {
+        _usage += inSize;
+        _peakUsage = std::max(_peakUsage, _usage);
+        return _allocator.Allocate(inSize);
+    }
+
+    void Free(void *inAddress, JPH::uint inSize) override
+    {
+        _usage -= inSize;
+        _allocator.Free(inAddress, inSize);
+    }
+
+    /**
+     * @brief Get the size of the preallocated arena.
+     */
+    inline std::size_t GetSize() const { return _size; }
+
+    /**
+     * @brief Get the largest number of bytes allocated at once since the last reset.
+     * @note If this is greater than GetSize(), some allocations fell back to malloc.
+     */
+    inline std::size_t GetPeakUsage() const { return _peakUsage; }
+
+    /**
+     * @brief Start tracking a new high-water mark, from what is currently allocated.
+     */
+    inline void ResetPeakUsage() { _peakUsage = _usage; }
+
+  private:
+    JPH::TempAllocatorImplWithMallocFallback _allocator;
+    std::size_t _size;
+    std::size_t _usage = 0;
+    std::size_t _peakUsage = 0;
+};
+} // namespace ES::Plugin::Physics::Utils
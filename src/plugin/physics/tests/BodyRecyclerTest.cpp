@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "JoltPhysics.hpp"
+#include "PhysicsTestUtils.hpp"
+#include "Transform.hpp"
+
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+
+using namespace ES::Plugin::Physics;
+using ES::Plugin::Object::Component::Transform;
+
+static ES::Engine::Entity CreateProjectile(ES::Engine::Core &core, const std::shared_ptr<JPH::ShapeSettings> &shape,
+                                           const glm::vec3 &position)
+{
+    ES::Engine::Entity entity = core.CreateEntity();
+    entity.AddComponent<Transform>(core, position);
+    entity.AddComponent<Component::RigidBody3D>(core, shape, JPH::EMotionType::Dynamic, Utils::Layers::MOVING);
+    return entity;
+}
+
+TEST(BodyRecycler, destroyed_bodies_are_removed_in_batches)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    auto shape = std::make_shared<JPH::SphereShapeSettings>(0.1f);
+    auto &physicsSystem = core.GetResource<Resource::PhysicsManager>().GetPhysicsSystem();
+
+    std::vector<ES::Engine::Entity> projectiles;
+    for (int i = 0; i < 8; i++)
+    {
+        projectiles.push_back(CreateProjectile(core, shape, glm::vec3(static_cast<float>(i), 0.0f, 0.0f)));
+    }
+    ASSERT_EQ(physicsSystem.GetNumBodies(), 8);
+
+    for (auto &projectile : projectiles)
+    {
+        projectile.Destroy(core);
+    }
+    // Bodies stay until the next tick, then are removed, then destroyed the tick after
+    EXPECT_EQ(physicsSystem.GetNumBodies(), 8);
+    System::FlushBodyRemovals(core);
+    EXPECT_EQ(physicsSystem.GetNumBodies(), 8);
+    System::FlushBodyRemovals(core);
+    EXPECT_EQ(physicsSystem.GetNumBodies(), 0);
+}
+
+TEST(BodyRecycler, pooled_bodies_are_reused)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    core.GetResource<Resource::PhysicsConfig>().bodyPoolSize = 4;
+    StartPhysics(core);
+
+    auto shape = std::make_shared<JPH::SphereShapeSettings>(0.1f);
+    auto &recycler = core.GetResource<Resource::PhysicsManager>().GetBodyRecycler();
+
+    ES::Engine::Entity projectile = CreateProjectile(core, shape, glm::vec3(0.0f));
+    JPH::Body *body = projectile.GetComponents<Component::RigidBody3D>(core).body;
+    body->SetLinearVelocity(JPH::Vec3(10.0f, 0.0f, 0.0f));
+
+    projectile.Destroy(core);
+    System::FlushBodyRemovals(core);
+    System::FlushBodyRemovals(core);
+    ASSERT_EQ(recycler.GetPoolSize(), 1);
+
+    // A body of another shape is not taken from the pool
+    ES::Engine::Entity other =
+        CreateProjectile(core, std::make_shared<JPH::SphereShapeSettings>(0.2f), glm::vec3(0.0f));
+    EXPECT_NE(other.GetComponents<Component::RigidBody3D>(core).body, body);
+    EXPECT_EQ(recycler.GetPoolSize(), 1);
+
+    ES::Engine::Entity next = CreateProjectile(core, shape, glm::vec3(5.0f, 0.0f, 0.0f));
+    JPH::Body *nextBody = next.GetComponents<Component::RigidBody3D>(core).body;
+    ASSERT_EQ(nextBody, body);
+    EXPECT_EQ(recycler.GetPoolSize(), 0);
+    EXPECT_TRUE(nextBody->IsInBroadPhase());
+    EXPECT_NEAR(nextBody->GetPosition().GetX(), 5.0f, 1e-5f);
+    EXPECT_EQ(nextBody->GetLinearVelocity(), JPH::Vec3::sZero());
+    EXPECT_EQ(Utils::ContactRouter::GetEntity(nextBody->GetUserData()), static_cast<entt::entity>(next));
+}
+
+TEST(BodyRecycler, shutdown_destroys_every_body)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    core.GetResource<Resource::PhysicsConfig>().bodyPoolSize = 4;
+    StartPhysics(core);
+
+    auto shape = std::make_shared<JPH::SphereShapeSettings>(0.1f);
+    auto &physicsSystem = core.GetResource<Resource::PhysicsManager>().GetPhysicsSystem();
+    auto &recycler = core.GetResource<Resource::PhysicsManager>().GetBodyRecycler();
+
+    CreateProjectile(core, shape, glm::vec3(0.0f)).Destroy(core);
+    System::FlushBodyRemovals(core);
+    System::FlushBodyRemovals(core);
+    CreateProjectile(core, std::make_shared<JPH::SphereShapeSettings>(0.2f), glm::vec3(0.0f)).Destroy(core);
+    System::FlushBodyRemovals(core);
+    CreateProjectile(core, std::make_shared<JPH::SphereShapeSettings>(0.3f), glm::vec3(1.0f)).Destroy(core);
+    ASSERT_EQ(recycler.GetPoolSize(), 1);
+    ASSERT_EQ(physicsSystem.GetNumBodies(), 3);
+
+    // Pooled, removed and queued bodies are all destroyed
+    System::ClearBodyRecycler(core);
+    EXPECT_EQ(physicsSystem.GetNumBodies(), 0);
+    EXPECT_EQ(recycler.GetPoolSize(), 0);
+    EXPECT_EQ(recycler.GetQueuedCount(), 0);
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "BroadPhaseLayers.hpp"
+#include "CollisionLayers.hpp"
+#include "Layers.hpp"
+
+using namespace ES::Plugin::Physics::Utils;
+
+TEST(CollisionLayers, default_layers)
+{
+    CollisionLayers layers = CollisionLayers::Default();
+
+    ASSERT_EQ(layers.GetNumObjectLayers(), 2);
+    ASSERT_EQ(layers.GetNumBroadPhaseLayers(), 2);
+    ASSERT_TRUE(layers.ShouldCollide(Layers::MOVING, Layers::MOVING));
+    ASSERT_TRUE(layers.ShouldCollide(Layers::MOVING, Layers::NON_MOVING));
+    ASSERT_TRUE(layers.ShouldCollide(Layers::NON_MOVING, Layers::MOVING));
+    ASSERT_FALSE(layers.ShouldCollide(Layers::NON_MOVING, Layers::NON_MOVING));
+    ASSERT_TRUE(layers.ShouldCollide(Layers::NON_MOVING, BroadPhaseLayers::MOVING));
+    ASSERT_FALSE(layers.ShouldCollide(Layers::NON_MOVING, BroadPhaseLayers::NON_MOVING));
+    ASSERT_STREQ(layers.GetObjectLayerName(Layers::MOVING), "MOVING");
+}
+
+TEST(CollisionLayers, derived_broadphase_masks)
+{
+    CollisionLayers layers = CollisionLayers::Default();
+    JPH::BroadPhaseLayer debrisBP = layers.AddBroadPhaseLayer("DEBRIS");
+    JPH::ObjectLayer debris = layers.AddObjectLayer("DEBRIS", debrisBP);
+    JPH::ObjectLayer trigger = layers.AddObjectLayer("TRIGGER", BroadPhaseLayers::MOVING);
+
+    layers.SetCollision(debris, Layers::NON_MOVING, true);
+    layers.SetCollision(trigger, Layers::MOVING, true);
+
+    ASSERT_EQ(layers.GetBroadPhaseLayer(debris), debrisBP);
+    ASSERT_FALSE(layers.ShouldCollide(debris, debris));
+    ASSERT_FALSE(layers.ShouldCollide(debris, Layers::MOVING));
+    ASSERT_TRUE(layers.ShouldCollide(debris, BroadPhaseLayers::NON_MOVING));
+    ASSERT_FALSE(layers.ShouldCollide(debris, BroadPhaseLayers::MOVING));
+    ASSERT_FALSE(layers.ShouldCollide(debris, debrisBP));
+    ASSERT_TRUE(layers.ShouldCollide(Layers::NON_MOVING, debrisBP));
+    ASSERT_FALSE(layers.ShouldCollide(trigger, BroadPhaseLayers::NON_MOVING));
+
+    layers.SetCollision(Layers::NON_MOVING, debris, false);
+
+    ASSERT_FALSE(layers.ShouldCollide(debris, BroadPhaseLayers::NON_MOVING));
+    ASSERT_FALSE(layers.ShouldCollide(Layers::NON_MOVING, debrisBP));
+}
+
+TEST(CollisionLayers, invalid_layers)
+{
+    CollisionLayers layers;
+
+    ASSERT_EQ(layers.AddObjectLayer("NO_BROADPHASE", JPH::BroadPhaseLayer(0)), JPH::cObjectLayerInvalid);
+
+    JPH::BroadPhaseLayer bp = layers.AddBroadPhaseLayer("BP");
+    for (uint32_t i = 0; i < CollisionLayers::MAX_LAYERS; i++)
+    {
+        ASSERT_NE(layers.AddObjectLayer("LAYER", bp), JPH::cObjectLayerInvalid);
+    }
+    ASSERT_EQ(layers.AddObjectLayer("TOO_MANY", bp), JPH::cObjectLayerInvalid);
+    ASSERT_EQ(layers.GetNumObjectLayers(), CollisionLayers::MAX_LAYERS);
+
+    layers.SetCollision(0, CollisionLayers::MAX_LAYERS - 1, true);
+    ASSERT_TRUE(layers.ShouldCollide(CollisionLayers::MAX_LAYERS - 1, 0));
+    ASSERT_TRUE(layers.ShouldCollide(0, bp));
+}
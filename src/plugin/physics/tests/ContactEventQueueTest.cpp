@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include "ContactEventQueue.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace ES::Plugin::Physics::Utils;
+
+static ContactEvent MakeEvent(ContactEvent::Type type, JPH::uint32 body1, JPH::uint32 body2, float depth = 0.0f,
+                              float impulse = 0.0f)
+{
+    ContactEvent event;
+    event.type = type;
+    event.body1 = JPH::BodyID(body1);
+    event.body2 = JPH::BodyID(body2);
+    event.penetrationDepth = depth;
+    event.impulse = impulse;
+    return event;
+}
+
+TEST(ContactEventQueue, flush_from_multiple_threads)
+{
+    ContactEventQueue queue;
+    std::vector<std::thread> threads;
+
+    for (JPH::uint32 t = 0; t < 8; t++)
+    {
+        threads.emplace_back([&queue, t]() {
+            for (JPH::uint32 i = 0; i < 100; i++)
+            {
+                queue.Push(MakeEvent(ContactEvent::Type::Added, t, i));
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(queue.IsEmpty());
+
+    std::vector<ContactEvent> events;
+    queue.Flush(events);
+
+    ASSERT_EQ(events.size(), 800);
+    ASSERT_TRUE(queue.IsEmpty());
+
+    for (std::size_t i = 1; i < events.size(); i++)
+    {
+        ASSERT_LT(events[i - 1].body1.GetIndexAndSequenceNumber() * 1000 + events[i - 1].body2.GetIndex(),
+                  events[i].body1.GetIndexAndSequenceNumber() * 1000 + events[i].body2.GetIndex());
+    }
+}
+
+TEST(ContactEventQueue, sorted_by_type)
+{
+    ContactEventQueue queue;
+    queue.Push(MakeEvent(ContactEvent::Type::Removed, 0, 1));
+    queue.Push(MakeEvent(ContactEvent::Type::Persisted, 0, 1));
+    queue.Push(MakeEvent(ContactEvent::Type::Added, 0, 1));
+
+    std::vector<ContactEvent> events;
+    queue.Flush(events);
+
+    ASSERT_EQ(events.size(), 3);
+    ASSERT_EQ(events[0].type, ContactEvent::Type::Added);
+    ASSERT_EQ(events[1].type, ContactEvent::Type::Persisted);
+    ASSERT_EQ(events[2].type, ContactEvent::Type::Removed);
+}
+
+TEST(ContactEventQueue, coalesce_persisted)
+{
+    ContactEventQueue queue;
+    queue.Push(MakeEvent(ContactEvent::Type::Persisted, 0, 1, 0.1f, 1.0f));
+    queue.Push(MakeEvent(ContactEvent::Type::Persisted, 0, 1, 0.3f, 2.0f));
+    queue.Push(MakeEvent(ContactEvent::Type::Persisted, 0, 2, 0.2f, 4.0f));
+    queue.Push(MakeEvent(ContactEvent::Type::Added, 0, 1));
+    queue.Push(MakeEvent(ContactEvent::Type::Added, 0, 1));
+
+    std::vector<ContactEvent> events;
+    queue.Flush(events);
+
+    ASSERT_EQ(events.size(), 4);
+    ASSERT_EQ(events[0].type, ContactEvent::Type::Added);
+    ASSERT_EQ(events[1].type, ContactEvent::Type::Added);
+    ASSERT_EQ(events[2].body2, JPH::BodyID(1));
+    ASSERT_EQ(events[2].contactCount, 2);
+    ASSERT_FLOAT_EQ(events[2].impulse, 3.0f);
+    ASSERT_FLOAT_EQ(events[2].penetrationDepth, 0.3f);
+    ASSERT_EQ(events[3].body2, JPH::BodyID(2));
+    ASSERT_EQ(events[3].contactCount, 1);
+}
+
+TEST(ContactEventQueue, no_coalesce)
+{
+    ContactEventQueue queue;
+    queue.Push(MakeEvent(ContactEvent::Type::Persisted, 0, 1));
+    queue.Push(MakeEvent(ContactEvent::Type::Persisted, 0, 1));
+
+    std::vector<ContactEvent> events;
+    queue.Flush(events, false);
+
+    ASSERT_EQ(events.size(), 2);
+}
+
+TEST(ContactEventQueue, swapped_event)
+{
+    ContactEvent event = MakeEvent(ContactEvent::Type::Added, 3, 4);
+    event.entity1 = ES::Engine::Entity(3);
+    event.entity2 = ES::Engine::Entity(4);
+    event.normal = glm::vec3(0.0f, 1.0f, 0.0f);
+    event.contactPointOn1 = glm::vec3(1.0f);
+
+    ContactEvent swapped = event.Swapped();
+
+    ASSERT_EQ(swapped.body1, JPH::BodyID(4));
+    ASSERT_EQ(swapped.entity1, ES::Engine::Entity(4));
+    ASSERT_EQ(swapped.entity2, ES::Engine::Entity(3));
+    ASSERT_EQ(swapped.normal, glm::vec3(0.0f, -1.0f, 0.0f));
+    ASSERT_EQ(swapped.contactPointOn2, glm::vec3(1.0f));
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "ContactCallbackContainer.hpp"
+#include "ContactRouter.hpp"
+#include "Entity.hpp"
+
+using namespace ES::Plugin::Physics::Utils;
+
+struct Player {};
+struct Bullet {};
+
+TEST(ContactRouting, filter_matches)
+{
+    ContactFilter any;
+    ContactFilter players{0b01, 0b01};
+    ContactFilter playerBullet{0b01, 0b10};
+
+    ASSERT_TRUE(any.Matches(0, 0));
+    ASSERT_TRUE(players.Matches(0b01, 0b11));
+    ASSERT_FALSE(players.Matches(0b01, 0b10));
+    ASSERT_TRUE(playerBullet.Matches(0b01, 0b10));
+    ASSERT_TRUE(playerBullet.Matches(0b10, 0b01));
+    ASSERT_FALSE(playerBullet.Matches(0b01, 0b01));
+}
+
+TEST(ContactRouting, router_masks)
+{
+    ES::Engine::Core core;
+    ContactRouter router(core);
+
+    ContactFilter filter = router.MakeFilter<Player, Bullet>();
+    ASSERT_NE(filter.first, 0);
+    ASSERT_NE(filter.second, 0);
+    ASSERT_NE(filter.first, filter.second);
+    ASSERT_EQ(router.MakeFilter<Player>(), (ContactFilter{filter.first, filter.first}));
+    ASSERT_EQ(router.MakeFilter<>(), ContactFilter{});
+
+    ES::Engine::Entity player = core.CreateEntity();
+    player.AddComponent<Player>(core);
+
+    ASSERT_EQ(router.ComputeMask(player), filter.first);
+
+    uint64_t userData = router.MakeUserData(player);
+    ASSERT_EQ(ContactRouter::GetMask(userData), filter.first);
+    ASSERT_EQ(static_cast<uint32_t>(userData), entt::to_integral(static_cast<entt::entity>(player)));
+}
+
+TEST(ContactRouting, router_disconnects_on_destruction)
+{
+    ES::Engine::Core core;
+    ES::Engine::Entity player = core.CreateEntity();
+    {
+        ContactRouter router(core);
+        router.MakeFilter<Player>();
+    }
+
+    player.AddComponent<Player>(core);
+    core.GetRegistry().remove<Player>(player);
+
+    ASSERT_TRUE(core.GetRegistry().on_construct<Player>().empty());
+    ASSERT_TRUE(core.GetRegistry().on_destroy<Player>().empty());
+}
+
+TEST(ContactRouting, container_routes_by_filter)
+{
+    ES::Engine::Core core;
+    ContactCallbackContainer container;
+    int playerCalls = 0;
+    int playerBulletCalls = 0;
+    int anyCalls = 0;
+
+    container.AddCallback(std::make_unique<ContactCallback<>>(
+                              [&playerCalls](ES::Engine::Core &, ES::Engine::Entity &, ES::Engine::Entity &) {
+                                  playerCalls++;
+                              }),
+                          ContactFilter{0b01, 0b01});
+    auto playerBulletId = container.AddCallback(
+        std::make_unique<ContactCallback<>>(
+            [&playerBulletCalls](ES::Engine::Core &, ES::Engine::Entity &, ES::Engine::Entity &) {
+                playerBulletCalls++;
+            }),
+        ContactFilter{0b01, 0b10});
+    container.AddCallback(std::make_unique<ContactCallback<>>(
+                              [&anyCalls](ES::Engine::Core &, ES::Engine::Entity &, ES::Engine::Entity &) {
+                                  anyCalls++;
+                              }),
+                          ContactFilter{});
+
+    ASSERT_TRUE(container.CanMatch(0, 0));
+
+    ContactEvent event;
+    event.componentMask1 = 0b10;
+    event.componentMask2 = 0b01;
+    container.Call(core, event);
+
+    ASSERT_EQ(playerCalls, 0);
+    ASSERT_EQ(playerBulletCalls, 1);
+    ASSERT_EQ(anyCalls, 1);
+
+    ASSERT_TRUE(container.RemoveCallback(playerBulletId));
+    container.Call(core, event);
+
+    ASSERT_EQ(playerBulletCalls, 1);
+    ASSERT_EQ(anyCalls, 2);
+}
+
+TEST(ContactRouting, container_can_match)
+{
+    ContactCallbackContainer container;
+
+    ASSERT_FALSE(container.CanMatch(0, 0));
+
+    container.AddCallback(std::make_unique<ContactCallback<>>(
+                              [](ES::Engine::Core &, ES::Engine::Entity &, ES::Engine::Entity &) {}),
+                          ContactFilter{0b01, 0b10});
+
+    ASSERT_TRUE(container.CanMatch(0b11, 0b10));
+    ASSERT_FALSE(container.CanMatch(0b01, 0b01));
+    ASSERT_FALSE(container.CanMatch(0, 0));
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include "JoltPhysics.hpp"
+#include "Mesh.hpp"
+#include "PhysicsTestUtils.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace ES::Plugin::Physics;
+using ES::Plugin::Object::Component::Mesh;
+
+static Mesh CreateBoxMesh()
+{
+    Mesh mesh;
+    for (int i = 0; i < 8; i++)
+    {
+        mesh.vertices.emplace_back(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f);
+    }
+    mesh.indices = {0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 1, 4, 1, 5, 4,
+                    2, 6, 3, 3, 6, 7, 0, 4, 2, 2, 4, 6, 1, 3, 5, 3, 7, 5};
+    return mesh;
+}
+
+TEST(CookedShapeCache, shapes_are_restored_from_disk)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "es_cooked_shape_cache_test";
+    std::filesystem::remove_all(directory);
+
+    Mesh mesh = CreateBoxMesh();
+    Resource::CookedShapeCache cooker(directory.string());
+    ASSERT_TRUE(cooker.Cook(mesh, Resource::CookedShapeType::Mesh));
+    ASSERT_TRUE(std::filesystem::exists(cooker.GetFilePath(mesh, Resource::CookedShapeType::Mesh)));
+
+    // A new cache, as in the next run of the game, restores the shape instead of building it
+    Resource::CookedShapeCache cache(directory.string());
+    JPH::ShapeRefC shape = cache.GetShape(mesh, Resource::CookedShapeType::Mesh);
+    ASSERT_NE(shape, nullptr);
+    EXPECT_EQ(shape->GetSubType(), JPH::EShapeSubType::Mesh);
+    EXPECT_TRUE(shape->GetLocalBounds().mMax.IsClose(JPH::Vec3(1.0f, 1.0f, 1.0f)));
+    EXPECT_EQ(cache.GetShape(mesh, Resource::CookedShapeType::Mesh), shape);
+
+    // The same mesh cooked as a convex hull is another shape
+    JPH::ShapeRefC hull = cache.GetShape(mesh, Resource::CookedShapeType::ConvexHull);
+    ASSERT_NE(hull, nullptr);
+    EXPECT_EQ(hull->GetSubType(), JPH::EShapeSubType::ConvexHull);
+    EXPECT_EQ(cache.Size(), 2);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(CookedShapeCache, outdated_files_are_rebuilt)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "es_cooked_shape_cache_outdated";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    Mesh mesh = CreateBoxMesh();
+    Resource::CookedShapeCache cache(directory.string());
+    {
+        std::ofstream file(cache.GetFilePath(mesh, Resource::CookedShapeType::Mesh), std::ios::binary);
+        file << "not a shape";
+    }
+
+    JPH::ShapeRefC shape = cache.GetShape(mesh, Resource::CookedShapeType::Mesh);
+    ASSERT_NE(shape, nullptr);
+    EXPECT_EQ(shape->GetSubType(), JPH::EShapeSubType::Mesh);
+
+    std::filesystem::remove_all(directory);
+}
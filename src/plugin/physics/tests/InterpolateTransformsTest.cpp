@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "FixedTimeUpdate.hpp"
+#include "InterpolateTransforms.hpp"
+#include "Transform.hpp"
+#include "TransformInterpolation.hpp"
+#include "WorldMatrix.hpp"
+
+using namespace ES::Plugin::Physics;
+using ES::Plugin::Object::Component::Transform;
+using ES::Plugin::Object::Component::WorldMatrix;
+
+TEST(InterpolateTransforms, interpolate_between_ticks)
+{
+    ES::Engine::Core core;
+    auto &scheduler = core.GetScheduler<ES::Engine::Scheduler::FixedTimeUpdate>();
+    scheduler.SetTickRate(0.25f);
+    ES::Engine::Entity entity = core.CreateEntity();
+    auto &transform = entity.AddComponent<Transform>(core, glm::vec3(0.0f));
+    auto &worldMatrix = entity.AddComponent<WorldMatrix>(core);
+    auto &interpolation = entity.AddComponent<Component::TransformInterpolation>(core, glm::vec3(0.0f));
+
+    // A physics tick moves the body
+    System::ResetMovedInterpolations(core);
+    transform.position = glm::vec3(1.0f, 0.0f, 0.0f);
+    System::StoreInterpolatedTransforms(core);
+
+    ASSERT_EQ(interpolation.previousPosition, glm::vec3(0.0f));
+    ASSERT_EQ(interpolation.currentPosition, glm::vec3(1.0f, 0.0f, 0.0f));
+
+    // No time was accumulated since the tick, so the pose of the previous tick is rendered
+    System::InterpolateTransforms(core);
+    ASSERT_EQ(glm::vec3(worldMatrix.model[3]), glm::vec3(0.0f));
+    ASSERT_EQ(transform.position, glm::vec3(1.0f, 0.0f, 0.0f));
+    ASSERT_EQ(worldMatrix.source.position, transform.position);
+
+    // Half a tick later, the pose halfway between both ticks is rendered
+    scheduler.Advance(0.125f);
+    System::InterpolateTransforms(core);
+    ASSERT_EQ(glm::vec3(worldMatrix.model[3]), glm::vec3(0.5f, 0.0f, 0.0f));
+    ASSERT_EQ(transform.position, glm::vec3(1.0f, 0.0f, 0.0f));
+
+    // The next tick starts from the simulated pose
+    System::ResetMovedInterpolations(core);
+    ASSERT_EQ(interpolation.previousPosition, glm::vec3(0.0f));
+    ASSERT_EQ(interpolation.currentPosition, glm::vec3(1.0f, 0.0f, 0.0f));
+}
+
+TEST(InterpolateTransforms, gameplay_moves_are_kept)
+{
+    ES::Engine::Core core;
+    ES::Engine::Entity entity = core.CreateEntity();
+    auto &transform = entity.AddComponent<Transform>(core, glm::vec3(0.0f));
+    auto &worldMatrix = entity.AddComponent<WorldMatrix>(core);
+    auto &interpolation = entity.AddComponent<Component::TransformInterpolation>(core, glm::vec3(0.0f));
+
+    transform.position = glm::vec3(1.0f, 0.0f, 0.0f);
+    System::StoreInterpolatedTransforms(core);
+    System::InterpolateTransforms(core);
+
+    // The world matrix is left to UpdateWorldMatrices
+    transform.position = glm::vec3(5.0f);
+    worldMatrix.model = glm::mat4(1.0f);
+    System::InterpolateTransforms(core);
+    ASSERT_EQ(worldMatrix.model, glm::mat4(1.0f));
+    ASSERT_NE(worldMatrix.source.position, transform.position);
+
+    System::ResetMovedInterpolations(core);
+    ASSERT_EQ(transform.position, glm::vec3(5.0f));
+    ASSERT_EQ(interpolation.previousPosition, glm::vec3(5.0f));
+    ASSERT_EQ(interpolation.currentPosition, glm::vec3(5.0f));
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "JoltPhysics.hpp"
+#include "PhysicsTestUtils.hpp"
+#include "Transform.hpp"
+
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+
+using namespace ES::Plugin::Physics;
+using ES::Plugin::Object::Component::Transform;
+
+TEST(PhysicsSnapshot, snapshot_ring)
+{
+    Utils::SnapshotRing ring(3);
+
+    ASSERT_EQ(ring.Get(0), nullptr);
+
+    Utils::PhysicsSnapshot *snapshots[4];
+    for (auto &snapshot : snapshots)
+    {
+        snapshot = &ring.Push();
+    }
+
+    ASSERT_EQ(ring.GetSize(), 3);
+    ASSERT_EQ(ring.Get(0), snapshots[3]);
+    ASSERT_EQ(ring.Get(2), snapshots[1]);
+    ASSERT_EQ(ring.Get(3), nullptr);
+    // The oldest snapshot was reused
+    ASSERT_EQ(snapshots[3], snapshots[0]);
+
+    ring.DropNewest(1);
+    ASSERT_EQ(ring.GetSize(), 2);
+    ASSERT_EQ(ring.Get(0), snapshots[2]);
+    ASSERT_EQ(&ring.Push(), snapshots[3]);
+}
+
+TEST(PhysicsSnapshot, recorder_buffer)
+{
+    Utils::PhysicsSnapshot snapshot;
+    int value = 42;
+    snapshot.WriteBytes(&value, sizeof(value));
+
+    int read = 0;
+    snapshot.ReadBytes(&read, sizeof(read));
+    ASSERT_EQ(read, 42);
+    ASSERT_TRUE(snapshot.IsEOF());
+    ASSERT_FALSE(snapshot.IsFailed());
+
+    snapshot.ReadBytes(&read, sizeof(read));
+    ASSERT_TRUE(snapshot.IsFailed());
+
+    snapshot.Rewind();
+    snapshot.ReadBytes(&read, sizeof(read));
+    ASSERT_EQ(read, 42);
+    ASSERT_FALSE(snapshot.IsFailed());
+}
+
+TEST(PhysicsSnapshot, save_and_restore)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    ES::Engine::Entity box = core.CreateEntity();
+    box.AddComponent<Transform>(core, glm::vec3(0.0f, 10.0f, 0.0f));
+    box.AddComponent<Component::RigidBody3D>(core,
+                                             std::make_shared<JPH::BoxShapeSettings>(JPH::Vec3(0.5f, 0.5f, 0.5f)),
+                                             JPH::EMotionType::Dynamic, Utils::Layers::MOVING);
+
+    auto &physicsManager = core.GetResource<Resource::PhysicsManager>();
+    Utils::PhysicsSnapshot snapshot;
+    physicsManager.SaveSnapshot(core, snapshot);
+    ASSERT_FALSE(snapshot.IsEmpty());
+
+    for (int i = 0; i < 10; i++)
+    {
+        System::PhysicsUpdate(core);
+    }
+    System::SyncTransformsToRigidBodies(core);
+    ASSERT_LT(box.GetComponents<Transform>(core).position.y, 10.0f);
+
+    ASSERT_TRUE(physicsManager.RestoreSnapshot(core, snapshot));
+    ASSERT_FLOAT_EQ(box.GetComponents<Transform>(core).position.y, 10.0f);
+
+    System::SyncTransformsToRigidBodies(core);
+    ASSERT_FLOAT_EQ(box.GetComponents<Transform>(core).position.y, 10.0f);
+}
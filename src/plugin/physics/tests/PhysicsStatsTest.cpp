@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include "Layers.hpp"
+#include "ObjectLayerPairFilterImpl.hpp"
+#include "PhysicsStats.hpp"
+#include "ShardedCounter.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace ES::Plugin::Physics;
+
+TEST(PhysicsStats, record_keeps_peaks)
+{
+    Resource::PhysicsStats stats;
+    Resource::PhysicsStepStats step;
+
+    step.stepTime = 4.0f;
+    step.numContacts = 10;
+    stats.Record(step);
+
+    step.stepTime = 2.0f;
+    step.numContacts = 20;
+    stats.Record(step);
+    stats.RecordDispatch(1.0f, 5);
+
+    ASSERT_EQ(stats.numSteps, 2);
+    ASSERT_FLOAT_EQ(stats.last.stepTime, 2.0f);
+    ASSERT_FLOAT_EQ(stats.peak.stepTime, 4.0f);
+    ASSERT_EQ(stats.peak.numContacts, 20);
+    ASSERT_FLOAT_EQ(stats.peak.dispatchTime, 1.0f);
+    ASSERT_EQ(stats.last.numContactEvents, 5);
+
+    stats.Reset();
+    ASSERT_EQ(stats.numSteps, 0);
+    ASSERT_FLOAT_EQ(stats.peak.stepTime, 0.0f);
+}
+
+TEST(PhysicsStats, to_json)
+{
+    Resource::PhysicsStats stats;
+    Resource::PhysicsStepStats step;
+    step.numBodies = 3;
+    stats.Record(step);
+    stats.maxBodies = 1024;
+
+    std::string json = stats.ToJson();
+
+    ASSERT_NE(json.find("\"steps\":1"), std::string::npos);
+    ASSERT_NE(json.find("\"last\":{\"step_time_ms\":0,"), std::string::npos);
+    ASSERT_NE(json.find("\"bodies\":3"), std::string::npos);
+    ASSERT_NE(json.find("\"capacities\":{\"bodies\":1024,"), std::string::npos);
+    ASSERT_EQ(json.back(), '}');
+}
+
+TEST(PhysicsStats, sharded_counter)
+{
+    Utils::ShardedCounter counter;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 8; t++)
+    {
+        threads.emplace_back([&counter]() {
+            for (int i = 0; i < 1000; i++)
+            {
+                counter.Add();
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(counter.Exchange(), 8000);
+    ASSERT_EQ(counter.Exchange(), 0);
+}
+
+TEST(PhysicsStats, pair_filter_counts_only_when_enabled)
+{
+    auto layers = std::make_shared<Utils::CollisionLayers>(Utils::CollisionLayers::Default());
+    Utils::ObjectLayerPairFilterImpl filter(layers);
+
+    ASSERT_TRUE(filter.ShouldCollide(Utils::Layers::MOVING, Utils::Layers::MOVING));
+    ASSERT_EQ(filter.ExchangePairCount(), 0);
+
+    filter.SetCountingPairs(true);
+    ASSERT_TRUE(filter.ShouldCollide(Utils::Layers::MOVING, Utils::Layers::NON_MOVING));
+    ASSERT_FALSE(filter.ShouldCollide(Utils::Layers::NON_MOVING, Utils::Layers::NON_MOVING));
+    filter.SetCountingPairs(false);
+    ASSERT_TRUE(filter.ShouldCollide(Utils::Layers::MOVING, Utils::Layers::MOVING));
+
+    ASSERT_EQ(filter.ExchangePairCount(), 1);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "JoltPhysics.hpp"
+#include "PhysicsTestUtils.hpp"
+#include "Transform.hpp"
+
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+
+using namespace ES::Plugin::Physics;
+
+static ES::Engine::Entity CreateBox(ES::Engine::Core &core, const glm::vec3 &position)
+{
+    ES::Engine::Entity entity = core.CreateEntity();
+    entity.AddComponent<ES::Plugin::Object::Component::Transform>(core, position);
+    entity.AddComponent<Component::RigidBody3D>(core,
+                                                std::make_shared<JPH::BoxShapeSettings>(JPH::Vec3(0.5f, 0.5f, 0.5f)));
+    return entity;
+}
+
+TEST(QueryBatch, queries_return_entities)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    ES::Engine::Entity box = CreateBox(core, glm::vec3(0.0f, 0.0f, 0.0f));
+    ES::Engine::Entity other = CreateBox(core, glm::vec3(3.0f, 0.0f, 0.0f));
+
+    auto &batch = core.GetResource<Resource::QueryBatch>();
+    uint32_t ray = batch.AddRaycast(glm::vec3(0.0f, 0.0f, -5.0f), glm::vec3(0.0f, 0.0f, 10.0f));
+    uint32_t missedRay = batch.AddRaycast(glm::vec3(0.0f, 5.0f, -5.0f), glm::vec3(0.0f, 0.0f, 10.0f));
+    uint32_t filteredRay =
+        batch.AddRaycast(glm::vec3(0.0f, 0.0f, -5.0f), glm::vec3(0.0f, 0.0f, 10.0f), Utils::Layers::NON_MOVING);
+    uint32_t sphereCast = batch.AddSphereCast(glm::vec3(3.0f, 5.0f, 0.0f), 0.5f, glm::vec3(0.0f, -10.0f, 0.0f));
+    uint32_t overlap = batch.AddSphereOverlap(glm::vec3(1.5f, 0.0f, 0.0f), 1.5f);
+    batch.Execute(core);
+
+    ASSERT_EQ(batch.GetHits(ray).size(), 1);
+    EXPECT_EQ(batch.GetHits(ray)[0].entity, box);
+    EXPECT_NEAR(batch.GetHits(ray)[0].point.z, -0.5f, 1e-3f);
+    EXPECT_NEAR(batch.GetHits(ray)[0].normal.z, -1.0f, 1e-3f);
+    EXPECT_TRUE(batch.GetHits(missedRay).empty());
+    EXPECT_TRUE(batch.GetHits(filteredRay).empty());
+    ASSERT_EQ(batch.GetHits(sphereCast).size(), 1);
+    EXPECT_EQ(batch.GetHits(sphereCast)[0].entity, other);
+    EXPECT_EQ(batch.GetHits(overlap).size(), 2);
+
+    batch.Clear();
+    ASSERT_EQ(batch.Size(), 0);
+}
+
+TEST(QueryBatch, large_batch_runs_in_parallel)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    ES::Engine::Entity box = CreateBox(core, glm::vec3(0.0f, 0.0f, 0.0f));
+
+    auto &batch = core.GetResource<Resource::QueryBatch>();
+    for (int i = 0; i < 5000; i++)
+    {
+        float y = (i % 2 == 0) ? 0.0f : 5.0f;
+        batch.AddRaycast(glm::vec3(0.0f, y, -5.0f), glm::vec3(0.0f, 0.0f, 10.0f));
+    }
+    batch.Execute(core);
+
+    for (uint32_t i = 0; i < batch.Size(); i++)
+    {
+        auto hits = batch.GetHits(i);
+        if (i % 2 == 0)
+        {
+            ASSERT_EQ(hits.size(), 1);
+            ASSERT_EQ(hits[0].entity, box);
+        }
+        else
+        {
+            ASSERT_TRUE(hits.empty());
+        }
+    }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include "JoltPhysics.hpp"
+#include "Mesh.hpp"
+#include "PhysicsTestUtils.hpp"
+#include "Transform.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace ES::Plugin::Physics;
+using ES::Plugin::Object::Component::Mesh;
+using ES::Plugin::Object::Component::Transform;
+
+static Mesh CreateGridMesh(uint32_t size)
+{
+    Mesh mesh;
+    for (uint32_t y = 0; y < size; y++)
+    {
+        for (uint32_t x = 0; x < size; x++)
+        {
+            mesh.vertices.emplace_back(static_cast<float>(x), 0.0f, static_cast<float>(y));
+        }
+    }
+    for (uint32_t y = 0; y + 1 < size; y++)
+    {
+        for (uint32_t x = 0; x + 1 < size; x++)
+        {
+            uint32_t i = y * size + x;
+            mesh.indices.insert(mesh.indices.end(), {i, i + size, i + 1, i + 1, i + size, i + size + 1});
+        }
+    }
+    return mesh;
+}
+
+static ES::Engine::Entity CreateCloth(ES::Engine::Core &core, const Mesh &mesh)
+{
+    ES::Engine::Entity entity = core.CreateEntity();
+    entity.AddComponent<Transform>(core, glm::vec3(0.0f));
+    entity.AddComponent<Mesh>(core, mesh);
+    entity.AddComponent<Component::SoftBody3D>(core);
+    return entity;
+}
+
+TEST(SoftBodySettingsCache, same_mesh_shares_settings)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    Mesh mesh = CreateGridMesh(8);
+    ES::Engine::Entity first = CreateCloth(core, mesh);
+    ES::Engine::Entity second = CreateCloth(core, mesh);
+    ES::Engine::Entity other = CreateCloth(core, CreateGridMesh(6));
+
+    auto &firstBody = first.GetComponents<Component::SoftBody3D>(core);
+    auto &secondBody = second.GetComponents<Component::SoftBody3D>(core);
+    auto &otherBody = other.GetComponents<Component::SoftBody3D>(core);
+
+    ASSERT_NE(firstBody.body, nullptr);
+    ASSERT_NE(secondBody.body, nullptr);
+    EXPECT_EQ(firstBody.settings, secondBody.settings);
+    EXPECT_NE(firstBody.settings, otherBody.settings);
+
+    auto &cache = core.GetResource<Resource::SoftBodySettingsCache>();
+    EXPECT_EQ(cache.Size(), 2);
+
+    // Settings still used by a soft body survive pruning
+    cache.Prune();
+    EXPECT_EQ(cache.Size(), 2);
+}
+
+TEST(SoftBodySettingsCache, key_collision_builds_separate_settings)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    Mesh mesh = CreateGridMesh(4);
+    Mesh moved = mesh;
+    moved.vertices[0].y = 1.0f;
+    Component::SoftBody3D softBody;
+    auto key = Resource::SoftBodySettingsCache::MakeKey(mesh, softBody);
+    auto &cache = core.GetResource<Resource::SoftBodySettingsCache>();
+
+    auto settings = cache.Acquire(key, mesh, softBody, nullptr);
+    // A different mesh given the same key, as a hash collision would
+    auto collided = cache.Acquire(key, moved, softBody, nullptr);
+
+    EXPECT_NE(settings, collided);
+    EXPECT_FLOAT_EQ(collided->mVertices[0].mPosition.y, 1.0f);
+    EXPECT_EQ(cache.Acquire(key, mesh, softBody, nullptr), settings);
+    EXPECT_EQ(cache.Size(), 1);
+}
+
+TEST(SoftBodySettingsCache, unused_settings_are_pruned)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    StartPhysics(core);
+
+    ES::Engine::Entity kept = CreateCloth(core, CreateGridMesh(8));
+    ES::Engine::Entity removed = CreateCloth(core, CreateGridMesh(6));
+    auto &cache = core.GetResource<Resource::SoftBodySettingsCache>();
+    ASSERT_EQ(cache.Size(), 2);
+
+    removed.Destroy(core);
+    ASSERT_TRUE(cache.IsPruneRequested());
+
+    // The body is only removed from the world by the first flush, it still uses the settings
+    System::FlushBodyRemovals(core);
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_TRUE(cache.IsPruneRequested());
+
+    System::FlushBodyRemovals(core);
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_FALSE(cache.IsPruneRequested());
+    EXPECT_NE(kept.GetComponents<Component::SoftBody3D>(core).body, nullptr);
+}
+
+TEST(SoftBodySettingsCache, async_build_adds_body_once_ready)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    core.GetResource<Resource::PhysicsConfig>().buildSoftBodySettingsAsync = true;
+    StartPhysics(core);
+
+    ES::Engine::Entity cloth = CreateCloth(core, CreateGridMesh(16));
+    auto &softBody = cloth.GetComponents<Component::SoftBody3D>(core);
+    ASSERT_NE(softBody.settings, nullptr);
+
+    auto key = Resource::SoftBodySettingsCache::MakeKey(cloth.GetComponents<Mesh>(core), softBody);
+    auto &cache = core.GetResource<Resource::SoftBodySettingsCache>();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!cache.IsReady(key) && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(cache.IsReady(key));
+
+    System::AddPendingSoftBodies(core);
+    ASSERT_NE(softBody.body, nullptr);
+    EXPECT_TRUE(softBody.body->IsInBroadPhase());
+}
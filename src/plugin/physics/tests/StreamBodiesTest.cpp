@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "JoltPhysics.hpp"
+#include "PhysicsTestUtils.hpp"
+#include "Transform.hpp"
+
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <algorithm>
+
+using namespace ES::Plugin::Physics;
+using ES::Plugin::Object::Component::Transform;
+
+static ES::Engine::Entity CreateStreamedSphere(ES::Engine::Core &core, const glm::vec3 &position)
+{
+    ES::Engine::Entity entity = core.CreateEntity();
+    entity.AddComponent<Transform>(core, position);
+    entity.AddComponent<Component::StreamedBody>(core);
+    entity.AddComponent<Component::RigidBody3D>(core, std::make_shared<JPH::SphereShapeSettings>(0.5f),
+                                                JPH::EMotionType::Dynamic, Utils::Layers::MOVING);
+    return entity;
+}
+
+TEST(StreamBodies, bodies_follow_the_focus)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    // The config is copied by the PhysicsManager at startup
+    core.GetResource<Resource::PhysicsConfig>().streamingHysteresis = 5.0f;
+    StartPhysics(core);
+
+    ES::Engine::Entity focus = core.CreateEntity();
+    auto &focusTransform = focus.AddComponent<Transform>(core, glm::vec3(0.0f));
+    focus.AddComponent<Component::PhysicsFocus>(core, 10.0f);
+
+    ES::Engine::Entity nearSphere = CreateStreamedSphere(core, glm::vec3(5.0f, 0.0f, 0.0f));
+    ES::Engine::Entity farSphere = CreateStreamedSphere(core, glm::vec3(100.0f, 0.0f, 0.0f));
+
+    // Streamed bodies are not created with their component
+    ASSERT_EQ(nearSphere.GetComponents<Component::RigidBody3D>(core).body, nullptr);
+
+    System::StreamBodies(core);
+    JPH::Body *nearBody = nearSphere.GetComponents<Component::RigidBody3D>(core).body;
+    ASSERT_NE(nearBody, nullptr);
+    EXPECT_TRUE(nearBody->IsInBroadPhase());
+    EXPECT_EQ(farSphere.GetComponents<Component::RigidBody3D>(core).body, nullptr);
+
+    // Within the hysteresis, the body stays
+    nearBody->SetLinearVelocity(JPH::Vec3(1.0f, 2.0f, 3.0f));
+    focusTransform.position = glm::vec3(-8.0f, 0.0f, 0.0f);
+    System::StreamBodies(core);
+    ASSERT_EQ(nearSphere.GetComponents<Component::RigidBody3D>(core).body, nearBody);
+
+    // Out of range, the body leaves the world right away, to be pooled by the next flush, and its state is kept
+    focusTransform.position = glm::vec3(100.0f, 0.0f, 0.0f);
+    System::StreamBodies(core);
+    EXPECT_EQ(nearSphere.GetComponents<Component::RigidBody3D>(core).body, nullptr);
+    EXPECT_FALSE(nearBody->IsInBroadPhase());
+    EXPECT_EQ(core.GetResource<Resource::PhysicsManager>().GetBodyRecycler().GetRemovedCount(), 1);
+    EXPECT_EQ(nearSphere.GetComponents<Component::StreamedBody>(core).linearVelocity, glm::vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_NE(farSphere.GetComponents<Component::RigidBody3D>(core).body, nullptr);
+
+    // Back in range, the body moves on with its previous velocity
+    focusTransform.position = glm::vec3(0.0f);
+    System::StreamBodies(core);
+    nearBody = nearSphere.GetComponents<Component::RigidBody3D>(core).body;
+    ASSERT_NE(nearBody, nullptr);
+    EXPECT_TRUE(nearBody->IsActive());
+    EXPECT_NEAR(nearBody->GetLinearVelocity().GetY(), 2.0f, 1e-5f);
+}
+
+TEST(StreamBodies, insertions_are_spread_over_ticks)
+{
+    ES::Engine::Core core;
+    core.AddPlugins<Plugin>();
+    core.GetResource<Resource::PhysicsConfig>().maxStreamedInsertionsPerTick = 4;
+    StartPhysics(core);
+
+    ES::Engine::Entity focus = core.CreateEntity();
+    focus.AddComponent<Transform>(core, glm::vec3(0.0f));
+    focus.AddComponent<Component::PhysicsFocus>(core, 100.0f);
+
+    std::vector<ES::Engine::Entity> spheres;
+    for (int i = 0; i < 10; i++)
+    {
+        spheres.push_back(CreateStreamedSphere(core, glm::vec3(static_cast<float>(i) * 2.0f, 0.0f, 0.0f)));
+    }
+
+    auto countBodies = [&core, &spheres]() {
+        return std::ranges::count_if(spheres, [&core](ES::Engine::Entity sphere) {
+            return sphere.GetComponents<Component::RigidBody3D>(core).body != nullptr;
+        });
+    };
+
+    System::StreamBodies(core);
+    EXPECT_EQ(countBodies(), 4);
+    // The closest bodies come first
+    EXPECT_NE(spheres[0].GetComponents<Component::RigidBody3D>(core).body, nullptr);
+    EXPECT_EQ(spheres[9].GetComponents<Component::RigidBody3D>(core).body, nullptr);
+
+    System::StreamBodies(core);
+    System::StreamBodies(core);
+    EXPECT_EQ(countBodies(), 10);
+}
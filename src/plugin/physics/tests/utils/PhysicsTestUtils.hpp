@@ -0,0 +1,11 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Startup.hpp"
+
+/**
+ * @brief Run the startup systems of a core the physics plugin was added to, creating its physics world.
+ *
+ * The core isn't run: its shutdown systems would run on every RunSystems while it is not running.
+ */
+inline void StartPhysics(ES::Engine::Core &core) { core.GetScheduler<ES::Engine::Scheduler::Startup>().RunSystems(); }
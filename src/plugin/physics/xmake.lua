@@ -24,6 +24,19 @@ target("PluginPhysics")
     add_includedirs("src/utils", {public = true})
     add_includedirs("src/resource", {public = true})
 
+target("PhysicsBenchmark")
+    set_group(BENCHMARKS_GROUP_NAME)
+    set_kind("binary")
+    set_default(false)
+    set_languages("cxx20")
+    add_packages("glm", "entt", "fmt", "spdlog", "joltphysics")
+    add_deps("EngineSquaredCore")
+    add_deps("PluginPhysics")
+    add_files("benchmark/**.cpp")
+    if is_mode("debug") then
+        add_defines("DEBUG")
+    end
+
 for _, file in ipairs(os.files("tests/**.cpp")) do
     local name = path.basename(file)
     if name == "main" then
@@ -1,4 +1,6 @@
 #pragma once
 
 #include "component/Relationship.hpp"
+#include "resource/TransformHierarchy.hpp"
+#include "system/TransformSystems.hpp"
 #include "utils/Utils.hpp"
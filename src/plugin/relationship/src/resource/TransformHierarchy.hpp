@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "Transform.hpp"
+
+namespace ES::Plugin::Relationship::Resource {
+/**
+ * TransformHierarchy is a resource holding the entities linked by a Relationship and having a Transform, flattened
+ * in breadth-first order: every parent comes before its children, and nodes are sorted by depth.
+ *
+ * Propagating the world matrices is then a single linear sweep over the arrays, in which the world matrix of the
+ * parent of a node is always already computed. The arrays are rebuilt only when a Relationship changes, or when an
+ * entity gains or loses a Transform.
+ */
+struct TransformHierarchy {
+    /// @brief Parent index of the roots of the hierarchies.
+    inline static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+    /// @brief Whether a Relationship changed, or an entity gained or lost a Transform, since the arrays were built.
+    bool dirty = true;
+
+    /// @brief Entity of every node.
+    std::vector<entt::entity> entities;
+    /// @brief Index of the parent of every node, NO_PARENT for the roots.
+    std::vector<uint32_t> parents;
+    /// @brief Matrices of the Transform of every node, relative to its parent.
+    std::vector<glm::mat4> localModels;
+    std::vector<glm::mat3> localNormals;
+    /// @brief Transform the local matrices were computed from.
+    std::vector<ES::Plugin::Object::Component::Transform> localSources;
+    /// @brief World matrices of every node, as written in their WorldMatrix.
+    std::vector<glm::mat4> worldModels;
+    std::vector<glm::mat3> worldNormals;
+    /// @brief Whether the world matrices of the node changed during the last propagation.
+    std::vector<uint8_t> changed;
+
+    inline std::size_t Size() const { return entities.size(); }
+
+    void Clear()
+    {
+        entities.clear();
+        parents.clear();
+        localModels.clear();
+        localNormals.clear();
+        localSources.clear();
+        worldModels.clear();
+        worldNormals.clear();
+        changed.clear();
+    }
+};
+} // namespace ES::Plugin::Relationship::Resource
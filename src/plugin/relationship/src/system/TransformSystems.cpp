@@ -0,0 +1,162 @@
+#include "system/TransformSystems.hpp"
+#include "WorldMatrix.hpp"
+#include "component/Relationship.hpp"
+#include "resource/TransformHierarchy.hpp"
+
+#include <tuple>
+
+namespace ES::Plugin::Relationship::System {
+namespace {
+using ES::Plugin::Object::Component::Transform;
+using ES::Plugin::Object::Component::WorldMatrix;
+
+bool IsSameTransform(const Transform &a, const Transform &b)
+{
+    return a.position == b.position && a.scale == b.scale && a.rotation == b.rotation;
+}
+
+void AddNode(entt::registry &registry, Resource::TransformHierarchy &hierarchy, entt::entity entity, uint32_t parent)
+{
+    const auto &transform = registry.get<Transform>(entity);
+    const auto &worldMatrix = registry.get<WorldMatrix>(entity);
+    glm::mat4 localModel = transform.getTransformationMatrix();
+
+    hierarchy.entities.push_back(entity);
+    hierarchy.parents.push_back(parent);
+    hierarchy.localModels.push_back(localModel);
+    hierarchy.localNormals.push_back(glm::mat3(glm::transpose(glm::inverse(localModel))));
+    hierarchy.localSources.push_back(transform);
+    hierarchy.worldModels.push_back(worldMatrix.model);
+    hierarchy.worldNormals.push_back(worldMatrix.normal);
+    hierarchy.changed.push_back(1);
+}
+
+void RebuildHierarchy(entt::registry &registry, Resource::TransformHierarchy &hierarchy)
+{
+    // Entities that left the hierarchy hold a world matrix computed from their former parent: their Transform is
+    // back in world space
+    for (std::size_t i = 0; i < hierarchy.Size(); i++)
+    {
+        entt::entity entity = hierarchy.entities[i];
+        if (hierarchy.parents[i] == Resource::TransformHierarchy::NO_PARENT || !registry.valid(entity))
+        {
+            continue;
+        }
+        auto [transform, worldMatrix] = registry.try_get<Transform, WorldMatrix>(entity);
+        if (transform && worldMatrix)
+        {
+            worldMatrix->model = transform->getTransformationMatrix();
+            worldMatrix->normal = glm::mat3(glm::transpose(glm::inverse(worldMatrix->model)));
+        }
+    }
+    hierarchy.Clear();
+
+    auto nodes = registry.view<Component::Relationship, Transform, WorldMatrix>();
+    for (auto entity : nodes)
+    {
+        const auto &relationship = nodes.get<Component::Relationship>(entity);
+        if (relationship.parent == ES::Engine::Entity::entity_null_id && relationship.children > 0)
+        {
+            AddNode(registry, hierarchy, entity, Resource::TransformHierarchy::NO_PARENT);
+        }
+    }
+
+    // The children of every depth are appended after the nodes of the previous one
+    for (std::size_t i = 0; i < hierarchy.Size(); i++)
+    {
+        ES::Engine::Entity child = registry.get<Component::Relationship>(hierarchy.entities[i]).first;
+        while (child != ES::Engine::Entity::entity_null_id && registry.valid(child))
+        {
+            if (nodes.contains(child))
+            {
+                AddNode(registry, hierarchy, child, static_cast<uint32_t>(i));
+            }
+            const auto *relationship = registry.try_get<Component::Relationship>(child);
+            child = relationship ? relationship->next : ES::Engine::Entity::entity_null_id;
+        }
+    }
+}
+} // namespace
+
+void MarkTransformHierarchyDirty(entt::registry &registry, entt::entity)
+{
+    registry.ctx().get<Resource::TransformHierarchy>().dirty = true;
+}
+
+void CreateTransformHierarchy(ES::Engine::Core &core)
+{
+    core.RegisterResource<Resource::TransformHierarchy>({});
+
+    auto &registry = core.GetRegistry();
+    registry.on_construct<Component::Relationship>().connect<&MarkTransformHierarchyDirty>();
+    registry.on_update<Component::Relationship>().connect<&MarkTransformHierarchyDirty>();
+    registry.on_destroy<Component::Relationship>().connect<&MarkTransformHierarchyDirty>();
+    // Nodes need both a Transform and a WorldMatrix, which UpdateWorldMatrices adds to new Transforms
+    registry.on_construct<WorldMatrix>().connect<&MarkTransformHierarchyDirty>();
+    registry.on_destroy<Transform>().connect<&MarkTransformHierarchyDirty>();
+}
+
+void PropagateTransforms(ES::Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+    auto &hierarchy = core.GetResource<Resource::TransformHierarchy>();
+
+    bool rebuilt = hierarchy.dirty;
+    if (rebuilt)
+    {
+        RebuildHierarchy(registry, hierarchy);
+        hierarchy.dirty = false;
+    }
+
+    for (std::size_t i = 0; i < hierarchy.Size(); i++)
+    {
+        entt::entity entity = hierarchy.entities[i];
+        auto [transform, worldMatrix] =
+            registry.valid(entity) ? registry.try_get<Transform, WorldMatrix>(entity)
+                                   : std::tuple<Transform *, WorldMatrix *>{nullptr, nullptr};
+        if (!transform || !worldMatrix)
+        {
+            // The node lost its Transform: its branch is left as is until the next rebuild
+            hierarchy.dirty = true;
+            hierarchy.changed[i] = 0;
+            continue;
+        }
+
+        uint32_t parent = hierarchy.parents[i];
+        if (parent == Resource::TransformHierarchy::NO_PARENT)
+        {
+            hierarchy.changed[i] = rebuilt || worldMatrix->model != hierarchy.worldModels[i];
+            hierarchy.worldModels[i] = worldMatrix->model;
+            hierarchy.worldNormals[i] = worldMatrix->normal;
+            continue;
+        }
+
+        bool localChanged = !IsSameTransform(*transform, hierarchy.localSources[i]);
+        if (localChanged)
+        {
+            // UpdateWorldMatrices already computed the matrices of the new local transform
+            if (IsSameTransform(*transform, worldMatrix->source))
+            {
+                hierarchy.localModels[i] = worldMatrix->model;
+                hierarchy.localNormals[i] = worldMatrix->normal;
+            }
+            else
+            {
+                hierarchy.localModels[i] = transform->getTransformationMatrix();
+                hierarchy.localNormals[i] = glm::mat3(glm::transpose(glm::inverse(hierarchy.localModels[i])));
+            }
+            hierarchy.localSources[i] = *transform;
+        }
+
+        hierarchy.changed[i] = rebuilt || localChanged || hierarchy.changed[parent];
+        if (!hierarchy.changed[i])
+        {
+            continue;
+        }
+        hierarchy.worldModels[i] = hierarchy.worldModels[parent] * hierarchy.localModels[i];
+        hierarchy.worldNormals[i] = hierarchy.worldNormals[parent] * hierarchy.localNormals[i];
+        worldMatrix->model = hierarchy.worldModels[i];
+        worldMatrix->normal = hierarchy.worldNormals[i];
+    }
+}
+} // namespace ES::Plugin::Relationship::System
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ES::Plugin::Relationship::System {
+/**
+ * @brief Flag the TransformHierarchy to be rebuilt. Connected to the signals of the Relationship component, and to
+ * the creation of a WorldMatrix and the destruction of a Transform, which add or remove nodes.
+ */
+void MarkTransformHierarchyDirty(entt::registry &registry, entt::entity entity);
+
+/**
+ * @brief Register the TransformHierarchy resource and observe the Relationship, Transform and WorldMatrix components
+ * to keep it up to date.
+ *
+ * @param core  core
+ * @note To be used once, before PropagateTransforms.
+ */
+void CreateTransformHierarchy(ES::Engine::Core &core);
+
+/**
+ * @brief Compute the world matrices of the entities having a parent.
+ *
+ * The Transform of an entity with a parent is relative to its parent: its WorldMatrix is the WorldMatrix of its
+ * parent multiplied by the matrix of its Transform. Nodes are visited in a single breadth-first sweep, and only the
+ * subtrees whose local transform or root changed are recomputed. An entity without a Transform ends the propagation
+ * of its branch.
+ *
+ * @param core  core
+ * @note To be used after ES::Plugin::Object::System::UpdateWorldMatrices, which computes the matrices of the roots
+ * and of the changed local transforms.
+ * @note Systems writing world space poses into the Transform, such as the physics synchronization of a rigid body,
+ * must not be used on entities with a parent: only roots may have a RigidBody3D.
+ */
+void PropagateTransforms(ES::Engine::Core &core);
+} // namespace ES::Plugin::Relationship::System
@@ -23,14 +23,17 @@ auto ES::Plugin::Relationship::Utils::SetChildOf(ES::Engine::Core &core, ES::Eng
     {
         parentRS.first = child;
         newChildRS.parent = parent;
-        return;
     }
-
-    auto &firstChildRS = parentRS.first.GetComponents<ES::Plugin::Relationship::Component::Relationship>(core);
-    firstChildRS.prev = child;
-    newChildRS.next = parentRS.first;
-    parentRS.first = child;
-    newChildRS.parent = parent;
+    else
+    {
+        auto &firstChildRS = parentRS.first.GetComponents<ES::Plugin::Relationship::Component::Relationship>(core);
+        firstChildRS.prev = child;
+        newChildRS.next = parentRS.first;
+        parentRS.first = child;
+        newChildRS.parent = parent;
+    }
+    // Notify the observers of the hierarchy, such as the TransformHierarchy
+    core.GetRegistry().patch<ES::Plugin::Relationship::Component::Relationship>(child);
 }
 
 auto ES::Plugin::Relationship::Utils::IsChildOf(ES::Engine::Core &core, ES::Engine::Entity child,
@@ -73,6 +76,7 @@ auto ES::Plugin::Relationship::Utils::RemoveParent(ES::Engine::Core &core, ES::E
     {
         childRS.next.GetComponents<ES::Plugin::Relationship::Component::Relationship>(core).prev = childRS.prev;
     }
+    core.GetRegistry().patch<ES::Plugin::Relationship::Component::Relationship>(child);
 }
 
 auto ES::Plugin::Relationship::Utils::GetParent(ES::Engine::Core &core, ES::Engine::Entity child) -> ES::Engine::Entity
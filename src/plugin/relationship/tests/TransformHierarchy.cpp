@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include "Core.hpp"
+#include "Transform.hpp"
+#include "WorldMatrix.hpp"
+#include "WorldMatrixSystems.hpp"
+#include "component/Relationship.hpp"
+#include "resource/TransformHierarchy.hpp"
+#include "system/TransformSystems.hpp"
+#include "utils/Utils.hpp"
+
+using ES::Plugin::Object::Component::Transform;
+using ES::Plugin::Object::Component::WorldMatrix;
+
+static void UpdateTransforms(ES::Engine::Core &core)
+{
+    ES::Plugin::Object::System::UpdateWorldMatrices(core);
+    ES::Plugin::Relationship::System::PropagateTransforms(core);
+}
+
+static glm::vec3 WorldPosition(ES::Engine::Core &core, ES::Engine::Entity entity)
+{
+    return glm::vec3(entity.GetComponents<WorldMatrix>(core).model[3]);
+}
+
+TEST(TransformHierarchy, child_follows_parent)
+{
+    ES::Engine::Core core;
+    ES::Plugin::Relationship::System::CreateTransformHierarchy(core);
+
+    ES::Engine::Entity parent = core.CreateEntity();
+    ES::Engine::Entity child = core.CreateEntity();
+    auto &parentTransform = parent.AddComponent<Transform>(core, glm::vec3(1.0f, 0.0f, 0.0f));
+    child.AddComponent<Transform>(core, glm::vec3(0.0f, 2.0f, 0.0f));
+    ES::Plugin::Relationship::Utils::SetChildOf(core, child, parent);
+
+    UpdateTransforms(core);
+    EXPECT_EQ(WorldPosition(core, child), glm::vec3(1.0f, 2.0f, 0.0f));
+
+    parentTransform.setPosition(5.0f, 0.0f, 0.0f);
+    UpdateTransforms(core);
+    EXPECT_EQ(WorldPosition(core, child), glm::vec3(5.0f, 2.0f, 0.0f));
+}
+
+TEST(TransformHierarchy, local_change_and_grandchildren)
+{
+    ES::Engine::Core core;
+    ES::Plugin::Relationship::System::CreateTransformHierarchy(core);
+
+    ES::Engine::Entity root = core.CreateEntity();
+    ES::Engine::Entity child = core.CreateEntity();
+    ES::Engine::Entity grandchild = core.CreateEntity();
+    root.AddComponent<Transform>(core, glm::vec3(0.0f), glm::vec3(2.0f));
+    auto &childTransform = child.AddComponent<Transform>(core, glm::vec3(1.0f, 0.0f, 0.0f));
+    grandchild.AddComponent<Transform>(core, glm::vec3(0.0f, 1.0f, 0.0f));
+    ES::Plugin::Relationship::Utils::SetChildOf(core, grandchild, child);
+    ES::Plugin::Relationship::Utils::SetChildOf(core, child, root);
+
+    UpdateTransforms(core);
+    EXPECT_EQ(WorldPosition(core, child), glm::vec3(2.0f, 0.0f, 0.0f));
+    EXPECT_EQ(WorldPosition(core, grandchild), glm::vec3(2.0f, 2.0f, 0.0f));
+
+    auto &hierarchy = core.GetResource<ES::Plugin::Relationship::Resource::TransformHierarchy>();
+    ASSERT_EQ(hierarchy.Size(), 3);
+    EXPECT_EQ(hierarchy.entities[0], static_cast<entt::entity>(root));
+    EXPECT_EQ(hierarchy.entities[1], static_cast<entt::entity>(child));
+    EXPECT_EQ(hierarchy.entities[2], static_cast<entt::entity>(grandchild));
+
+    childTransform.setPosition(0.0f, 0.0f, 1.0f);
+    UpdateTransforms(core);
+    EXPECT_FALSE(hierarchy.changed[0]);
+    EXPECT_TRUE(hierarchy.changed[1]);
+    EXPECT_TRUE(hierarchy.changed[2]);
+    EXPECT_EQ(WorldPosition(core, grandchild), glm::vec3(0.0f, 2.0f, 2.0f));
+
+    UpdateTransforms(core);
+    EXPECT_FALSE(hierarchy.changed[1]);
+    EXPECT_FALSE(hierarchy.changed[2]);
+}
+
+TEST(TransformHierarchy, removed_child_is_back_in_world_space)
+{
+    ES::Engine::Core core;
+    ES::Plugin::Relationship::System::CreateTransformHierarchy(core);
+
+    ES::Engine::Entity parent = core.CreateEntity();
+    ES::Engine::Entity child = core.CreateEntity();
+    parent.AddComponent<Transform>(core, glm::vec3(1.0f, 0.0f, 0.0f));
+    child.AddComponent<Transform>(core, glm::vec3(0.0f, 2.0f, 0.0f));
+    ES::Plugin::Relationship::Utils::SetChildOf(core, child, parent);
+    UpdateTransforms(core);
+
+    ES::Plugin::Relationship::Utils::RemoveParent(core, child);
+    UpdateTransforms(core);
+    EXPECT_EQ(WorldPosition(core, child), glm::vec3(0.0f, 2.0f, 0.0f));
+}
+
+TEST(TransformHierarchy, child_gets_transform_after_being_parented)
+{
+    ES::Engine::Core core;
+    ES::Plugin::Relationship::System::CreateTransformHierarchy(core);
+
+    ES::Engine::Entity parent = core.CreateEntity();
+    ES::Engine::Entity child = core.CreateEntity();
+    parent.AddComponent<Transform>(core, glm::vec3(1.0f, 0.0f, 0.0f));
+    ES::Plugin::Relationship::Utils::SetChildOf(core, child, parent);
+    UpdateTransforms(core);
+
+    child.AddComponent<Transform>(core, glm::vec3(0.0f, 2.0f, 0.0f));
+    UpdateTransforms(core);
+    EXPECT_EQ(WorldPosition(core, child), glm::vec3(1.0f, 2.0f, 0.0f));
+}
+
+TEST(TransformHierarchy, root_gets_transform_after_its_children)
+{
+    ES::Engine::Core core;
+    ES::Plugin::Relationship::System::CreateTransformHierarchy(core);
+
+    ES::Engine::Entity parent = core.CreateEntity();
+    ES::Engine::Entity child = core.CreateEntity();
+    child.AddComponent<Transform>(core, glm::vec3(0.0f, 2.0f, 0.0f));
+    ES::Plugin::Relationship::Utils::SetChildOf(core, child, parent);
+    UpdateTransforms(core);
+    EXPECT_EQ(WorldPosition(core, child), glm::vec3(0.0f, 2.0f, 0.0f));
+
+    parent.AddComponent<Transform>(core, glm::vec3(1.0f, 0.0f, 0.0f));
+    UpdateTransforms(core);
+    EXPECT_EQ(WorldPosition(core, child), glm::vec3(1.0f, 2.0f, 0.0f));
+}
+
+TEST(TransformHierarchy, root_losing_transform_releases_children)
+{
+    ES::Engine::Core core;
+    ES::Plugin::Relationship::System::CreateTransformHierarchy(core);
+
+    ES::Engine::Entity parent = core.CreateEntity();
+    ES::Engine::Entity child = core.CreateEntity();
+    parent.AddComponent<Transform>(core, glm::vec3(1.0f, 0.0f, 0.0f));
+    child.AddComponent<Transform>(core, glm::vec3(0.0f, 2.0f, 0.0f));
+    ES::Plugin::Relationship::Utils::SetChildOf(core, child, parent);
+    UpdateTransforms(core);
+
+    parent.RemoveComponent<Transform>(core);
+    UpdateTransforms(core);
+    EXPECT_TRUE(core.GetResource<ES::Plugin::Relationship::Resource::TransformHierarchy>().entities.empty());
+    EXPECT_EQ(WorldPosition(core, child), glm::vec3(0.0f, 2.0f, 0.0f));
+}
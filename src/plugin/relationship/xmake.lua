@@ -1,18 +1,20 @@
 add_rules("mode.debug", "mode.release")
-add_requires("entt", "gtest", "spdlog", "fmt")
+add_requires("entt", "gtest", "glm", "spdlog", "fmt")
 
 includes("../../engine/xmake.lua")
 includes("../../utils/log/xmake.lua")
+includes("../object/xmake.lua")
 
 target("PluginRelationship")
     set_group(PLUGINS_GROUP_NAME)
     set_kind("static")
     set_languages("cxx20")
     set_policy("build.warning", true)
-    add_packages("entt", "spdlog", "fmt")
+    add_packages("entt", "glm", "spdlog", "fmt")
 
     add_deps("EngineSquaredCore")
     add_deps("UtilsLog")
+    add_deps("PluginObject")
 
     add_headerfiles("src/**.hpp", { public = true })
     add_includedirs("src/", {public = true})
@@ -34,12 +36,13 @@ for _, file in ipairs(os.files("tests/**.cpp")) do
         end
         set_default(false)
         set_languages("cxx20")
-        add_packages("entt", "gtest", "spdlog", "fmt")
+        add_packages("entt", "gtest", "glm", "spdlog", "fmt")
         add_links("gtest")
         add_tests("default")
 
         add_deps("EngineSquaredCore")
         add_deps("PluginRelationship")
+        add_deps("PluginObject")
         add_deps("UtilsLog")
 
         add_files(file)
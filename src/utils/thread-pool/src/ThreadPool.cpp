@@ -0,0 +1,163 @@
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace ES::Utils {
+struct ThreadPool::State {
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    const std::function<void(std::size_t)> *task = nullptr;
+    std::size_t count = 0;
+    std::atomic<std::size_t> next = 0;
+    /// @brief Tasks of the current loop not finished yet.
+    std::size_t pending = 0;
+    /// @brief Workers running tasks of the current loop.
+    std::size_t active = 0;
+    /// @brief Incremented by every loop, so workers know a new one started.
+    uint64_t generation = 0;
+
+    std::deque<std::function<void()>> jobs;
+    bool stop = false;
+
+    /**
+     * @brief Take and run tasks of the current loop until none is left.
+     */
+    void RunTasks()
+    {
+        for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+        {
+            (*task)(i);
+
+            std::scoped_lock lock(mutex);
+            if (--pending == 0)
+                done.notify_all();
+        }
+    }
+
+    void WorkerLoop()
+    {
+        uint64_t seen = 0;
+        while (true)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock lock(mutex);
+                wake.wait(lock, [this, seen]() { return stop || generation != seen || !jobs.empty(); });
+                if (stop)
+                    return;
+                // Loops go first: the thread that started one is waiting for it
+                if (generation != seen)
+                {
+                    seen = generation;
+                    // The loop already finished without this worker
+                    if (task == nullptr)
+                        continue;
+                    active++;
+                }
+                else
+                {
+                    job = std::move(jobs.front());
+                    jobs.pop_front();
+                }
+            }
+
+            if (job)
+            {
+                job();
+                continue;
+            }
+
+            RunTasks();
+
+            std::scoped_lock lock(mutex);
+            if (--active == 0)
+                done.notify_all();
+        }
+    }
+};
+
+ThreadPool::ThreadPool(std::size_t threadCount) : _state(std::make_unique<State>())
+{
+    for (std::size_t i = 1; i < threadCount; i++)
+    {
+        _state->workers.emplace_back(&State::WorkerLoop, _state.get());
+    }
+}
+
+ThreadPool::ThreadPool(ThreadPool &&) noexcept = default;
+
+ThreadPool &ThreadPool::operator=(ThreadPool &&other) noexcept
+{
+    if (this != &other)
+    {
+        ThreadPool stopped(std::move(*this));
+        _state = std::move(other._state);
+    }
+    return *this;
+}
+
+ThreadPool::~ThreadPool()
+{
+    if (!_state)
+        return;
+
+    {
+        std::scoped_lock lock(_state->mutex);
+        _state->stop = true;
+    }
+    _state->wake.notify_all();
+    for (auto &worker : _state->workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t count, const std::function<void(std::size_t)> &task)
+{
+    if (count == 0)
+        return;
+
+    State &state = *_state;
+    {
+        std::scoped_lock lock(state.mutex);
+        state.task = &task;
+        state.count = count;
+        state.next = 0;
+        state.pending = count;
+        state.generation++;
+    }
+    state.wake.notify_all();
+
+    state.RunTasks();
+
+    // Workers still inside RunTasks may read the task: wait for them to leave before it goes out of scope
+    std::unique_lock lock(state.mutex);
+    state.done.wait(lock, [&state]() { return state.pending == 0 && state.active == 0; });
+    state.task = nullptr;
+}
+
+std::size_t ThreadPool::GetThreadCount() const { return _state->workers.size() + 1; }
+
+void ThreadPool::Enqueue(std::function<void()> job)
+{
+    if (_state->workers.empty())
+    {
+        job();
+        return;
+    }
+    {
+        std::scoped_lock lock(_state->mutex);
+        _state->jobs.push_back(std::move(job));
+    }
+    _state->wake.notify_one();
+}
+} // namespace ES::Utils
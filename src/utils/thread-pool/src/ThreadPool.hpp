@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace ES::Utils {
+/**
+ * @brief A fixed set of worker threads, started once and shared by the systems running work in parallel, so they
+ * don't pay for creating threads every frame.
+ *
+ * It runs two kinds of work:
+ * - ParallelFor splits a loop between the workers and the calling thread, and returns once the loop is done.
+ * - Submit queues a background job, run by the first free worker, and returns a future of its result. At most one
+ * job per worker runs at once, however many are submitted.
+ *
+ * The pool is movable, so it can be stored as a resource.
+ *
+ * @note ParallelFor must not be called by several threads at once, nor from one of its own tasks or jobs.
+ */
+class ThreadPool {
+  public:
+    /**
+     * @brief Start the worker threads.
+     *
+     * @param threadCount Number of threads working on a loop, the calling thread included.
+     */
+    explicit ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency());
+    ThreadPool(ThreadPool &&) noexcept;
+    ThreadPool &operator=(ThreadPool &&) noexcept;
+    /// @brief Stop the workers, once their running jobs return. Jobs that didn't start are dropped.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Call task(i) for every i in [0, count), on the workers and the calling thread, and wait for all the
+     * calls to return. Workers busy with a job don't take part, the calling thread runs the tasks left.
+     */
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t)> &task);
+
+    /**
+     * @brief Queue a job run by a worker. Without workers, it runs on the calling thread before Submit returns.
+     *
+     * @return The future of the result of the job.
+     */
+    template <typename TJob> std::future<std::invoke_result_t<TJob>> Submit(TJob &&job)
+    {
+        auto task = std::make_shared<std::packaged_task<std::invoke_result_t<TJob>()>>(std::forward<TJob>(job));
+        auto future = task->get_future();
+        Enqueue([task]() { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Get the number of threads working on a loop, the calling thread included.
+     */
+    std::size_t GetThreadCount() const;
+
+  private:
+    struct State;
+
+    void Enqueue(std::function<void()> job);
+
+    std::unique_ptr<State> _state;
+};
+} // namespace ES::Utils
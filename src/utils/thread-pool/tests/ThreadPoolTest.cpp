@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <vector>
+
+using namespace ES::Utils;
+
+TEST(ThreadPool, parallel_for_runs_every_task_once)
+{
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> calls(1000);
+
+    for (int loop = 0; loop < 10; loop++)
+    {
+        pool.ParallelFor(calls.size(), [&calls](std::size_t i) { calls[i]++; });
+    }
+
+    EXPECT_EQ(pool.GetThreadCount(), 4);
+    for (const auto &count : calls)
+    {
+        EXPECT_EQ(count, 10);
+    }
+}
+
+TEST(ThreadPool, parallel_for_without_workers)
+{
+    ThreadPool pool(1);
+    std::vector<int> calls(100, 0);
+
+    pool.ParallelFor(calls.size(), [&calls](std::size_t i) { calls[i]++; });
+
+    EXPECT_EQ(pool.GetThreadCount(), 1);
+    EXPECT_EQ(calls, std::vector<int>(100, 1));
+}
+
+TEST(ThreadPool, submit_returns_the_result)
+{
+    ThreadPool pool(3);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 20; i++)
+    {
+        results.push_back(pool.Submit([i]() { return i * i; }));
+    }
+
+    for (int i = 0; i < 20; i++)
+    {
+        EXPECT_EQ(results[i].get(), i * i);
+    }
+}
+
+TEST(ThreadPool, submit_without_workers_runs_on_the_calling_thread)
+{
+    ThreadPool pool(1);
+
+    std::future<std::thread::id> result = pool.Submit([]() { return std::this_thread::get_id(); });
+
+    EXPECT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(result.get(), std::this_thread::get_id());
+}
+
+TEST(ThreadPool, jobs_are_bounded_by_the_workers)
+{
+    ThreadPool pool(3);
+    std::atomic<int> running = 0;
+    std::atomic<int> maxRunning = 0;
+
+    std::vector<std::future<void>> jobs;
+    for (int i = 0; i < 32; i++)
+    {
+        jobs.push_back(pool.Submit([&running, &maxRunning]() {
+            int current = ++running;
+            int previous = maxRunning;
+            while (current > previous && !maxRunning.compare_exchange_weak(previous, current))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            running--;
+        }));
+    }
+    for (auto &job : jobs)
+    {
+        job.get();
+    }
+
+    EXPECT_LE(maxRunning, 2);
+}
+
+TEST(ThreadPool, parallel_for_finishes_while_workers_run_jobs)
+{
+    ThreadPool pool(2);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::future<void> job = pool.Submit([released]() { released.wait(); });
+
+    std::vector<int> calls(100, 0);
+    pool.ParallelFor(calls.size(), [&calls](std::size_t i) { calls[i]++; });
+
+    EXPECT_EQ(calls, std::vector<int>(100, 1));
+    release.set_value();
+    job.get();
+}
+
+TEST(ThreadPool, moved_pool_keeps_its_workers)
+{
+    ThreadPool pool(3);
+    ThreadPool moved(std::move(pool));
+
+    std::atomic<int> sum = 0;
+    moved.ParallelFor(10, [&sum](std::size_t i) { sum += static_cast<int>(i); });
+
+    EXPECT_EQ(moved.GetThreadCount(), 3);
+    EXPECT_EQ(sum, 45);
+    EXPECT_EQ(moved.Submit([]() { return 7; }).get(), 7);
+}
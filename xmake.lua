@@ -1,6 +1,7 @@
 TEST_GROUP_NAME = "UnitTests"
 PLUGINS_GROUP_NAME = "Plugins"
 UTILS_GROUP_NAME = "Utils"
+BENCHMARKS_GROUP_NAME = "Benchmarks"
 -- Set the default group for all targets
 
 add_rules("mode.debug", "mode.release")